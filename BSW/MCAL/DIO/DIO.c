@@ -10,125 +10,513 @@
  */
 #include "DIO.h"
 #include "DIO_Private.h"
+#include "../Trace/Trace.h"
 
-/**
- * @brief Dio_ReadChannel is a service that returns the value of the specified DIO channel
- * 
- * @details Service ID [hex] 0x00
- *          Synchronous/Asynchronous: Synchronous
- *          Reentrancy: Reentrant
- *          
- * @param [in] ChannelId         The channel ID of the DIO channel to be read.
- * @return Dio_LevelType    The value of the specified DIO channel.
- *                             - STD_HIGH The physical level of the corresponding Pin is STD_HIGH
- *                             - STD_LOW The physical level of the corresponding Pin is STD_LOW
+/* Keep the inline fast path macros of DIO.h away from the function definitions below */
+#undef Dio_ReadChannel
+#undef Dio_WriteChannel
+#undef Dio_ReadPort
+#undef Dio_WritePort
+#undef Dio_MaskedWritePort
+#undef Dio_FlipChannel
+#undef Dio_EnableNotification
+#undef Dio_DisableNotification
+
+STATIC const Dio_ConfigType * Dio_Config = NULL_PTR;          /* Configuration set given to Dio_Init, returned by Dio_GetConfig */
+STATIC const Dio_ChannelConfigType * Dio_Channels = NULL_PTR; /* Resolved channels of the configuration set, indexed by the channel ID */
+STATIC const uint32 * Dio_PortBaseAddress = NULL_PTR;          /* GPIO base addresses of the configuration set, indexed by the port ID */
+STATIC const Dio_PortWriteType * Dio_SyncPortWrites = NULL_PTR;  /* Synchronous port write list of the configuration set */
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+STATIC const Dio_ChannelGroupType * Dio_Groups = NULL_PTR;     /* Channel groups of the configuration set, to validate group pointers */
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+STATIC const Dio_VirtualPortType * Dio_VirtualPorts = NULL_PTR; /* Virtual ports of the configuration set, to validate their pointers */
+#endif
+#endif
+STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;                /* Dio Status */
+STATIC uint8 Dio_ClockedPorts = 0U;                           /* Ports clocked at Dio_Init, bit PortId set */
+STATIC uint8 Dio_ClockedPortIds[DIO_CONFIGURED_PORTS];        /* IDs of the clocked ports, sampled by Dio_ReadAllPorts */
+STATIC uint8 Dio_ClockedPortCount = 0U;                       /* Number of entries of Dio_ClockedPortIds */
+
+/* Port PortId is configured and was clocked at Dio_Init, ports gated off by PORT_GATE_UNUSED_PORTS are not */
+#define DIO_PORT_VALID(PORT_ID)   (((PORT_ID) < DIO_CONFIGURED_PORTS) && ((((uint32)Dio_ClockedPorts >> (PORT_ID)) & 1U) != 0U))
+
+/* Channel ChannelId is configured and its port was clocked at Dio_Init */
+#define DIO_CHANNEL_VALID(CHANNEL_ID)   (((CHANNEL_ID) < DIO_CONFIGURED_CHANNELS) && DIO_PORT_VALID(Dio_Channels[(CHANNEL_ID)].port))
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+/* ChannelGroupIdPtr is an entry of the channel groups of the configuration set, compared by address only */
+STATIC boolean Dio_IsConfiguredGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+    uint8 Index;
+
+    for (Index = 0U; Index < DIO_CONFIGURED_GROUPS; Index++)
+    {
+        if (ChannelGroupIdPtr == &Dio_Groups[Index])
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+/* VirtualPortPtr is an entry of the virtual ports of the configuration set, compared by address only */
+STATIC boolean Dio_IsConfiguredVirtualPort(const Dio_VirtualPortType * VirtualPortPtr)
+{
+    uint8 Index;
+
+    for (Index = 0U; Index < DIO_CONFIGURED_VIRTUAL_PORTS; Index++)
+    {
+        if (VirtualPortPtr == &Dio_VirtualPorts[Index])
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Every physical port VirtualPortPtr accesses was clocked at Dio_Init */
+STATIC boolean Dio_IsClockedVirtualPort(const Dio_VirtualPortType * VirtualPortPtr)
+{
+    uint8 Index;
+
+    for (Index = 0U; Index < VirtualPortPtr->access_count; Index++)
+    {
+        if (!DIO_PORT_VALID(VirtualPortPtr->accesses[Index].port))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+#endif
+#endif
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+STATIC Dio_PortLevelType Dio_ShadowPins[DIO_CONFIGURED_PORTS];             /* Shadowed output pins of every port */
+STATIC volatile Dio_PortLevelType Dio_OutputShadow[DIO_CONFIGURED_PORTS];  /* Last level written to the shadowed pins */
+
+/*
+ * Store Value to the aperture at Address, which reaches the pins Pins of port PortId, and keep the level of
+ * the shadowed ones. The shadow and the pins are updated in one critical section, so a write of the same
+ * pins from an ISR cannot leave them different. Pins that are not shadowed cost one load and one compare.
  */
-Dio_LevelType Dio_ReadChannel ( Dio_ChannelType ChannelId ){
-    Dio_LevelType Level;
-    if (ChannelId < 8)
+LOCAL_INLINE void Dio_WriteShadowed(Dio_PortType PortId, Dio_PortLevelType Pins, uint32 Address, uint32 Value)
+{
+    Dio_PortLevelType Shadowed = Dio_ShadowPins[PortId] & Pins;
+
+    if (Shadowed == 0U)
     {
-        Level = (Dio_LevelType)GET_BIT(GPIO_PORTA_DATA_R,ChannelId);
+        DIO_WRITE_REG(Address, Value);
     }
-    else if (ChannelId < 16)
+    else
     {
-        Level = (Dio_LevelType)GET_BIT(GPIO_PORTB_DATA_R,ChannelId-8);
+        uint32 Primask = Dio_SuspendInterrupts();
+        DIO_WRITE_REG(Address, Value);
+        Dio_OutputShadow[PortId] = (Dio_PortLevelType)((Dio_OutputShadow[PortId] & ~Shadowed) | (Value & Shadowed));
+        Dio_ResumeInterrupts(Primask);
     }
-    else if (ChannelId < 24)
+}
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+STATIC Dio_PortsImageType Dio_DebounceReload[DIO_DEBOUNCE_COUNTER_BITS];  /* Bit-planes of (depth - 1) of every pin */
+STATIC Dio_PortsImageType Dio_DebounceCounter[DIO_DEBOUNCE_COUNTER_BITS]; /* Bit-planes of the vertical down counters */
+STATIC Dio_PortsImageType Dio_DebounceFiltered = 0U;  /* Pins with a non zero filter depth */
+STATIC Dio_PortsImageType Dio_DebouncedLevels = 0U;   /* Debounced levels */
+STATIC Dio_PortsImageType Dio_RisingEdges = 0U;       /* Rising edges of the last Dio_MainFunction call */
+STATIC Dio_PortsImageType Dio_FallingEdges = 0U;      /* Falling edges of the last Dio_MainFunction call */
+STATIC boolean Dio_DebounceSeeded = FALSE;            /* Debounced levels taken from a first sample */
+#endif
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+STATIC Dio_NotificationType Dio_PinNotifications[DIO_CONFIGURED_PORTS][8U]; /* Callback of every pin, indexed by port ID and pin */
+#endif
+
+#if ((DIO_NOTIFICATION_API == STD_ON) || (DIO_CAPTURE_API == STD_ON))
+STATIC Dio_ChannelType Dio_PinChannels[DIO_CONFIGURED_PORTS][8U];  /* Channel ID of every pin, indexed by port ID and pin */
+STATIC Dio_PortLevelType Dio_PortChannelPins[DIO_CONFIGURED_PORTS]; /* Pins of every port that are configured channels */
+#endif
+
+#if ((DIO_NOTIFICATION_API == STD_ON) || (DIO_PATTERN_API == STD_ON) || (DIO_CAPTURE_API == STD_ON) || (DIO_SHARED_DMA_API == STD_ON))
+/* Set (Set = TRUE) or clear the bits Mask of the register at Address */
+STATIC void Dio_UpdateRegBits(uint32 Address, uint32 Mask, boolean Set)
+{
+    uint32 Value = DIO_READ_REG(Address);
+    DIO_WRITE_REG(Address, (Set == TRUE) ? (Value | Mask) : (Value & ~Mask));
+}
+#endif
+
+#if ((DIO_PATTERN_API == STD_ON) || (DIO_CAPTURE_API == STD_ON) || (DIO_SHARED_DMA_API == STD_ON))
+/* uDMA control table, primary structures then alternate structures, 1024-byte aligned as required by DMACTLBASE */
+STATIC Dio_DmaControlType Dio_DmaControlTable[2U * DIO_UDMA_CHANNELS] __attribute__((aligned(1024)));
+
+/* Control structure of half BufferIndex (primary for 0, alternate for 1) of uDMA channel Channel */
+#define DIO_DMA_CONTROL(CHANNEL, BUFFER_INDEX)                        \
+    (&Dio_DmaControlTable[(uint32)(CHANNEL) + ((uint32)(BUFFER_INDEX) * DIO_UDMA_CHANNELS)])
+
+/* Clocks the timers of TimerMask and the uDMA, and enables the uDMA controller */
+STATIC void Dio_EnableDma(uint32 TimerMask)
+{
+    if ((DIO_READ_REG(DIO_RCGCTIMER_REGISTER_ADDRESS) & TimerMask) != TimerMask)
     {
-        Level = (Dio_LevelType)GET_BIT(GPIO_PORTC_DATA_R,ChannelId-16);
+        Dio_UpdateRegBits(DIO_RCGCTIMER_REGISTER_ADDRESS, TimerMask, TRUE);
+        while ((DIO_READ_REG(DIO_PRTIMER_REGISTER_ADDRESS) & TimerMask) != TimerMask);
     }
-    else if (ChannelId < 32)
+    if ((DIO_READ_REG(DIO_RCGCDMA_REGISTER_ADDRESS) & SYSCTL_RCGCDMA_R0) == 0U)
     {
-        Level = (Dio_LevelType)GET_BIT(GPIO_PORTD_DATA_R,ChannelId-24);
+        Dio_UpdateRegBits(DIO_RCGCDMA_REGISTER_ADDRESS, SYSCTL_RCGCDMA_R0, TRUE);
+        while ((DIO_READ_REG(DIO_PRDMA_REGISTER_ADDRESS) & SYSCTL_PRDMA_R0) == 0U);
     }
-    else if (ChannelId < 40)
+    DIO_WRITE_REG(DIO_UDMA_CFG_REGISTER_ADDRESS, UDMA_CFG_MASTEN);
+    DIO_WRITE_REG(DIO_UDMA_CTLBASE_REGISTER_ADDRESS, DIO_RAM_ADDRESS(Dio_DmaControlTable, sizeof(Dio_DmaControlTable)));
+}
+
+#if ((DIO_PATTERN_API == STD_ON) || (DIO_CAPTURE_API == STD_ON))
+/* Timer request, default priority, single requests and primary structure first for uDMA channel Channel */
+STATIC void Dio_SetupDmaChannel(uint32 Channel)
+{
+    uint32 ChannelBit = 1UL << Channel;
+
+    DIO_WRITE_REG(DIO_UDMA_CHMAP2_REGISTER_ADDRESS,
+                  DIO_READ_REG(DIO_UDMA_CHMAP2_REGISTER_ADDRESS) & ~(0xFUL << DIO_UDMA_CHMAP2_SHIFT(Channel)));
+    DIO_WRITE_REG(DIO_UDMA_PRIOCLR_REGISTER_ADDRESS, ChannelBit);
+    DIO_WRITE_REG(DIO_UDMA_ALTCLR_REGISTER_ADDRESS, ChannelBit);
+    DIO_WRITE_REG(DIO_UDMA_USEBURSTCLR_REGISTER_ADDRESS, ChannelBit);
+    DIO_WRITE_REG(DIO_UDMA_REQMASKCLR_REGISTER_ADDRESS, ChannelBit);
+}
+#endif
+#endif
+
+#if (DIO_PATTERN_API == STD_ON)
+STATIC const Dio_PatternType * Dio_Pattern = NULL_PTR;  /* Pattern being output */
+
+/* Validates a pattern to be started, returns DIO_E_OK or the development error it raises */
+STATIC uint8 Dio_CheckPattern(const Dio_PatternType * Pattern)
+{
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        Level = (Dio_LevelType)GET_BIT(GPIO_PORTE_DATA_R,ChannelId-32);
+        return DIO_E_UNINIT;
     }
-    else if (ChannelId < 48)
+    if ((Pattern == NULL_PTR) || (Pattern->buffers[0] == NULL_PTR) || (Pattern->buffers[1] == NULL_PTR))
     {
-        Level = (Dio_LevelType)GET_BIT(GPIO_PORTF_DATA_R,ChannelId-40);
+        return DIO_E_PARAM_POINTER;
     }
-    return Level;
+    if ((Pattern->length == 0U) || (Pattern->length > DIO_PATTERN_MAX_LENGTH) || (Pattern->period == 0U))
+    {
+        return DIO_E_PARAM_VALUE;
+    }
+    if (!DIO_PORT_VALID(Pattern->port))
+    {
+        return DIO_E_PARAM_INVALID_PORT_ID;
+    }
+    return DIO_E_OK;
 }
 
-/**
- * @brief Dio_WriteChannel Service to set a level of a channel.
- * 
- * @details Service ID [hex] 0x01
- *          Synchronous/Asynchronous: Synchronous
- *          Reentrancy: Reentrant
- * 
- * @param [in] ChannelId     The channel ID of the DIO channel to be written.
- * @param [in] Level         The value to be written to the specified DIO channel.
- */
-void Dio_WriteChannel (Dio_ChannelType ChannelId,   Dio_LevelType Level){
-    if (ChannelId < 8)
+/* Arms half BufferIndex of the pattern in its control structure (primary for 0, alternate for 1) */
+STATIC void Dio_ArmPatternHalf(uint8 BufferIndex)
+{
+    Dio_DmaControlType * Control = DIO_DMA_CONTROL(DIO_PATTERN_UDMA_CHANNEL, BufferIndex);
+    uint32 Length = Dio_Pattern->length;
+
+    Control->SourceEnd = DIO_RAM_ADDRESS(Dio_Pattern->buffers[BufferIndex], Length) + (Length - 1U);
+    Control->DestinationEnd = DIO_DATA_BITS_ADDRESS(Dio_PortBaseAddress[Dio_Pattern->port], Dio_Pattern->mask);
+    Control->Control = DIO_PATTERN_CHCTL(Length);
+}
+#endif
+
+#if (DIO_CAPTURE_API == STD_ON)
+STATIC const Dio_CaptureType * Dio_Capture = NULL_PTR;  /* Capture running */
+STATIC uint8 Dio_CaptureHalfDone[2];         /* Capture ports that completed each half since it was last notified */
+STATIC boolean Dio_CaptureReleased[2];       /* Halves given back by Dio_ReleaseCaptureHalf */
+STATIC uint32 Dio_CaptureSamples = 0U;       /* Samples notified per port since Dio_StartCapture */
+STATIC uint32 Dio_CaptureOverruns = 0U;      /* Halves lost since Dio_StartCapture */
+
+/* Validates a capture to be started, returns DIO_E_OK or the development error it raises */
+STATIC uint8 Dio_CheckCapture(const Dio_CaptureType * Capture)
+{
+    uint8 Index;
+
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        if (Level == STD_HIGH)
-        {
-            SET_BIT(GPIO_PORTA_DATA_R,ChannelId);
-        }
-        else
-        {
-            CLR_BIT(GPIO_PORTA_DATA_R,ChannelId);
-        }
+        return DIO_E_UNINIT;
+    }
+    if ((Capture == NULL_PTR) || (Capture->buffer == NULL_PTR) || (Capture->ports == NULL_PTR))
+    {
+        return DIO_E_PARAM_POINTER;
     }
-    else if (ChannelId < 16)
+    if ((Capture->port_count == 0U) || (Capture->port_count > DIO_CAPTURE_MAX_PORTS)
+        || (Capture->length < 2U) || (Capture->length > DIO_CAPTURE_MAX_LENGTH) || ((Capture->length & 1U) != 0U)
+        || (Capture->period == 0U))
     {
-        if (Level == STD_HIGH)
+        return DIO_E_PARAM_VALUE;
+    }
+    for (Index = 0U; Index < Capture->port_count; Index++)
+    {
+        if (!DIO_PORT_VALID(Capture->ports[Index]))
         {
-            SET_BIT(GPIO_PORTB_DATA_R,ChannelId-8);
+            return DIO_E_PARAM_INVALID_PORT_ID;
         }
-        else
+    }
+    return DIO_E_OK;
+}
+
+/* Arms half BufferIndex of the ring of capture port Index (uDMA channel 18 + Index) */
+STATIC void Dio_ArmCaptureHalf(uint8 Index, uint8 BufferIndex)
+{
+    Dio_DmaControlType * Control = DIO_DMA_CONTROL(DIO_TIMER_UDMA_CHANNEL(0U, Index), BufferIndex);
+    uint32 Half = (uint32)Dio_Capture->length >> 1U;
+    Dio_PortLevelType * Ring = &Dio_Capture->buffer[((uint32)Index * Dio_Capture->length) + ((uint32)BufferIndex * Half)];
+
+    Control->SourceEnd = Dio_PortBaseAddress[Dio_Capture->ports[Index]] + DIO_DATA_REG_OFFSET;
+    Control->DestinationEnd = DIO_RAM_ADDRESS(Ring, Half) + (Half - 1U);
+    Control->Control = DIO_CAPTURE_CHCTL(Half);
+}
+#endif
+
+/**
+ * @brief Dio_Init is a service that initializes the DIO driver with a configuration set.
+ * 
+ * @details Service ID [hex] 0x10
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ * 
+ * @param [in] ConfigPtr     Pointer to the post-build configuration set.
+ */
+void Dio_Init (const Dio_ConfigType* ConfigPtr){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_INIT_SID, 0U);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (ConfigPtr == NULL_PTR)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID, DIO_E_PARAM_CONFIG);
+        return;
+    }
+    Dio_Groups = ConfigPtr->Groups;
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    Dio_VirtualPorts = ConfigPtr->VirtualPorts;
+#endif
+#endif
+    /* The configuration set is already resolved, every later call is a direct index into it */
+    Dio_Channels = ConfigPtr->Channels;
+    Dio_PortBaseAddress = ConfigPtr->PortBaseAddress;
+    Dio_SyncPortWrites = ConfigPtr->SyncPortWrites;
+    {
+        uint8 PortId;
+
+        /* The ports Port_Init gated off are never accessed, reading their registers would fault */
+        Dio_ClockedPorts = (uint8)(DIO_READ_REG(DIO_PRGPIO_REGISTER_ADDRESS) & ((1UL << DIO_CONFIGURED_PORTS) - 1U));
+        Dio_ClockedPortCount = 0U;
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
         {
-            CLR_BIT(GPIO_PORTB_DATA_R,ChannelId-8);
+            if (DIO_PORT_VALID(PortId))
+            {
+                Dio_ClockedPortIds[Dio_ClockedPortCount] = PortId;
+                Dio_ClockedPortCount++;
+            }
         }
     }
-    else if (ChannelId < 24)
+#if (DIO_OUTPUT_SHADOW == STD_ON)
     {
-        if (Level == STD_HIGH)
-        {
-            SET_BIT(GPIO_PORTC_DATA_R,ChannelId-16);
-        }
-        else
+        uint8 PortId;
+
+        /* Only the pins Port_Init made outputs are kept, their shadow starts from the latch Port_Init wrote */
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
         {
-            CLR_BIT(GPIO_PORTC_DATA_R,ChannelId-16);
+            uint32 Base = ConfigPtr->PortBaseAddress[PortId];
+
+            if (!DIO_PORT_VALID(PortId))
+            {
+                Dio_ShadowPins[PortId] = 0U;
+                Dio_OutputShadow[PortId] = 0U;
+                continue;
+            }
+            Dio_ShadowPins[PortId] = (Dio_PortLevelType)(ConfigPtr->ShadowPins[PortId] & DIO_READ_REG(Base + DIO_DIR_REG_OFFSET));
+            Dio_OutputShadow[PortId] = (Dio_PortLevelType)(DIO_READ_REG(Base + DIO_DATA_REG_OFFSET) & Dio_ShadowPins[PortId]);
         }
     }
-    else if (ChannelId < 32)
+#endif
+#if (DIO_DEBOUNCE_API == STD_ON)
     {
-        if (Level == STD_HIGH)
+        uint8 ChannelId;
+        uint8 Plane;
+
+        /* Spread the depth of every channel over the bit-planes, at the position of its pin in the image */
+        Dio_DebounceFiltered = 0U;
+        for (Plane = 0U; Plane < DIO_DEBOUNCE_COUNTER_BITS; Plane++)
         {
-            SET_BIT(GPIO_PORTD_DATA_R,ChannelId-24);
+            Dio_DebounceReload[Plane] = 0U;
         }
-        else
+        for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
         {
-            CLR_BIT(GPIO_PORTD_DATA_R,ChannelId-24);
+            const Dio_ChannelConfigType * Channel = &ConfigPtr->Channels[ChannelId];
+            Dio_PortsImageType Pin = (Dio_PortsImageType)Channel->mask << ((uint32)Channel->port << 3U);
+            uint32 Reload = ConfigPtr->DebounceDepth[ChannelId];
+
+            if (Reload != 0U)
+            {
+                Reload = ((Reload > (1UL << DIO_DEBOUNCE_COUNTER_BITS)) ? (1UL << DIO_DEBOUNCE_COUNTER_BITS) : Reload) - 1U;
+                Dio_DebounceFiltered |= Pin;
+                for (Plane = 0U; Plane < DIO_DEBOUNCE_COUNTER_BITS; Plane++)
+                {
+                    if (((Reload >> Plane) & 1U) != 0U)
+                    {
+                        Dio_DebounceReload[Plane] |= Pin;
+                    }
+                }
+            }
         }
+        Dio_DebounceSeeded = FALSE;
     }
-    else if (ChannelId < 40)
+#endif
+#if ((DIO_NOTIFICATION_API == STD_ON) || (DIO_CAPTURE_API == STD_ON))
     {
-        if (Level == STD_HIGH)
+        uint8 PortId;
+        uint8 ChannelId;
+
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
         {
-            SET_BIT(GPIO_PORTE_DATA_R,ChannelId-32);
+            Dio_PortChannelPins[PortId] = 0U;
         }
-        else
+        for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
         {
-            CLR_BIT(GPIO_PORTE_DATA_R,ChannelId-32);
+            const Dio_ChannelConfigType * Channel = &ConfigPtr->Channels[ChannelId];
+            Dio_PinChannels[Channel->port][DIO_MSB_INDEX(Channel->mask)] = ChannelId;
+            Dio_PortChannelPins[Channel->port] |= Channel->mask;
         }
     }
-    else if (ChannelId < 48)
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
     {
-        if (Level == STD_HIGH)
+        uint8 PortId;
+        uint8 Pin;
+        uint8 Index;
+
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
         {
-            SET_BIT(GPIO_PORTF_DATA_R,ChannelId-40);
+            for (Pin = 0U; Pin < 8U; Pin++)
+            {
+                Dio_PinNotifications[PortId][Pin] = NULL_PTR;
+            }
         }
-        else
+        for (Index = 0U; Index < DIO_CONFIGURED_NOTIFICATIONS; Index++)
         {
-            CLR_BIT(GPIO_PORTF_DATA_R,ChannelId-40);
+            const Dio_NotificationConfigType * Notification = &ConfigPtr->Notifications[Index];
+            const Dio_ChannelConfigType * Channel = &ConfigPtr->Channels[Notification->channel];
+            uint32 Base = ConfigPtr->PortBaseAddress[Channel->port];
+            Dio_SenseType Sense = Notification->sense;
+
+            if (!DIO_PORT_VALID(Channel->port))
+            {
+                continue;
+            }
+            Pin = DIO_MSB_INDEX(Channel->mask);
+            Dio_PinNotifications[Channel->port][Pin] = Notification->callback;
+
+            /* Masked until Dio_EnableNotification, changing the sense can latch a spurious event */
+            Dio_UpdateRegBits(Base + DIO_INT_MASK_REG_OFFSET, Channel->mask, FALSE);
+            Dio_UpdateRegBits(Base + DIO_INT_SENSE_REG_OFFSET, Channel->mask,
+                              ((Sense == DIO_HIGH_LEVEL) || (Sense == DIO_LOW_LEVEL)) ? TRUE : FALSE);
+            Dio_UpdateRegBits(Base + DIO_INT_BOTH_EDGES_REG_OFFSET, Channel->mask, (Sense == DIO_BOTH_EDGES) ? TRUE : FALSE);
+            Dio_UpdateRegBits(Base + DIO_INT_EVENT_REG_OFFSET, Channel->mask,
+                              ((Sense == DIO_RISING_EDGE) || (Sense == DIO_HIGH_LEVEL)) ? TRUE : FALSE);
+            DIO_WRITE_REG(Base + DIO_INT_CLEAR_REG_OFFSET, Channel->mask);
         }
     }
+#endif
+    Dio_Config = ConfigPtr;
+    Dio_Status = DIO_INITIALIZED;
+}
+
+/**
+ * @brief Returns the configuration set Dio_Init was called with, NULL_PTR before Dio_Init.
+ */
+const Dio_ConfigType* Dio_GetConfig (void){
+    return Dio_Config;
+}
+
+/**
+ * @brief Dio_ReadChannel is a service that returns the value of the specified DIO channel
+ * 
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Reentrant
+ *          
+ * @param [in] ChannelId         The channel ID of the DIO channel to be read.
+ * @return Dio_LevelType    The value of the specified DIO channel.
+ *                             - STD_HIGH The physical level of the corresponding Pin is STD_HIGH
+ *                             - STD_LOW The physical level of the corresponding Pin is STD_LOW
+ */
+Dio_LevelType Dio_ReadChannel ( Dio_ChannelType ChannelId ){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_READ_CHANNEL_SID, ChannelId);
+    const Dio_ChannelConfigType * Channel;
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Two compares, the driver state and the configured channel table, constant channel IDs are also asserted at compile time */
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_UNINIT);
+        return STD_LOW;
+    }
+    else if (!DIO_CHANNEL_VALID(ChannelId))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return STD_LOW;
+    }
+#endif
+    Channel = &Dio_Channels[ChannelId];
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    /* Shadowed outputs are read back from RAM */
+    if ((Dio_ShadowPins[Channel->port] & Channel->mask) != 0U)
+    {
+        return (Dio_LevelType)((Dio_OutputShadow[Channel->port] & Channel->mask) != 0U);
+    }
+#endif
+#if (DIO_BITBAND_ACCESS == STD_ON)
+    return (Dio_LevelType)DIO_READ_REG(Channel->bitband_address);
+#else
+    return (Dio_LevelType)(DIO_READ_REG(Channel->bits_address) != 0U);
+#endif
+}
+
+/**
+ * @brief Dio_WriteChannel Service to set a level of a channel.
+ * 
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Reentrant
+ * 
+ * @param [in] ChannelId     The channel ID of the DIO channel to be written.
+ * @param [in] Level         The value to be written to the specified DIO channel.
+ */
+void Dio_WriteChannel (Dio_ChannelType ChannelId,   Dio_LevelType Level){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID, ChannelId);
+    const Dio_ChannelConfigType * Channel;
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_UNINIT);
+        return;
+    }
+    else if (!DIO_CHANNEL_VALID(ChannelId))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
+    }
+#endif
+    Channel = &Dio_Channels[ChannelId];
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    if ((Dio_ShadowPins[Channel->port] & Channel->mask) != 0U)
+    {
+        Dio_WriteShadowed(Channel->port, Channel->mask, Channel->bits_address, (Level == STD_HIGH) ? Channel->mask : 0U);
+        return;
+    }
+#endif
+#if (DIO_BITBAND_ACCESS == STD_ON)
+    /* Single store to the bit-band alias word of the channel, bit 0 of the word is the level of the pin */
+    DIO_WRITE_REG(Channel->bitband_address, (Level == STD_HIGH) ? 1U : 0U);
+#else
+    /* Single store through the masked aperture, the other pins of the port are not touched */
+    DIO_WRITE_REG(Channel->bits_address, (Level == STD_HIGH) ? Channel->mask : 0U);
+#endif
 }
 
 /**
@@ -144,32 +532,30 @@ void Dio_WriteChannel (Dio_ChannelType ChannelId,   Dio_LevelType Level){
  *                             - STD_LOW The physical level of the corresponding Pin is STD_LOW
  */
 Dio_PortLevelType Dio_ReadPort ( Dio_PortType PortId ){
-    Dio_PortLevelType PortLevel;
-    if (PortId == PORTA)
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_READ_PORT_SID, PortId);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        PortLevel = GPIO_PORTA_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_PORT_SID, DIO_E_UNINIT);
+        return 0U;
     }
-    else if (PortId == PORTB)
+    else if (!DIO_PORT_VALID(PortId))
     {
-        PortLevel = GPIO_PORTB_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return 0U;
     }
-    else if (PortId == PORTC)
+#endif
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    /* A port made of shadowed outputs only is read back from RAM, otherwise the shadowed pins come from RAM */
+    if (Dio_ShadowPins[PortId] == 0xFFU)
     {
-        PortLevel = GPIO_PORTC_DATA_R;
+        return Dio_OutputShadow[PortId];
     }
-    else if (PortId == PORTD)
-    {
-        PortLevel = GPIO_PORTD_DATA_R;
-    }
-    else if (PortId == PORTE)
-    {
-        PortLevel = GPIO_PORTE_DATA_R;
-    }
-    else if (PortId == PORTF)
-    {
-        PortLevel = GPIO_PORTF_DATA_R;
-    }
-    return PortLevel;
+    return (Dio_PortLevelType)((DIO_READ_REG(Dio_PortBaseAddress[PortId] + DIO_DATA_REG_OFFSET) & ~Dio_ShadowPins[PortId])
+                               | Dio_OutputShadow[PortId]);
+#else
+    return (Dio_PortLevelType)DIO_READ_REG(Dio_PortBaseAddress[PortId] + DIO_DATA_REG_OFFSET);
+#endif
 }
 
 /**
@@ -183,30 +569,24 @@ Dio_PortLevelType Dio_ReadPort ( Dio_PortType PortId ){
  * @param [in] Level         The value to be written to the specified DIO port.
  */
 void Dio_WritePort (Dio_PortType PortId,Dio_PortLevelType Level){
-    if (PortId == PORTA)
-    {
-        GPIO_PORTA_DATA_R = Level;
-    }
-    else if (PortId == PORTB)
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_WRITE_PORT_SID, PortId);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        GPIO_PORTB_DATA_R = Level;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+        return;
     }
-    else if (PortId == PORTC)
+    else if (!DIO_PORT_VALID(PortId))
     {
-        GPIO_PORTC_DATA_R = Level;
-    }
-    else if (PortId == PORTD)
-    {
-        GPIO_PORTD_DATA_R = Level;
-    }
-    else if (PortId == PORTE)
-    {
-        GPIO_PORTE_DATA_R = Level;
-    }
-    else if (PortId == PORTF)
-    {
-        GPIO_PORTF_DATA_R = Level;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return;
     }
+#endif
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    Dio_WriteShadowed(PortId, 0xFFU, Dio_PortBaseAddress[PortId] + DIO_DATA_REG_OFFSET, Level);
+#else
+    DIO_WRITE_REG(Dio_PortBaseAddress[PortId] + DIO_DATA_REG_OFFSET, Level);
+#endif
 }
 
 /**
@@ -222,34 +602,39 @@ void Dio_WritePort (Dio_PortType PortId,Dio_PortLevelType Level){
  *                                  - STD_LOW The physical level of the corresponding Pin is STD_LOW
  */
 Dio_PortLevelType Dio_ReadChannelGroup ( const Dio_ChannelGroupType* ChannelGroupIdPtr){
-    Dio_PortLevelType PortLevel;
-    if (ChannelGroupIdPtr->port == PORTA)
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_READ_CHANNEL_GROUP_SID, 0U);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        PortLevel = GPIO_PORTA_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+        return 0U;
     }
-    else if (ChannelGroupIdPtr->port == PORTB)
+    else if (ChannelGroupIdPtr == NULL_PTR)
     {
-        PortLevel = GPIO_PORTB_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+        return 0U;
     }
-    else if (ChannelGroupIdPtr->port == PORTC)
+    /* A pointer outside the configured groups wraps to a large index, so one compare rejects it */
+    else if (Dio_IsConfiguredGroup(ChannelGroupIdPtr) == FALSE)
     {
-        PortLevel = GPIO_PORTC_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+        return 0U;
     }
-    else if (ChannelGroupIdPtr->port == PORTD)
+    else if (!DIO_PORT_VALID(ChannelGroupIdPtr->port))
     {
-        PortLevel = GPIO_PORTD_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return 0U;
     }
-    else if (ChannelGroupIdPtr->port == PORTE)
+#endif
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    /* A group made of shadowed outputs only is read back from RAM */
+    if ((Dio_ShadowPins[ChannelGroupIdPtr->port] & ChannelGroupIdPtr->mask) == ChannelGroupIdPtr->mask)
     {
-        PortLevel = GPIO_PORTE_DATA_R;
+        return (Dio_PortLevelType)((Dio_OutputShadow[ChannelGroupIdPtr->port] & ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset);
     }
-    else if (ChannelGroupIdPtr->port == PORTF)
-    {
-        PortLevel = GPIO_PORTF_DATA_R;
-    }
-    PortLevel = PortLevel & ChannelGroupIdPtr->mask;
-    PortLevel = PortLevel >> ChannelGroupIdPtr->offset;
-    return PortLevel;
+#endif
+    /* One load of the group aperture, the pins outside the group read as 0 */
+    return (Dio_PortLevelType)(DIO_READ_REG(ChannelGroupIdPtr->bits_address) >> ChannelGroupIdPtr->offset);
 }
 
 /**
@@ -263,57 +648,36 @@ Dio_PortLevelType Dio_ReadChannelGroup ( const Dio_ChannelGroupType* ChannelGrou
  * @param [in] Level              The value to be written to the specified DIO channel group.
  */
 void Dio_WriteChannelGroup (const Dio_ChannelGroupType* ChannelGroupIdPtr,Dio_PortLevelType Level){
-    Dio_PortLevelType PortLevel;
-    if (ChannelGroupIdPtr->port == PORTA)
-    {
-        PortLevel = GPIO_PORTA_DATA_R;
-    }
-    else if (ChannelGroupIdPtr->port == PORTB)
-    {
-        PortLevel = GPIO_PORTB_DATA_R;
-    }
-    else if (ChannelGroupIdPtr->port == PORTC)
-    {
-        PortLevel = GPIO_PORTC_DATA_R;
-    }
-    else if (ChannelGroupIdPtr->port == PORTD)
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_WRITE_CHANNEL_GROUP_SID, 0U);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        PortLevel = GPIO_PORTD_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+        return;
     }
-    else if (ChannelGroupIdPtr->port == PORTE)
+    else if (ChannelGroupIdPtr == NULL_PTR)
     {
-        PortLevel = GPIO_PORTE_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+        return;
     }
-    else if (ChannelGroupIdPtr->port == PORTF)
+    else if (Dio_IsConfiguredGroup(ChannelGroupIdPtr) == FALSE)
     {
-        PortLevel = GPIO_PORTF_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+        return;
     }
-    PortLevel = PortLevel & (~ChannelGroupIdPtr->mask);
-    PortLevel = PortLevel | (Level << ChannelGroupIdPtr->offset);
-    if (ChannelGroupIdPtr->port == PORTA)
+    else if (!DIO_PORT_VALID(ChannelGroupIdPtr->port))
     {
-        GPIO_PORTA_DATA_R = PortLevel;
-    }
-    else if (ChannelGroupIdPtr->port == PORTB)
-    {
-        GPIO_PORTB_DATA_R = PortLevel;
-    }
-    else if (ChannelGroupIdPtr->port == PORTC)
-    {
-        GPIO_PORTC_DATA_R = PortLevel;
-    }
-    else if (ChannelGroupIdPtr->port == PORTD)
-    {
-        GPIO_PORTD_DATA_R = PortLevel;
-    }
-    else if (ChannelGroupIdPtr->port == PORTE)
-    {
-        GPIO_PORTE_DATA_R = PortLevel;
-    }
-    else if (ChannelGroupIdPtr->port == PORTF)
-    {
-        GPIO_PORTF_DATA_R = PortLevel;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return;
     }
+#endif
+    /* One store to the group aperture, bits of Level outside the group are dropped */
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    Dio_WriteShadowed(ChannelGroupIdPtr->port, ChannelGroupIdPtr->mask, ChannelGroupIdPtr->bits_address,
+                      ((uint32)Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask);
+#else
+    DIO_WRITE_REG(ChannelGroupIdPtr->bits_address, (uint32)Level << ChannelGroupIdPtr->offset);
+#endif
 }
 
 /**
@@ -326,6 +690,14 @@ void Dio_WriteChannelGroup (const Dio_ChannelGroupType* ChannelGroupIdPtr,Dio_Po
  * @param [out] versioninfo Pointer to where to store the version information of the DIO module.
  */
 void Dio_GetVersionInfo (Std_VersionInfoType* versioninfo){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_GET_VERSION_INFO_SID, 0U);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (versioninfo == NULL_PTR)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+        return;
+    }
+#endif
     versioninfo->vendorID = DIO_VENDOR_ID;
     versioninfo->moduleID = DIO_MODULE_ID;
     versioninfo->sw_major_version = DIO_SW_MAJOR_VERSION;
@@ -341,136 +713,982 @@ void Dio_GetVersionInfo (Std_VersionInfoType* versioninfo){
  *       Reentrancy: Reentrant
  * 
  * @param [in] ChannelId         The channel ID of the DIO channel to be flipped.
- * @return Dio_LevelType    The value of the specified DIO channel.
+ * @return Dio_LevelType    The level of the specified DIO channel after the flip.
  *                            - STD_HIGH The physical level of the corresponding Pin is STD_HIGH
  *                            - STD_LOW The physical level of the corresponding Pin is STD_LOW
  */
 Dio_LevelType Dio_FlipChannel (Dio_ChannelType ChannelId){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_FLIP_CHANNEL_SID, ChannelId);
+    const Dio_ChannelConfigType * Channel;
     Dio_LevelType Level;
-    if (ChannelId < 8)
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+        return STD_LOW;
+    }
+    else if (!DIO_CHANNEL_VALID(ChannelId))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return STD_LOW;
+    }
+#endif
+    Channel = &Dio_Channels[ChannelId];
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    if ((Dio_ShadowPins[Channel->port] & Channel->mask) != 0U)
+    {
+        /* The level to flip comes from the shadow, only the store reaches the bus */
+        uint32 Primask = Dio_SuspendInterrupts();
+        Dio_PortLevelType Shadow = (Dio_PortLevelType)(Dio_OutputShadow[Channel->port] ^ Channel->mask);
+        DIO_WRITE_REG(Channel->bits_address, Shadow & Channel->mask);
+        Dio_OutputShadow[Channel->port] = Shadow;
+        Dio_ResumeInterrupts(Primask);
+        return (Dio_LevelType)((Shadow & Channel->mask) != 0U);
+    }
+#endif
+#if (DIO_FLIP_EXCLUSIVE_ACCESS == STD_ON)
+    uint32 PinLevel;
+    /* Retry when an exception (e.g. an ISR writing the same pin) ran between the load and the store */
+    do
+    {
+        PinLevel = Dio_LoadExclusive(Channel->bits_address) ^ Channel->mask;
+    } while (Dio_StoreExclusive(Channel->bits_address, PinLevel) != 0U);
+    Level = (Dio_LevelType)(PinLevel != 0U);
+#elif (DIO_BITBAND_ACCESS == STD_ON)
+    Level = (Dio_LevelType)(DIO_READ_REG(Channel->bitband_address) ^ STD_HIGH);
+    DIO_WRITE_REG(Channel->bitband_address, Level);
+#else
+    /* One load and one store of the pin aperture, the other pins of the port are not touched */
+    Level = (Dio_LevelType)(DIO_READ_REG(Channel->bits_address) == 0U);
+    DIO_WRITE_REG(Channel->bits_address, (Level == STD_HIGH) ? Channel->mask : 0U);
+#endif
+    return Level;
+}
+
+/**
+ * @brief Dio_MaskedReadChannel is a service that returns the value of the specified DIO channel
+ * 
+ * @details Service ID [hex] 0x13
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] PortId        The port ID of the DIO port to be read.
+ * @param [in] Level         The value of the specified DIO port.
+ * @param [in] Mask          The value of the specified DIO port.
+ */
+void Dio_MaskedWritePort (Dio_PortType PortId,Dio_PortLevelType Level,Dio_PortLevelType Mask){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_MASKED_WRITE_PORT_SID, PortId);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        Level = GPIO_PORTA_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
+        return;
     }
-    else if (ChannelId < 16)
+    else if (!DIO_PORT_VALID(PortId))
     {
-        Level = GPIO_PORTB_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return;
     }
-    else if (ChannelId < 24)
+#endif
+    /* Single store through the aperture masked to Mask, no critical section is needed */
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    Dio_WriteShadowed(PortId, Mask, DIO_DATA_BITS_ADDRESS(Dio_PortBaseAddress[PortId], Mask), Level & Mask);
+#else
+    DIO_WRITE_REG(DIO_DATA_BITS_ADDRESS(Dio_PortBaseAddress[PortId], Mask), Level);
+#endif
+}
+
+/**
+ * @brief Dio_WritePortsSynchronous is a service that writes all the entries of the synchronous port write list back to back.
+ * 
+ * @details Service ID [hex] 0x20
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] Levels        Levels of the entries, Levels[i] is written to the pins of entry i (DioConf_<NAME>_SYNC_INDEX).
+ */
+void Dio_WritePortsSynchronous (const Dio_PortLevelType* Levels){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_WRITE_PORTS_SYNCHRONOUS_SID, 0U);
+    uint32 Address[DIO_CONFIGURED_SYNC_PORT_WRITES];
+    uint32 Value[DIO_CONFIGURED_SYNC_PORT_WRITES];
+    uint32 Primask;
+    uint8 Index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        Level = GPIO_PORTC_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORTS_SYNCHRONOUS_SID, DIO_E_UNINIT);
+        return;
     }
-    else if (ChannelId < 32)
+    else if (Levels == NULL_PTR)
     {
-        Level = GPIO_PORTD_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORTS_SYNCHRONOUS_SID, DIO_E_PARAM_POINTER);
+        return;
     }
-    else if (ChannelId < 40)
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
     {
-        Level = GPIO_PORTE_DATA_R;
+        if (!DIO_PORT_VALID(Dio_SyncPortWrites[Index].port))
+        {
+            Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORTS_SYNCHRONOUS_SID, DIO_E_PARAM_INVALID_PORT_ID);
+            return;
+        }
     }
-    else if (ChannelId < 44)
+#endif
+    /* Everything is loaded before the critical window so only the stores remain inside it */
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
     {
-        Level = GPIO_PORTF_DATA_R;
+        Address[Index] = Dio_SyncPortWrites[Index].bits_address;
+        Value[Index] = Levels[Index];
     }
-    Level = Level & (1 << (ChannelId % 8));
-    if (Level == 0)
+
+    Primask = Dio_SuspendInterrupts();
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
     {
-        Level = 1;
+        DIO_WRITE_REG(Address[Index], Value[Index]);
     }
-    else
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    /* The shadow follows the stores in the same critical window, so the skew between the ports is unchanged */
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
     {
-        Level = 0;
+        const Dio_PortWriteType * Entry = &Dio_SyncPortWrites[Index];
+        Dio_PortLevelType Shadowed = Dio_ShadowPins[Entry->port] & Entry->mask;
+        Dio_OutputShadow[Entry->port] = (Dio_PortLevelType)((Dio_OutputShadow[Entry->port] & ~Shadowed) | (Value[Index] & Shadowed));
     }
-    if (ChannelId < 8)
+#endif
+    Dio_ResumeInterrupts(Primask);
+}
+
+/**
+ * @brief Dio_ReadAllPorts is a service that samples the levels of all the configured ports into one image.
+ * 
+ * @details Service ID [hex] 0x21
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @return Dio_PortsImageType  Levels of all the ports, port PortId in bits [PortId * 8 + 7 : PortId * 8].
+ */
+Dio_PortsImageType Dio_ReadAllPorts (void){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_READ_ALL_PORTS_SID, 0U);
+    uint32 Address[DIO_CONFIGURED_PORTS];
+    uint32 Level[DIO_CONFIGURED_PORTS];
+    Dio_PortsImageType Image = 0U;
+    uint32 Primask;
+    uint8 Index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        GPIO_PORTA_DATA_R = Level;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_ALL_PORTS_SID, DIO_E_UNINIT);
+        return 0U;
     }
-    else if (ChannelId < 16)
+#endif
+    /* Gated off ports read as 0 */
+    for (Index = 0U; Index < Dio_ClockedPortCount; Index++)
     {
-        GPIO_PORTB_DATA_R = Level;
+        Address[Index] = Dio_PortBaseAddress[Dio_ClockedPortIds[Index]] + DIO_DATA_REG_OFFSET;
     }
-    else if (ChannelId < 24)
+
+    /* Only the loads are inside the critical window, so the ports are sampled one load apart */
+    Primask = Dio_SuspendInterrupts();
+    for (Index = 0U; Index < Dio_ClockedPortCount; Index++)
     {
-        GPIO_PORTC_DATA_R = Level;
+        Level[Index] = DIO_READ_REG(Address[Index]);
     }
-    else if (ChannelId < 32)
+    Dio_ResumeInterrupts(Primask);
+
+    for (Index = 0U; Index < Dio_ClockedPortCount; Index++)
     {
-        GPIO_PORTD_DATA_R = Level;
+        Image |= (Dio_PortsImageType)(Level[Index] & 0xFFU) << ((uint32)Dio_ClockedPortIds[Index] << 3U);
     }
-    else if (ChannelId < 40)
+    return Image;
+}
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/**
+ * @brief Dio_CheckOutputShadow is the cyclic service that compares the output shadow with the DATA registers.
+ * 
+ * @details Service ID [hex] 0x2C
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @return Dio_PortsImageType  Mismatching pins, port PortId in bits [PortId * 8 + 7 : PortId * 8], 0 when none.
+ */
+Dio_PortsImageType Dio_CheckOutputShadow (void){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_CHECK_OUTPUT_SHADOW_SID, 0U);
+    Dio_PortsImageType Mismatch = 0U;
+    uint8 PortId;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
     {
-        GPIO_PORTE_DATA_R = Level;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_CHECK_OUTPUT_SHADOW_SID, DIO_E_UNINIT);
+        return 0U;
     }
-    else if (ChannelId < 44)
+#endif
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
     {
-        GPIO_PORTF_DATA_R = Level;
+        Dio_PortLevelType Pins = Dio_ShadowPins[PortId];
+        if (Pins != 0U)
+        {
+            uint32 Address = Dio_PortBaseAddress[PortId] + DIO_DATA_REG_OFFSET;
+            uint32 Primask = Dio_SuspendInterrupts();
+            uint32 Level = DIO_READ_REG(Address);
+            uint32 Shadow = Dio_OutputShadow[PortId];
+            Dio_ResumeInterrupts(Primask);
+
+            Mismatch |= (Dio_PortsImageType)((Level ^ Shadow) & Pins) << ((uint32)PortId << 3U);
+        }
     }
-    return Level;
+    return Mismatch;
 }
+#endif
 
+#if (DIO_SHARED_DMA_API == STD_ON)
 /**
- * @brief Dio_MaskedReadChannel is a service that returns the value of the specified DIO channel
+ * @brief Dio_GetDmaControl is a service that lends one structure of the DIO uDMA control table to a module
+ *        built on DIO, the uDMA controller is clocked and enabled with this table.
  * 
- * @details Service ID [hex] 0x13
+ * @details Service ID [hex] 0x2F
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ * @param [in] Channel              uDMA channel, 0..31.
+ * @param [in] BufferIndex          0 for the primary structure, 1 for the alternate one.
+ * @return Dio_DmaControlType*      Control structure, NULL_PTR for an invalid parameter.
+ */
+Dio_DmaControlType* Dio_GetDmaControl (uint8 Channel, uint8 BufferIndex){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_GET_DMA_CONTROL_SID, Channel);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if ((Channel >= DIO_UDMA_CHANNELS) || (BufferIndex > 1U))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_DMA_CONTROL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return NULL_PTR;
+    }
+#endif
+    /* No timer to clock, the table is (re)installed as the capture and the pattern generator do */
+    Dio_EnableDma(0U);
+    return DIO_DMA_CONTROL(Channel, BufferIndex);
+}
+#endif
+
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+/**
+ * @brief Dio_ReadVirtualPort is a service that returns the word of a virtual port.
+ * 
+ * @details Service ID [hex] 0x2D
  *         Synchronous/Asynchronous: Synchronous
  *      Reentrancy: Reentrant
  * 
- * @param [in] PortId        The port ID of the DIO port to be read.
- * @param [in] Level         The value of the specified DIO port.
- * @param [in] Mask          The value of the specified DIO port.
+ * @param [in] VirtualPortPtr           Pointer to the virtual port to be read.
+ * @return Dio_VirtualPortLevelType     Levels of the pins of the virtual port, bit i is its pin i.
  */
-void Dio_MaskedWritePort (Dio_PortType PortId,Dio_PortLevelType Level,Dio_PortLevelType Mask){
-    Dio_PortLevelType PortLevel;
-    if (PortId == PORTA)
+Dio_VirtualPortLevelType Dio_ReadVirtualPort (const Dio_VirtualPortType* VirtualPortPtr){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_READ_VIRTUAL_PORT_SID, 0U);
+    Dio_VirtualPortLevelType Word = 0U;
+    uint8 Segment = 0U;
+    uint8 Index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_VIRTUAL_PORT_SID, DIO_E_UNINIT);
+        return 0U;
+    }
+    else if (VirtualPortPtr == NULL_PTR)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_VIRTUAL_PORT_SID, DIO_E_PARAM_POINTER);
+        return 0U;
+    }
+    else if (Dio_IsConfiguredVirtualPort(VirtualPortPtr) == FALSE)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_VIRTUAL_PORT_SID, DIO_E_PARAM_INVALID_GROUP);
+        return 0U;
+    }
+    else if (Dio_IsClockedVirtualPort(VirtualPortPtr) == FALSE)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_VIRTUAL_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return 0U;
+    }
+#endif
+    for (Index = 0U; Index < VirtualPortPtr->access_count; Index++)
+    {
+        const Dio_VirtualAccessType * Access = &VirtualPortPtr->accesses[Index];
+        uint32 Level;
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+        /* Pins that are all shadowed outputs are read back from RAM */
+        if ((Dio_ShadowPins[Access->port] & Access->mask) == Access->mask)
+        {
+            Level = Dio_OutputShadow[Access->port];
+        }
+        else
+#endif
+        {
+            Level = DIO_READ_REG(Access->bits_address);
+        }
+        /* Gather: every segment moves its adjoining pins to their word bits */
+        for (; Segment < Access->segment_end; Segment++)
+        {
+            const Dio_VirtualSegmentType * Entry = &VirtualPortPtr->segments[Segment];
+            Word |= ((Level & Entry->mask) << Entry->lshift) >> Entry->rshift;
+        }
+    }
+    return Word;
+}
+
+/**
+ * @brief Dio_WriteVirtualPort is a service that writes the word of a virtual port.
+ * 
+ * @details Service ID [hex] 0x2E
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] VirtualPortPtr  Pointer to the virtual port to be written.
+ * @param [in] Level           Levels of the pins of the virtual port, bit i is its pin i.
+ */
+void Dio_WriteVirtualPort (const Dio_VirtualPortType* VirtualPortPtr, Dio_VirtualPortLevelType Level){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_WRITE_VIRTUAL_PORT_SID, 0U);
+    uint8 Segment = 0U;
+    uint8 Index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_VIRTUAL_PORT_SID, DIO_E_UNINIT);
+        return;
+    }
+    else if (VirtualPortPtr == NULL_PTR)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_VIRTUAL_PORT_SID, DIO_E_PARAM_POINTER);
+        return;
+    }
+    else if (Dio_IsConfiguredVirtualPort(VirtualPortPtr) == FALSE)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_VIRTUAL_PORT_SID, DIO_E_PARAM_INVALID_GROUP);
+        return;
+    }
+    else if (Dio_IsClockedVirtualPort(VirtualPortPtr) == FALSE)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_VIRTUAL_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return;
+    }
+#endif
+    for (Index = 0U; Index < VirtualPortPtr->access_count; Index++)
+    {
+        const Dio_VirtualAccessType * Access = &VirtualPortPtr->accesses[Index];
+        uint32 Value = 0U;
+
+        /* Scatter: every segment moves its word bits back to its pins */
+        for (; Segment < Access->segment_end; Segment++)
+        {
+            const Dio_VirtualSegmentType * Entry = &VirtualPortPtr->segments[Segment];
+            Value |= ((Level << Entry->rshift) >> Entry->lshift) & Entry->mask;
+        }
+        /* One store to the aperture masked to the pins of the virtual port on this port */
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+        Dio_WriteShadowed(Access->port, Access->mask, Access->bits_address, Value);
+#else
+        DIO_WRITE_REG(Access->bits_address, Value);
+#endif
+    }
+}
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/**
+ * @brief Dio_MainFunction is the cyclic service that samples all the ports once and debounces all the channels.
+ * 
+ * @details Service ID [hex] 0x22
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ *         Every pin has a down counter stored vertically, bit b of all the counters in Dio_DebounceCounter[b],
+ *         so all the pins are filtered with a few word operations per bit-plane. A pin whose sample equals
+ *         its debounced level reloads its counter with (depth - 1), a differing pin counts down and toggles
+ *         its debounced level when its counter is already 0.
+ */
+void Dio_MainFunction (void){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_MAIN_FUNCTION_SID, 0U);
+    Dio_PortsImageType Sample;
+    Dio_PortsImageType Delta;
+    Dio_PortsImageType Expired;
+    Dio_PortsImageType Decrement;
+    Dio_PortsImageType Borrow;
+    Dio_PortsImageType Toggle;
+    uint8 Plane;
+
+    if (Dio_Status != DIO_INITIALIZED)
+    {
+        return;
+    }
+
+    Sample = Dio_ReadAllPorts();
+    if (Dio_DebounceSeeded == FALSE)
+    {
+        Dio_DebouncedLevels = Sample;
+        Dio_RisingEdges = 0U;
+        Dio_FallingEdges = 0U;
+        for (Plane = 0U; Plane < DIO_DEBOUNCE_COUNTER_BITS; Plane++)
+        {
+            Dio_DebounceCounter[Plane] = Dio_DebounceReload[Plane];
+        }
+        Dio_DebounceSeeded = TRUE;
+        return;
+    }
+
+    Delta = Sample ^ Dio_DebouncedLevels;
+
+    /* Pins whose counter is 0 */
+    Expired = ~(Dio_PortsImageType)0U;
+    for (Plane = 0U; Plane < DIO_DEBOUNCE_COUNTER_BITS; Plane++)
+    {
+        Expired &= ~Dio_DebounceCounter[Plane];
+    }
+
+    /* Unfiltered pins follow the sample, filtered pins toggle when they differ with an expired counter */
+    Toggle = (Delta & ~Dio_DebounceFiltered) | (Delta & Expired);
+    Decrement = Delta & Dio_DebounceFiltered & ~Expired;
+
+    /* Ripple borrow subtraction of 1 for the Decrement pins, reload for all the other pins */
+    Borrow = Decrement;
+    for (Plane = 0U; Plane < DIO_DEBOUNCE_COUNTER_BITS; Plane++)
+    {
+        Dio_PortsImageType Counter = Dio_DebounceCounter[Plane];
+        Dio_DebounceCounter[Plane] = ((Counter ^ Borrow) & Decrement) | (Dio_DebounceReload[Plane] & ~Decrement);
+        Borrow &= ~Counter;
+    }
+
+    Dio_DebouncedLevels ^= Toggle;
+    Dio_RisingEdges = Toggle & Dio_DebouncedLevels;
+    Dio_FallingEdges = Toggle & ~Dio_DebouncedLevels;
+}
+
+/**
+ * @brief Returns the debounced levels of all the ports, in the layout of Dio_ReadAllPorts.
+ */
+Dio_PortsImageType Dio_GetDebouncedLevels (void){
+    return Dio_DebouncedLevels;
+}
+
+/**
+ * @brief Returns the channels whose debounced level went from STD_LOW to STD_HIGH in the last Dio_MainFunction call.
+ */
+Dio_PortsImageType Dio_GetRisingEdges (void){
+    return Dio_RisingEdges;
+}
+
+/**
+ * @brief Returns the channels whose debounced level went from STD_HIGH to STD_LOW in the last Dio_MainFunction call.
+ */
+Dio_PortsImageType Dio_GetFallingEdges (void){
+    return Dio_FallingEdges;
+}
+#endif
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/**
+ * @brief Dio_EnableNotification is a service that unmasks the interrupt of a channel with a configured notification.
+ * 
+ * @details Service ID [hex] 0x23
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] ChannelId     The channel ID of the DIO channel to be notified.
+ */
+void Dio_EnableNotification (Dio_ChannelType ChannelId){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_ENABLE_NOTIFICATION_SID, ChannelId);
+    const Dio_ChannelConfigType * Channel;
+    uint32 Base;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_ENABLE_NOTIFICATION_SID, DIO_E_UNINIT);
+        return;
+    }
+    else if (!DIO_CHANNEL_VALID(ChannelId))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_ENABLE_NOTIFICATION_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
+    }
+#endif
+    Channel = &Dio_Channels[ChannelId];
+    Base = Dio_PortBaseAddress[Channel->port];
+
+    DIO_WRITE_REG(Base + DIO_INT_CLEAR_REG_OFFSET, Channel->mask);
+    /* Single store to the bit-band alias of the GPIOIM bit, the other pins of the port are not touched */
+    DIO_WRITE_REG(DIO_BITBAND_ADDRESS(Base + DIO_INT_MASK_REG_OFFSET, DIO_MSB_INDEX(Channel->mask)), 1U);
+}
+
+/**
+ * @brief Dio_DisableNotification is a service that masks the interrupt of a channel.
+ * 
+ * @details Service ID [hex] 0x24
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] ChannelId     The channel ID of the DIO channel not to be notified anymore.
+ */
+void Dio_DisableNotification (Dio_ChannelType ChannelId){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_DISABLE_NOTIFICATION_SID, ChannelId);
+    const Dio_ChannelConfigType * Channel;
+    uint32 Base;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_DISABLE_NOTIFICATION_SID, DIO_E_UNINIT);
+        return;
+    }
+    else if (!DIO_CHANNEL_VALID(ChannelId))
     {
-        PortLevel = GPIO_PORTA_DATA_R;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_DISABLE_NOTIFICATION_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
     }
-    else if (PortId == PORTB)
+#endif
+    Channel = &Dio_Channels[ChannelId];
+    Base = Dio_PortBaseAddress[Channel->port];
+
+    DIO_WRITE_REG(DIO_BITBAND_ADDRESS(Base + DIO_INT_MASK_REG_OFFSET, DIO_MSB_INDEX(Channel->mask)), 0U);
+}
+
+/*
+ * Interrupt handling of port PortId: one load of GPIOMIS, one store to GPIOICR acknowledging all the
+ * pending pins, then one callback per pending pin found with CLZ. An edge during the callbacks latches
+ * again and raises a new interrupt, a level sensitive pin keeps interrupting until its level changes
+ * or its notification is disabled.
+ */
+STATIC void Dio_PortIsr(Dio_PortType PortId)
+{
+    uint32 Base = Dio_PortBaseAddress[PortId];
+    uint32 Pending = DIO_READ_REG(Base + DIO_MASKED_INT_STATUS_REG_OFFSET) & 0xFFU;
+
+    DIO_WRITE_REG(Base + DIO_INT_CLEAR_REG_OFFSET, Pending);
+    while (Pending != 0U)
     {
-        PortLevel = GPIO_PORTB_DATA_R;
+        uint8 Pin = DIO_MSB_INDEX(Pending);
+        Dio_NotificationType Callback = Dio_PinNotifications[PortId][Pin];
+
+        Pending &= ~(1UL << Pin);
+        if (Callback != NULL_PTR)
+        {
+            Callback(Dio_PinChannels[PortId][Pin]);
+        }
     }
-    else if (PortId == PORTC)
+}
+
+void Dio_GpioPortA_Isr (void){
+    Dio_PortIsr(PORTA);
+}
+
+void Dio_GpioPortB_Isr (void){
+    Dio_PortIsr(PORTB);
+}
+
+void Dio_GpioPortC_Isr (void){
+    Dio_PortIsr(PORTC);
+}
+
+void Dio_GpioPortD_Isr (void){
+    Dio_PortIsr(PORTD);
+}
+
+void Dio_GpioPortE_Isr (void){
+    Dio_PortIsr(PORTE);
+}
+
+void Dio_GpioPortF_Isr (void){
+    Dio_PortIsr(PORTF);
+}
+#endif
+
+#if (DIO_PATTERN_API == STD_ON)
+/**
+ * @brief Dio_StartPattern is a service that starts streaming a pattern to the pins of a port.
+ * 
+ * @details Service ID [hex] 0x25
+ *         Synchronous/Asynchronous: Asynchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ * @param [in] Pattern         Pattern to be output.
+ * @return Std_ReturnType      E_OK when the pattern was started, E_NOT_OK for an invalid pattern.
+ */
+Std_ReturnType Dio_StartPattern (const Dio_PatternType* Pattern){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_START_PATTERN_SID, 0U);
+    uint32 ChannelBit = 1UL << DIO_PATTERN_UDMA_CHANNEL;
+    uint8 Error = Dio_CheckPattern(Pattern);
+
+    if (Error != DIO_E_OK)
     {
-        PortLevel = GPIO_PORTC_DATA_R;
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_START_PATTERN_SID, Error);
+#endif
+        return E_NOT_OK;
     }
-    else if (PortId == PORTD)
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    /* The uDMA stores would not follow the shadow */
+    if ((Dio_ShadowPins[Pattern->port] & Pattern->mask) != 0U)
     {
-        PortLevel = GPIO_PORTD_DATA_R;
+        return E_NOT_OK;
     }
-    else if (PortId == PORTE)
+#endif
+#if (DIO_CAPTURE_API == STD_ON)
+    /* Timer A of the pattern timer samples capture port 2 * DIO_PATTERN_TIMER */
+    if ((Dio_Capture != NULL_PTR) && (Dio_Capture->port_count > (2U * DIO_PATTERN_TIMER)))
     {
-        PortLevel = GPIO_PORTE_DATA_R;
+        return E_NOT_OK;
     }
-    else if (PortId == PORTF)
+#endif
+    Dio_StopPattern();
+    Dio_Pattern = Pattern;
+
+    Dio_EnableDma(1UL << DIO_PATTERN_TIMER);
+    Dio_SetupDmaChannel(DIO_PATTERN_UDMA_CHANNEL);
+    Dio_ArmPatternHalf(0U);
+    Dio_ArmPatternHalf(1U);
+    DIO_WRITE_REG(DIO_UDMA_CHIS_REGISTER_ADDRESS, ChannelBit);
+    DIO_WRITE_REG(DIO_UDMA_ENASET_REGISTER_ADDRESS, ChannelBit);
+
+    /* Timer A periodic, every timeout requests one transfer, the completion of a half interrupts on timer A */
+    DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_CTL_REG_OFFSET, 0U);
+    DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_CFG_REG_OFFSET, TIMER_CFG_32_BIT_TIMER);
+    DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_TAMR_REG_OFFSET, TIMER_TAMR_TAMR_PERIOD);
+    DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_TAILR_REG_OFFSET, Pattern->period - 1U);
+    DIO_WRITE_REG(DIO_NVIC_EN0_REGISTER_ADDRESS, 1UL << DIO_PATTERN_TIMER_IRQ);
+    DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_CTL_REG_OFFSET, TIMER_CTL_TAEN);
+    return E_OK;
+}
+
+/**
+ * @brief Dio_StopPattern is a service that stops the pattern output, the pins keep their last level.
+ * 
+ * @details Service ID [hex] 0x26
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ */
+void Dio_StopPattern (void){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_STOP_PATTERN_SID, 0U);
+    if (Dio_Pattern != NULL_PTR)
     {
-        PortLevel = GPIO_PORTF_DATA_R;
+        DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_CTL_REG_OFFSET, 0U);
+        DIO_WRITE_REG(DIO_UDMA_ENACLR_REGISTER_ADDRESS, 1UL << DIO_PATTERN_UDMA_CHANNEL);
+        Dio_Pattern = NULL_PTR;
     }
-    PortLevel = PortLevel & (~Mask);
-    PortLevel = PortLevel | (Level & Mask);
-    if (PortId == PORTA)
+}
+
+/*
+ * Called once per finished half, not per sample: the finished control structure reads back with the stop
+ * mode, it is handed to the application for refilling and armed again while the uDMA outputs the other half.
+ */
+void Dio_PatternTimer_Isr (void){
+    uint32 ChannelBit = 1UL << DIO_PATTERN_UDMA_CHANNEL;
+    uint8 BufferIndex;
+
+    DIO_WRITE_REG(DIO_PATTERN_TIMER_BASE_ADDRESS + DIO_TIMER_ICR_REG_OFFSET, TIMER_ICR_TATOCINT);
+    if ((DIO_READ_REG(DIO_UDMA_CHIS_REGISTER_ADDRESS) & ChannelBit) == 0U)
     {
-        GPIO_PORTA_DATA_R = PortLevel;
+        return;
     }
-    else if (PortId == PORTB)
+    DIO_WRITE_REG(DIO_UDMA_CHIS_REGISTER_ADDRESS, ChannelBit);
+    if (Dio_Pattern == NULL_PTR)
     {
-        GPIO_PORTB_DATA_R = PortLevel;
+        return;
     }
-    else if (PortId == PORTC)
+    for (BufferIndex = 0U; BufferIndex < 2U; BufferIndex++)
     {
-        GPIO_PORTC_DATA_R = PortLevel;
+        const Dio_DmaControlType * Control = DIO_DMA_CONTROL(DIO_PATTERN_UDMA_CHANNEL, BufferIndex);
+        if ((Control->Control & UDMA_CHCTL_XFERMODE_M) == UDMA_CHCTL_XFERMODE_STOP)
+        {
+            if (Dio_Pattern->notification != NULL_PTR)
+            {
+                Dio_Pattern->notification(BufferIndex);
+            }
+            Dio_ArmPatternHalf(BufferIndex);
+        }
     }
-    else if (PortId == PORTD)
+    /* Both halves ran out before the ISR (underrun) disables the channel, enable it again */
+    DIO_WRITE_REG(DIO_UDMA_ENASET_REGISTER_ADDRESS, ChannelBit);
+}
+#endif
+
+#if (DIO_CAPTURE_API == STD_ON)
+/**
+ * @brief Dio_StartCapture is a service that starts sampling whole ports into ring buffers.
+ * 
+ * @details Service ID [hex] 0x27
+ *         Synchronous/Asynchronous: Asynchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ * @param [in] Capture         Capture to be started.
+ * @return Std_ReturnType      E_OK when the capture was started, E_NOT_OK for an invalid capture or when one
+ *                             of its timers paces the running pattern.
+ */
+Std_ReturnType Dio_StartCapture (const Dio_CaptureType* Capture){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_START_CAPTURE_SID, 0U);
+    uint32 Slots;
+    uint32 Timers;
+    uint8 Index;
+    uint8 Error = Dio_CheckCapture(Capture);
+
+    if (Error != DIO_E_OK)
+    {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_START_CAPTURE_SID, Error);
+#endif
+        return E_NOT_OK;
+    }
+#if (DIO_PATTERN_API == STD_ON)
+    if ((Dio_Pattern != NULL_PTR) && (Capture->port_count > (2U * DIO_PATTERN_TIMER)))
+    {
+        return E_NOT_OK;
+    }
+#endif
+    Dio_StopCapture();
+    Dio_Capture = Capture;
+    Dio_CaptureHalfDone[0] = 0U;
+    Dio_CaptureHalfDone[1] = 0U;
+    Dio_CaptureReleased[0] = TRUE;
+    Dio_CaptureReleased[1] = TRUE;
+    Dio_CaptureSamples = 0U;
+    Dio_CaptureOverruns = 0U;
+
+    /* Port i is slot i: half i % 2 of timer i / 2, uDMA channel 18 + i and IRQ 19 + i */
+    Slots = (1UL << Capture->port_count) - 1U;
+    Timers = (1UL << ((Capture->port_count + 1U) >> 1U)) - 1U;
+    Dio_EnableDma(Timers);
+    for (Index = 0U; Index < Capture->port_count; Index++)
+    {
+        Dio_SetupDmaChannel(DIO_TIMER_UDMA_CHANNEL(0U, Index));
+        Dio_ArmCaptureHalf(Index, 0U);
+        Dio_ArmCaptureHalf(Index, 1U);
+    }
+    DIO_WRITE_REG(DIO_UDMA_CHIS_REGISTER_ADDRESS, Slots << DIO_TIMER_UDMA_CHANNEL(0U, 0U));
+    DIO_WRITE_REG(DIO_UDMA_ENASET_REGISTER_ADDRESS, Slots << DIO_TIMER_UDMA_CHANNEL(0U, 0U));
+
+    /* Every half periodic in 16-bit mode, enabled then restarted together through GPTMSYNC */
+    for (Index = 0U; Index < Capture->port_count; Index += 2U)
     {
-        GPIO_PORTD_DATA_R = PortLevel;
+        uint32 Base = DIO_TIMER_BASE_ADDRESS(Index >> 1U);
+        uint32 Enable = TIMER_CTL_TAEN;
+
+        DIO_WRITE_REG(Base + DIO_TIMER_CTL_REG_OFFSET, 0U);
+        DIO_WRITE_REG(Base + DIO_TIMER_CFG_REG_OFFSET, TIMER_CFG_16_BIT);
+        DIO_WRITE_REG(Base + DIO_TIMER_TAMR_REG_OFFSET, TIMER_TAMR_TAMR_PERIOD);
+        DIO_WRITE_REG(Base + DIO_TIMER_TAILR_REG_OFFSET, (uint32)Capture->period - 1U);
+        if ((Index + 1U) < Capture->port_count)
+        {
+            DIO_WRITE_REG(Base + DIO_TIMER_TBMR_REG_OFFSET, TIMER_TBMR_TBMR_PERIOD);
+            DIO_WRITE_REG(Base + DIO_TIMER_TBILR_REG_OFFSET, (uint32)Capture->period - 1U);
+            Enable |= TIMER_CTL_TBEN;
+        }
+        DIO_WRITE_REG(DIO_NVIC_EN0_REGISTER_ADDRESS, ((Enable == TIMER_CTL_TAEN) ? 1UL : 3UL) << DIO_TIMER_IRQ(0U, Index));
+        DIO_WRITE_REG(Base + DIO_TIMER_CTL_REG_OFFSET, Enable);
     }
-    else if (PortId == PORTE)
+    DIO_WRITE_REG(DIO_TIMER_BASE_ADDRESS(0U) + DIO_TIMER_SYNC_REG_OFFSET, Slots);
+    return E_OK;
+}
+
+/**
+ * @brief Dio_StopCapture is a service that stops the running capture.
+ * 
+ * @details Service ID [hex] 0x28
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ */
+void Dio_StopCapture (void){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_STOP_CAPTURE_SID, 0U);
+    if (Dio_Capture != NULL_PTR)
     {
-        GPIO_PORTE_DATA_R = PortLevel;
+        uint8 Index;
+        for (Index = 0U; Index < Dio_Capture->port_count; Index += 2U)
+        {
+            DIO_WRITE_REG(DIO_TIMER_BASE_ADDRESS(Index >> 1U) + DIO_TIMER_CTL_REG_OFFSET, 0U);
+        }
+        DIO_WRITE_REG(DIO_UDMA_ENACLR_REGISTER_ADDRESS,
+                      ((1UL << Dio_Capture->port_count) - 1U) << DIO_TIMER_UDMA_CHANNEL(0U, 0U));
+        Dio_Capture = NULL_PTR;
     }
-    else if (PortId == PORTF)
+}
+
+/**
+ * @brief Dio_ReleaseCaptureHalf is a service that gives a notified half of the rings back to the uDMA.
+ * 
+ * @details Service ID [hex] 0x29
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ * @param [in] HalfIndex       Half (0 or 1) the application is done with.
+ */
+void Dio_ReleaseCaptureHalf (uint8 HalfIndex){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_RELEASE_CAPTURE_HALF_SID, HalfIndex);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (HalfIndex > 1U)
     {
-        GPIO_PORTF_DATA_R = PortLevel;
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_RELEASE_CAPTURE_HALF_SID, DIO_E_PARAM_VALUE);
+        return;
     }
+#endif
+    Dio_CaptureReleased[HalfIndex & 1U] = TRUE;
 }
 
+/**
+ * @brief Dio_GetCaptureStatus is a service that returns the progress of the running capture.
+ * 
+ * @details Service ID [hex] 0x2A
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [out] Status         Samples notified and overruns since Dio_StartCapture.
+ */
+void Dio_GetCaptureStatus (Dio_CaptureStatusType* Status){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_GET_CAPTURE_STATUS_SID, 0U);
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Status == NULL_PTR)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_CAPTURE_STATUS_SID, DIO_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    Status->samples = Dio_CaptureSamples;
+    Status->overruns = Dio_CaptureOverruns;
+}
 
+/**
+ * @brief Dio_DecodeCaptureEdges is a service that turns the samples of one port into channel edges.
+ * 
+ * @details Service ID [hex] 0x2B
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] Samples         Samples of the port, for example one half of its capture ring.
+ * @param [in] Count           Number of samples.
+ * @param [in] PortId          Port the samples were taken from.
+ * @param [in] FirstSample     Index of Samples[0], used for the edge timestamps.
+ * @param [inout] Level        Level of the port before Samples[0], updated to the level after the last sample decoded.
+ * @param [out] Edges          Decoded edges, in sample order.
+ * @param [in] MaxEdges        Capacity of Edges.
+ * @return uint32              Number of edges written to Edges.
+ */
+uint32 Dio_DecodeCaptureEdges (const Dio_PortLevelType* Samples, uint32 Count, Dio_PortType PortId,
+                               uint32 FirstSample, Dio_PortLevelType* Level,
+                               Dio_CaptureEdgeType* Edges, uint32 MaxEdges){
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_DECODE_CAPTURE_EDGES_SID, PortId);
+    Dio_PortLevelType Pins;
+    Dio_PortLevelType Previous;
+    uint32 EdgeCount = 0U;
+    uint32 Index;
 
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (Dio_Status == DIO_NOT_INITIALIZED)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_DECODE_CAPTURE_EDGES_SID, DIO_E_UNINIT);
+        return 0U;
+    }
+    else if ((Samples == NULL_PTR) || (Level == NULL_PTR) || (Edges == NULL_PTR))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_DECODE_CAPTURE_EDGES_SID, DIO_E_PARAM_POINTER);
+        return 0U;
+    }
+    else if (PortId >= DIO_CONFIGURED_PORTS)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_DECODE_CAPTURE_EDGES_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        return 0U;
+    }
+#endif
+    Pins = Dio_PortChannelPins[PortId];
+    Previous = *Level;
+    for (Index = 0U; Index < Count; Index++)
+    {
+        Dio_PortLevelType Sample = Samples[Index];
+        uint32 Changed = (uint32)(Sample ^ Previous) & Pins;
+
+        /* Most samples carry no edge, they cost one compare */
+        if (Changed != 0U)
+        {
+            if ((EdgeCount + (uint32)__builtin_popcount(Changed)) > MaxEdges)
+            {
+                break;
+            }
+            do
+            {
+                uint8 Pin = DIO_MSB_INDEX(Changed);
+                Edges[EdgeCount].sample = FirstSample + Index;
+                Edges[EdgeCount].channel = Dio_PinChannels[PortId][Pin];
+                Edges[EdgeCount].level = (Dio_LevelType)((Sample >> Pin) & 1U);
+                EdgeCount++;
+                Changed &= ~(1UL << Pin);
+            } while (Changed != 0U);
+        }
+        Previous = Sample;
+    }
+    *Level = Previous;
+    return EdgeCount;
+}
+
+/*
+ * Every slot interrupts on its own timer IRQ when one of its halves is filled, the ISR handles all the slots
+ * pending at once and notifies a half only when every slot is done with it, so all the ports are aligned.
+ */
+void Dio_CaptureTimer_Isr (void){
+    uint32 First = DIO_TIMER_UDMA_CHANNEL(0U, 0U);
+    uint32 Pending;
+    uint8 Index;
+    uint8 BufferIndex;
+
+    if (Dio_Capture == NULL_PTR)
+    {
+        return;
+    }
+    Pending = (DIO_READ_REG(DIO_UDMA_CHIS_REGISTER_ADDRESS) >> First) & ((1UL << Dio_Capture->port_count) - 1U);
+    if (Pending == 0U)
+    {
+        return;
+    }
+    DIO_WRITE_REG(DIO_UDMA_CHIS_REGISTER_ADDRESS, Pending << First);
+
+    for (Index = 0U; Index < Dio_Capture->port_count; Index++)
+    {
+        if (((Pending >> Index) & 1U) != 0U)
+        {
+            DIO_WRITE_REG(DIO_TIMER_BASE_ADDRESS(Index >> 1U) + DIO_TIMER_ICR_REG_OFFSET,
+                          ((Index & 1U) == 0U) ? TIMER_ICR_TATOCINT : TIMER_ICR_TBTOCINT);
+            for (BufferIndex = 0U; BufferIndex < 2U; BufferIndex++)
+            {
+                const Dio_DmaControlType * Control = DIO_DMA_CONTROL(First + Index, BufferIndex);
+                if ((Control->Control & UDMA_CHCTL_XFERMODE_M) == UDMA_CHCTL_XFERMODE_STOP)
+                {
+                    Dio_CaptureHalfDone[BufferIndex] |= (uint8)(1U << Index);
+                    Dio_ArmCaptureHalf(Index, BufferIndex);
+                }
+            }
+            /* Both halves filled before the ISR disables the channel, samples were lost meanwhile */
+            if ((DIO_READ_REG(DIO_UDMA_ENASET_REGISTER_ADDRESS) & (1UL << (First + Index))) == 0U)
+            {
+                Dio_CaptureOverruns++;
+                DIO_WRITE_REG(DIO_UDMA_ENASET_REGISTER_ADDRESS, 1UL << (First + Index));
+            }
+        }
+    }
+
+    for (BufferIndex = 0U; BufferIndex < 2U; BufferIndex++)
+    {
+        if (Dio_CaptureHalfDone[BufferIndex] == (uint8)((1U << Dio_Capture->port_count) - 1U))
+        {
+            uint32 FirstSample = Dio_CaptureSamples;
+
+            Dio_CaptureHalfDone[BufferIndex] = 0U;
+            /* The uDMA now fills the other half, it was still held by the application */
+            if (Dio_CaptureReleased[BufferIndex ^ 1U] == FALSE)
+            {
+                Dio_CaptureOverruns++;
+            }
+            Dio_CaptureReleased[BufferIndex] = FALSE;
+            Dio_CaptureSamples += (uint32)Dio_Capture->length >> 1U;
+            if (Dio_Capture->notification != NULL_PTR)
+            {
+                Dio_Capture->notification(BufferIndex, FirstSample);
+            }
+        }
+    }
+}
+#endif
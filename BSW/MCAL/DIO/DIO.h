@@ -22,8 +22,8 @@
  * AUTOSAR Version 4.6.0
  */
 #define DIO_AR_RELEASE_MAJOR_VERSION   (4U)
-#define DIO_AR_RELEASE_MINOR_VERSION   (0U)
-#define DIO_AR_RELEASE_PATCH_VERSION   (3U)
+#define DIO_AR_RELEASE_MINOR_VERSION   (6U)
+#define DIO_AR_RELEASE_PATCH_VERSION   (0U)
 
 /*
  * Macros for Dio Status
@@ -43,6 +43,18 @@
 
 
 #include "../Std_types.h"
+#include "Dio_Cfg.h"
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#include "../Det/Det.h"
+
+/* AUTOSAR checking between Det and Dio Modules */
+#if ((DET_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
+ ||  (DET_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION)\
+ ||  (DET_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+#endif
 
 /* AUTOSAR checking between Std Types and Dio Modules */
 #if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
@@ -84,23 +96,202 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO write Ports Synchronous */
+#define DIO_WRITE_PORTS_SYNCHRONOUS_SID (uint8)0x20
+
+/* Service ID for DIO read All Ports */
+#define DIO_READ_ALL_PORTS_SID         (uint8)0x21
+
+/* Service ID for DIO Main Function */
+#define DIO_MAIN_FUNCTION_SID          (uint8)0x22
+
+/* Service ID for DIO enable Notification */
+#define DIO_ENABLE_NOTIFICATION_SID    (uint8)0x23
+
+/* Service ID for DIO disable Notification */
+#define DIO_DISABLE_NOTIFICATION_SID   (uint8)0x24
+
+/* Service ID for DIO start Pattern */
+#define DIO_START_PATTERN_SID          (uint8)0x25
+
+/* Service ID for DIO stop Pattern */
+#define DIO_STOP_PATTERN_SID           (uint8)0x26
+
+/* Service ID for DIO start Capture */
+#define DIO_START_CAPTURE_SID          (uint8)0x27
+
+/* Service ID for DIO stop Capture */
+#define DIO_STOP_CAPTURE_SID           (uint8)0x28
+
+/* Service ID for DIO release Capture Half */
+#define DIO_RELEASE_CAPTURE_HALF_SID   (uint8)0x29
+
+/* Service ID for DIO get Capture Status */
+#define DIO_GET_CAPTURE_STATUS_SID     (uint8)0x2A
+
+/* Service ID for DIO decode Capture Edges */
+#define DIO_DECODE_CAPTURE_EDGES_SID   (uint8)0x2B
+
+/* Service ID for DIO masked write Port */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
+/* Service ID for DIO check Output Shadow */
+#define DIO_CHECK_OUTPUT_SHADOW_SID    (uint8)0x2C
+
+/* Service ID for DIO Read Virtual Port */
+#define DIO_READ_VIRTUAL_PORT_SID      (uint8)0x2D
+
+/* Service ID for DIO Write Virtual Port */
+#define DIO_WRITE_VIRTUAL_PORT_SID     (uint8)0x2E
+
+/* Service ID for DIO Get Dma Control */
+#define DIO_GET_DMA_CONTROL_SID        (uint8)0x2F
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report an invalid channel ID */
+#define DIO_E_PARAM_INVALID_CHANNEL_ID (uint8)0x0A
+
+/* DET code to report Dio_Init called with a Null Pointer */
+#define DIO_E_PARAM_CONFIG             (uint8)0x10
+
+/* DET code to report an invalid port ID */
+#define DIO_E_PARAM_INVALID_PORT_ID    (uint8)0x14
+
+/* DET code to report a channel group (or virtual port) pointer that is not a configured one */
+#define DIO_E_PARAM_INVALID_GROUP      (uint8)0x1F
+
+/* DET code to report APIs called with a Null Pointer */
+#define DIO_E_PARAM_POINTER            (uint8)0x20
+
+/* DET code to report a service called before Dio_Init */
+#define DIO_E_UNINIT                   (uint8)0x21
+
+/* DET code to report an invalid length, period or half index of the pattern and capture services */
+#define DIO_E_PARAM_VALUE              (uint8)0x22
+
 
 
 /*
- *  PORT IDs
+ *  PORT IDs, same text as in Port_Cfg.h so both headers can be included together
  */
-#define PORTA       0
-#define PORTB       1
-#define PORTC       2
-#define PORTD       3
-#define PORTE       4
-#define PORTF       5
+#define PORTA       (0U)
+#define PORTB       (1U)
+#define PORTC       (2U)
+#define PORTD       (3U)
+#define PORTE       (4U)
+#define PORTF       (5U)
 
 typedef uint8  Dio_ChannelType;    /**< DIO Channel Type */
 typedef uint8  Dio_PortType;       /**< DIO Port Type */
 typedef uint8  Dio_LevelType;      /**< DIO Level Type Range [ 0x00 Physical state 0V, 0x01 Physical state 5V or 3.3V ] */
 typedef uint8  Dio_PortLevelType;  /**< If the µC owns ports of different port widths (e.g. 4, 8,16...Bit) Dio_PortLevelType inherits the size of the largest port. */
 typedef uint8  Dio_PortLevelType;  /**< DIO Port Level Type */
+typedef uint64 Dio_PortsImageType; /**< Levels of all the ports, port PortId occupies bits [PortId * 8 + 7 : PortId * 8] */
+
+/* Enum to hold the condition that raises the notification of a channel */
+typedef enum
+{
+    DIO_RISING_EDGE,        //!< 0x00 Notify on a low to high transition.
+    DIO_FALLING_EDGE,       //!< 0x01 Notify on a high to low transition.
+    DIO_BOTH_EDGES,         //!< 0x02 Notify on any transition.
+    DIO_HIGH_LEVEL,         //!< 0x03 Notify while the level is high.
+    DIO_LOW_LEVEL           //!< 0x04 Notify while the level is low.
+}Dio_SenseType;
+
+/* Notification callback of a channel, called from the port ISR with the channel ID */
+typedef void (*Dio_NotificationType)(Dio_ChannelType ChannelId);
+
+/**
+ * @brief Configuration of one channel notification.
+ * 
+ */
+typedef struct
+{
+    Dio_NotificationType callback;  // Function called from the port ISR.
+    Dio_ChannelType channel;        // Channel monitored.
+    Dio_SenseType sense;            // Condition raising the notification.
+}Dio_NotificationConfigType;
+
+/* Maximum number of samples of one half of a pattern (one uDMA transfer) */
+#define DIO_PATTERN_MAX_LENGTH         (1024U)
+
+/* Pattern refill callback, called from the timer ISR with the index (0 or 1) of the half that was just output */
+typedef void (*Dio_PatternNotificationType)(uint8 BufferIndex);
+
+/**
+ * @brief Output pattern streamed to the pins of one port by the uDMA, paced by the pattern timer.
+ * 
+ */
+typedef struct
+{
+    const Dio_PortLevelType * buffers[2];      // Ping-pong halves, output one after the other in a loop.
+    uint16 length;                             // Number of samples of each half, 1..DIO_PATTERN_MAX_LENGTH.
+    uint32 period;                             // System clocks between two samples.
+    Dio_PatternNotificationType notification;  // Called when a half may be refilled, NULL_PTR to repeat the halves as they are.
+    Dio_PortType port;                         // Port written.
+    Dio_PortLevelType mask;                    // Pins of the port written, the other pins are not touched.
+}Dio_PatternType;
+
+/* Maximum number of ports sampled by one capture, each one is paced by its own 16-bit timer half */
+#define DIO_CAPTURE_MAX_PORTS          (6U)
+
+/* Maximum number of samples of the ring of one port, each half is one uDMA transfer of at most 1024 items */
+#define DIO_CAPTURE_MAX_LENGTH         (2048U)
+
+/* Capture callback, called from the timer ISR with the half (0 or 1) just filled on every port and the
+   index, counted from Dio_StartCapture, of its first sample */
+typedef void (*Dio_CaptureNotificationType)(uint8 HalfIndex, uint32 FirstSample);
+
+/**
+ * @brief Logic capture of whole ports into ring buffers by the uDMA, paced by the capture timers.
+ * 
+ */
+typedef struct
+{
+    Dio_PortLevelType * buffer;                // Rings of all the ports, port ports[i] fills buffer[i * length] .. buffer[i * length + length - 1].
+    const Dio_PortType * ports;                // Ports sampled.
+    uint8 port_count;                          // Number of ports sampled, 1..DIO_CAPTURE_MAX_PORTS.
+    uint16 length;                             // Samples of the ring of each port, even, 2..DIO_CAPTURE_MAX_LENGTH.
+    uint16 period;                             // System clocks between two samples, 1..65535.
+    Dio_CaptureNotificationType notification;  // Called when a half of every ring is filled, NULL_PTR for none.
+}Dio_CaptureType;
+
+/**
+ * @brief Progress of the running capture.
+ * 
+ */
+typedef struct
+{
+    uint32 samples;   // Samples of each port notified since Dio_StartCapture.
+    uint32 overruns;  // Halves overwritten before their release or samples lost to a stopped uDMA channel.
+}Dio_CaptureStatusType;
+
+#if ((DIO_PATTERN_API == STD_ON) || (DIO_CAPTURE_API == STD_ON) || (DIO_SHARED_DMA_API == STD_ON))
+/**
+ * @brief One channel control structure of the uDMA control table.
+ * 
+ */
+typedef struct
+{
+    volatile uint32 SourceEnd;       // Address of the last source item.
+    volatile uint32 DestinationEnd;  // Address of the last destination item.
+    volatile uint32 Control;         // Control word, the mode reads back as stop once the transfer is done.
+    uint32 Reserved;
+}Dio_DmaControlType;
+#endif
+
+/**
+ * @brief One edge decoded from captured samples.
+ * 
+ */
+typedef struct
+{
+    uint32 sample;            // Index of the first sample at the new level.
+    Dio_ChannelType channel;  // Channel that changed.
+    Dio_LevelType level;      // New level of the channel.
+}Dio_CaptureEdgeType;
 
 /**
  * @brief Type for the definition of a channel group, which consists of several adjoining channels within a port.
@@ -108,11 +299,143 @@ typedef uint8  Dio_PortLevelType;  /**< DIO Port Level Type */
  */
 typedef struct 
 {
+    uint32 bits_address; // Address of the DATA register aperture masked to the group pins, resolved at configuration time.
     uint8  mask;      // This element mask which defines the positions of the channel group.
     uint8  offset;     // This element shall be the position of the Channel Group on the port, counted from the LSB.
     Dio_PortType port;  // This shall be the port on which the Channel group is defined
 }Dio_ChannelGroupType; 
 
+/**
+ * @brief Resolved description of one DIO channel, so any channel is reached with one indexed load.
+ * 
+ */
+typedef struct
+{
+    uint32 bits_address;  // Address of the DATA register aperture masked to the channel pin only.
+#if (DIO_BITBAND_ACCESS == STD_ON)
+    uint32 bitband_address; // Address of the bit-band alias word of the channel pin in the DATA register.
+#endif
+    uint8  mask;          // Bit mask of the channel inside its port.
+    Dio_PortType port;    // Port on which the channel is defined.
+}Dio_ChannelConfigType;
+
+/**
+ * @brief One entry of the synchronous port write list: the pins mask of port, resolved at configuration time.
+ * 
+ */
+typedef struct
+{
+    uint32 bits_address;     // Address of the DATA register aperture masked to the entry pins.
+    Dio_PortLevelType mask;  // Pins of the port written by the entry.
+    Dio_PortType port;       // Port written by the entry.
+}Dio_PortWriteType;
+
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+typedef uint32 Dio_VirtualPortLevelType;  /**< Word of a virtual port, bit 0 is its first pin */
+
+/**
+ * @brief One step of the bit gather/scatter of a virtual port: pins of one physical port that carry adjoining
+ *        bits of the word, moved to their bits by a left then a right shift (one of the two is 0).
+ * 
+ */
+typedef struct
+{
+    Dio_PortLevelType mask;  // Pins of the segment.
+    uint8 lshift;            // Word bit of the lowest pin minus the pin, when positive.
+    uint8 rshift;            // Pin minus the word bit of the lowest pin, when positive.
+}Dio_VirtualSegmentType;
+
+/**
+ * @brief Access of a virtual port to one physical port, one load or store of the aperture masked to its pins.
+ * 
+ */
+typedef struct
+{
+    uint32 bits_address;     // Address of the DATA register aperture masked to the pins of the virtual port on the port.
+    Dio_PortLevelType mask;  // Pins of the virtual port on the port (all the segments of the access).
+    Dio_PortType port;       // Port accessed.
+    uint8 segment_end;       // One past the last segment of the access, its segments follow the ones of the previous access.
+}Dio_VirtualAccessType;
+
+/**
+ * @brief Definition of a virtual port: a word whose bits are pins of several ports, read or written with one
+ *        access per port.
+ * 
+ */
+typedef struct
+{
+    Dio_VirtualAccessType accesses[DIO_VIRTUAL_PORT_MAX_ACCESSES];
+    Dio_VirtualSegmentType segments[DIO_VIRTUAL_PORT_MAX_SEGMENTS];
+    uint8 access_count;
+}Dio_VirtualPortType;
+#endif
+
+/* Definition of the post-build configuration structure used by Dio_Init.
+ * Member Channels holds the resolved channels indexed by the (symbolic) channel ID.
+ * Member PortBaseAddress holds the GPIO base address of each port indexed by the port ID.
+ * Member Groups holds the resolved channel groups indexed by the DioConf_<NAME>_GROUP_INDEX symbols.
+ * Member SyncPortWrites holds the resolved (port, mask) entries written by Dio_WritePortsSynchronous.
+ * Member DebounceDepth holds the filter depth of each channel used by Dio_MainFunction, indexed by the channel ID.
+ * Member Notifications holds the channel notifications indexed by the DioConf_<NAME>_NOTIFICATION_INDEX symbols.
+ * Member ShadowPins holds the output pins of each port kept in the RAM shadow, indexed by the port ID.
+ * Member VirtualPorts holds the virtual ports indexed by the DioConf_<NAME>_VPORT_INDEX symbols.
+ */
+typedef struct
+{
+    Dio_ChannelConfigType Channels[DIO_CONFIGURED_CHANNELS];
+    uint32 PortBaseAddress[DIO_CONFIGURED_PORTS];
+    Dio_ChannelGroupType Groups[DIO_CONFIGURED_GROUPS];
+    Dio_PortWriteType SyncPortWrites[DIO_CONFIGURED_SYNC_PORT_WRITES];
+#if (DIO_DEBOUNCE_API == STD_ON)
+    uint8 DebounceDepth[DIO_CONFIGURED_CHANNELS];
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
+    Dio_NotificationConfigType Notifications[DIO_CONFIGURED_NOTIFICATIONS];
+#endif
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    Dio_PortLevelType ShadowPins[DIO_CONFIGURED_PORTS];
+#endif
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    Dio_VirtualPortType VirtualPorts[DIO_CONFIGURED_VIRTUAL_PORTS];
+#endif
+}Dio_ConfigType;
+
+/* Pointers to the channel groups of the configuration set given to Dio_Init, to be passed to
+   Dio_ReadChannelGroup and Dio_WriteChannelGroup after Dio_Init. A post-build configuration of another
+   module refers to a group by its DioConf_<NAME>_GROUP_INDEX and resolves it the same way */
+#define DioConf_DISPLAY_BUS_GROUP_PTR  (&Dio_GetConfig()->Groups[DioConf_DISPLAY_BUS_GROUP_INDEX])
+#define DioConf_MUX_SELECT_GROUP_PTR   (&Dio_GetConfig()->Groups[DioConf_MUX_SELECT_GROUP_INDEX])
+
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+/* Pointers to the virtual ports of the configuration set given to Dio_Init, to be passed to
+   Dio_ReadVirtualPort and Dio_WriteVirtualPort after Dio_Init */
+#define DioConf_LCD_BUS_VPORT_PTR      (&Dio_GetConfig()->VirtualPorts[DioConf_LCD_BUS_VPORT_INDEX])
+#define DioConf_ADC_BUS_VPORT_PTR      (&Dio_GetConfig()->VirtualPorts[DioConf_ADC_BUS_VPORT_INDEX])
+#endif
+
+
+/**
+ * @brief Dio_Init is a service that initializes the DIO driver with a configuration set.
+ * 
+ * @details Service ID [hex] 0x10
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ * 
+ *          To be called after Port_Init: the ports whose clock is not ready then (PORT_GATE_UNUSED_PORTS)
+ *          are never accessed, the port services report them as invalid port IDs.
+ * 
+ * @param [in] ConfigPtr     Pointer to the post-build configuration set.
+ */
+void Dio_Init (const Dio_ConfigType* ConfigPtr);
+
+/**
+ * @brief Returns the configuration set Dio_Init was called with, NULL_PTR before Dio_Init.
+ * 
+ * @details The channels, groups and virtual ports of the other modules are resolved in it, so they follow
+ *          the configuration set selected at start-up.
+ */
+const Dio_ConfigType* Dio_GetConfig (void);
+
 
 /**
  * @brief Dio_ReadChannel is a service that returns the value of the specified DIO channel
@@ -214,8 +537,12 @@ void Dio_GetVersionInfo (Std_VersionInfoType* versioninfo);
  *         Synchronous/Asynchronous: Synchronous
  *       Reentrancy: Reentrant
  * 
+ *         A shadowed pin is flipped in a critical section. Another pin is loaded and stored through its
+ *         aperture: a write of the same pin by an ISR between the two is lost, unless DIO_FLIP_EXCLUSIVE_ACCESS
+ *         makes the flip an LDREX/STREX loop that retries after it.
+ * 
  * @param [in] ChannelId         The channel ID of the DIO channel to be flipped.
- * @return Dio_LevelType    The value of the specified DIO channel.
+ * @return Dio_LevelType    The level of the specified DIO channel after the flip.
  *                            - STD_HIGH The physical level of the corresponding Pin is STD_HIGH
  *                            - STD_LOW The physical level of the corresponding Pin is STD_LOW
  */
@@ -235,6 +562,424 @@ Dio_LevelType Dio_FlipChannel (Dio_ChannelType ChannelId);
  */
 void Dio_MaskedWritePort (Dio_PortType PortId,Dio_PortLevelType Level,Dio_PortLevelType Mask);
 
+/**
+ * @brief Dio_WritePortsSynchronous is a service that writes all the entries of the synchronous port write list back to back.
+ * 
+ * @details Service ID [hex] 0x20
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         The addresses and levels are loaded first, then interrupts are masked only for the stores,
+ *         so the skew between the ports is one store per entry whatever the port IDs are.
+ * 
+ * @param [in] Levels        Levels of the entries, Levels[i] is written to the pins of entry i (DioConf_<NAME>_SYNC_INDEX).
+ */
+void Dio_WritePortsSynchronous (const Dio_PortLevelType* Levels);
+
+/**
+ * @brief Dio_ReadAllPorts is a service that samples the levels of all the configured ports into one image.
+ * 
+ * @details Service ID [hex] 0x21
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         The DATA register of each port is loaded exactly once, back to back with interrupts masked,
+ *         so all the channels of the image are sampled at the same time. Use Dio_GetChannelFromImage
+ *         and Dio_GetPortFromImage to extract levels from the image. Ports gated off at Dio_Init read as 0.
+ * 
+ * @return Dio_PortsImageType  Levels of all the ports, port PortId in bits [PortId * 8 + 7 : PortId * 8].
+ */
+Dio_PortsImageType Dio_ReadAllPorts (void);
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/**
+ * @brief Dio_CheckOutputShadow is the cyclic service that compares the output shadow with the DATA registers.
+ * 
+ * @details Service ID [hex] 0x2C
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         The write services store the level of the shadowed output pins in RAM as well, so Dio_ReadChannel,
+ *         Dio_ReadPort, Dio_ReadChannelGroup and Dio_FlipChannel return or flip it without loading DATA.
+ *         This service loads the DATA register of every port with shadowed pins once, with interrupts masked
+ *         so no write can come between the load and the compare. The DATA register of an output returns its
+ *         latch, so a mismatch is a write that bypassed the DIO services, a corrupted latch or a pin that was
+ *         turned into an input and reads another level. The shadow is not changed, the read services keep
+ *         returning the level that was written.
+ * 
+ * @return Dio_PortsImageType  Mismatching pins, port PortId in bits [PortId * 8 + 7 : PortId * 8], 0 when none.
+ */
+Dio_PortsImageType Dio_CheckOutputShadow (void);
+#endif
+
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+/**
+ * @brief Dio_ReadVirtualPort is a service that returns the word of a virtual port.
+ * 
+ * @details Service ID [hex] 0x2D
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         One load per physical port (none for a port whose pins are all shadowed outputs), the ports are
+ *         read one after the other, not at the same instant.
+ * 
+ * @param [in] VirtualPortPtr           Pointer to the virtual port to be read.
+ * @return Dio_VirtualPortLevelType     Levels of the pins of the virtual port, bit i is its pin i.
+ */
+Dio_VirtualPortLevelType Dio_ReadVirtualPort (const Dio_VirtualPortType* VirtualPortPtr);
+
+/**
+ * @brief Dio_WriteVirtualPort is a service that writes the word of a virtual port.
+ * 
+ * @details Service ID [hex] 0x2E
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         One store per physical port through the aperture masked to the pins of the virtual port, the other
+ *         pins of the ports are not touched. The ports change one after the other: a bus written with it
+ *         needs a strobe written after the word.
+ * 
+ * @param [in] VirtualPortPtr  Pointer to the virtual port to be written.
+ * @param [in] Level           Levels of the pins of the virtual port, bit i is its pin i.
+ */
+void Dio_WriteVirtualPort (const Dio_VirtualPortType* VirtualPortPtr, Dio_VirtualPortLevelType Level);
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/**
+ * @brief Dio_MainFunction is the cyclic service that samples all the ports once and debounces all the channels.
+ * 
+ * @details Service ID [hex] 0x22
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ *         A channel takes its new level after DebounceDepth consecutive samples differing from its
+ *         debounced level. The first call after Dio_Init takes the sampled levels as debounced levels.
+ */
+void Dio_MainFunction (void);
+
+/**
+ * @brief Returns the debounced levels of all the ports, in the layout of Dio_ReadAllPorts.
+ */
+Dio_PortsImageType Dio_GetDebouncedLevels (void);
+
+/**
+ * @brief Returns the channels whose debounced level went from STD_LOW to STD_HIGH in the last Dio_MainFunction call.
+ */
+Dio_PortsImageType Dio_GetRisingEdges (void);
+
+/**
+ * @brief Returns the channels whose debounced level went from STD_HIGH to STD_LOW in the last Dio_MainFunction call.
+ */
+Dio_PortsImageType Dio_GetFallingEdges (void);
+#endif
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/**
+ * @brief Dio_EnableNotification is a service that unmasks the interrupt of a channel with a configured notification.
+ * 
+ * @details Service ID [hex] 0x23
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         The pending event of the channel is cleared first, so only the events after the call are notified.
+ * 
+ * @param [in] ChannelId     The channel ID of the DIO channel to be notified.
+ */
+void Dio_EnableNotification (Dio_ChannelType ChannelId);
+
+/**
+ * @brief Dio_DisableNotification is a service that masks the interrupt of a channel.
+ * 
+ * @details Service ID [hex] 0x24
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [in] ChannelId     The channel ID of the DIO channel not to be notified anymore.
+ */
+void Dio_DisableNotification (Dio_ChannelType ChannelId);
+
+/* GPIO port interrupt handlers, to be placed in the vector table (GPIO Port A..F, IRQ 0..4 and 30) */
+void Dio_GpioPortA_Isr (void);
+void Dio_GpioPortB_Isr (void);
+void Dio_GpioPortC_Isr (void);
+void Dio_GpioPortD_Isr (void);
+void Dio_GpioPortE_Isr (void);
+void Dio_GpioPortF_Isr (void);
+#endif
+
+#if (DIO_PATTERN_API == STD_ON)
+/**
+ * @brief Dio_StartPattern is a service that starts streaming a pattern to the pins of a port.
+ * 
+ * @details Service ID [hex] 0x25
+ *         Synchronous/Asynchronous: Asynchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ *         Every period the timer requests one uDMA transfer of the next sample of the current half to the
+ *         DATA aperture of the pattern pins, so no CPU time is spent per sample. When a half is done the uDMA
+ *         switches to the other one and the timer ISR calls the notification, the application refills the
+ *         finished half before the other one is done. The pattern and its buffers must stay valid until
+ *         Dio_StopPattern.
+ * 
+ * @param [in] Pattern         Pattern to be output.
+ * @return Std_ReturnType      E_OK when the pattern was started, E_NOT_OK for an invalid pattern.
+ */
+Std_ReturnType Dio_StartPattern (const Dio_PatternType* Pattern);
+
+/**
+ * @brief Dio_StopPattern is a service that stops the pattern output, the pins keep their last level.
+ * 
+ * @details Service ID [hex] 0x26
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ */
+void Dio_StopPattern (void);
+
+/* Timer A interrupt handler of the pattern timer, to be placed in the vector table (IRQ 19 + 2 * DIO_PATTERN_TIMER) */
+void Dio_PatternTimer_Isr (void);
+#endif
+
+#if (DIO_CAPTURE_API == STD_ON)
+/**
+ * @brief Dio_StartCapture is a service that starts sampling whole ports into ring buffers.
+ * 
+ * @details Service ID [hex] 0x27
+ *         Synchronous/Asynchronous: Asynchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ *         Port ports[i] is sampled by half i % 2 of timer i / 2 (uDMA channel 18 + i), the halves run in 16-bit
+ *         mode and are started together through GPTMSYNC, so sample n of every port is taken at the same time.
+ *         Every period the uDMA copies one DATA register into the ring, no CPU time is spent per sample.
+ *         When a half of every ring is filled the timer ISR calls the notification, the application gives the
+ *         half back with Dio_ReleaseCaptureHalf before the other half is filled, a half not given back in time
+ *         is overwritten and counted as an overrun. The capture and its buffer must stay valid until
+ *         Dio_StopCapture.
+ * 
+ * @param [in] Capture         Capture to be started.
+ * @return Std_ReturnType      E_OK when the capture was started, E_NOT_OK for an invalid capture or when one
+ *                             of its timers paces the running pattern.
+ */
+Std_ReturnType Dio_StartCapture (const Dio_CaptureType* Capture);
+
+/**
+ * @brief Dio_StopCapture is a service that stops the running capture.
+ * 
+ * @details Service ID [hex] 0x28
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ */
+void Dio_StopCapture (void);
+
+/**
+ * @brief Dio_ReleaseCaptureHalf is a service that gives a notified half of the rings back to the uDMA.
+ * 
+ * @details Service ID [hex] 0x29
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ * @param [in] HalfIndex       Half (0 or 1) the application is done with.
+ */
+void Dio_ReleaseCaptureHalf (uint8 HalfIndex);
+
+/**
+ * @brief Dio_GetCaptureStatus is a service that returns the progress of the running capture.
+ * 
+ * @details Service ID [hex] 0x2A
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ * @param [out] Status         Samples notified and overruns since Dio_StartCapture.
+ */
+void Dio_GetCaptureStatus (Dio_CaptureStatusType* Status);
+
+/**
+ * @brief Dio_DecodeCaptureEdges is a service that turns the samples of one port into channel edges.
+ * 
+ * @details Service ID [hex] 0x2B
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Reentrant
+ * 
+ *         Each sample is compared with the previous one as a whole port, only the changed pins are visited,
+ *         so the cost follows the number of edges rather than samples times channels. Pins without a
+ *         configured channel are ignored. Decoding stops before the first sample whose edges do not all fit
+ *         in Edges, *Level is then the level before that sample.
+ * 
+ * @param [in] Samples         Samples of the port, for example one half of its capture ring.
+ * @param [in] Count           Number of samples.
+ * @param [in] PortId          Port the samples were taken from.
+ * @param [in] FirstSample     Index of Samples[0], used for the edge timestamps.
+ * @param [inout] Level        Level of the port before Samples[0], updated to the level after the last sample decoded.
+ * @param [out] Edges          Decoded edges, in sample order.
+ * @param [in] MaxEdges        Capacity of Edges.
+ * @return uint32              Number of edges written to Edges.
+ */
+uint32 Dio_DecodeCaptureEdges (const Dio_PortLevelType* Samples, uint32 Count, Dio_PortType PortId,
+                               uint32 FirstSample, Dio_PortLevelType* Level,
+                               Dio_CaptureEdgeType* Edges, uint32 MaxEdges);
+
+/* Interrupt handler of the capture timers, to be placed in the vector table for IRQ 19 + i of every port ports[i] */
+void Dio_CaptureTimer_Isr (void);
+#endif
+
+#if (DIO_SHARED_DMA_API == STD_ON)
+/**
+ * @brief Dio_GetDmaControl is a service that lends one structure of the DIO uDMA control table to a module
+ *        built on DIO, the uDMA controller is clocked and enabled with this table.
+ * 
+ * @details Service ID [hex] 0x2F
+ *         Synchronous/Asynchronous: Synchronous
+ *      Reentrancy: Non Reentrant
+ * 
+ *         The caller owns the channel: it maps it, enables it and serves its completion. The channels 18..23
+ *         belong to the capture and the pattern generator.
+ * 
+ * @param [in] Channel              uDMA channel, 0..31.
+ * @param [in] BufferIndex          0 for the primary structure, 1 for the alternate one.
+ * @return Dio_DmaControlType*      Control structure, NULL_PTR for an invalid parameter.
+ */
+Dio_DmaControlType* Dio_GetDmaControl (uint8 Channel, uint8 BufferIndex);
+#endif
+
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structure to be passed to Dio_Init */
+extern const Dio_ConfigType Dio_Configuration;
+
+/* Level of port PortId in an image returned by Dio_ReadAllPorts */
+LOCAL_INLINE Dio_PortLevelType Dio_GetPortFromImage(Dio_PortsImageType Image, Dio_PortType PortId)
+{
+    return (Dio_PortLevelType)(Image >> ((uint32)PortId << 3U));
+}
+
+/* Level of channel ChannelId in an image returned by Dio_ReadAllPorts, at its pin in the configuration set given to Dio_Init */
+LOCAL_INLINE Dio_LevelType Dio_GetChannelFromImage(Dio_PortsImageType Image, Dio_ChannelType ChannelId)
+{
+    const Dio_ChannelConfigType * Channel = &Dio_GetConfig()->Channels[ChannelId];
+    return (Dio_LevelType)((Dio_GetPortFromImage(Image, Channel->port) & Channel->mask) != 0U);
+}
+
+#if (((DIO_DEV_ERROR_DETECT == STD_ON) || (DIO_INLINE_FAST_PATH == STD_ON)) && defined(__GNUC__))
+/******************************************************************************
+ *                      Compile-Time Parameter Checks                         *
+ ******************************************************************************/
+/*
+ * Static assertion of ID < LIMIT when ID is an integer constant expression: an out of range constant
+ * declares a negative size array and stops the build. For any other ID the assertion is discarded
+ * unevaluated and the DIO.c service checks the ID against the configuration at run time. The inline
+ * fast path asserts its channel IDs with it even when DIO_DEV_ERROR_DETECT is off.
+ */
+#define DIO_STATIC_ASSERT_ID(ID, LIMIT)                               \
+    ((void)__builtin_choose_expr(__builtin_constant_p(ID), sizeof(char[((ID) < (LIMIT)) ? 1 : -1]), 0U))
+
+#define DIO_CHECK_CHANNEL_ID(ChannelId)   DIO_STATIC_ASSERT_ID(ChannelId, DIO_CONFIGURED_CHANNELS)
+#define DIO_CHECK_PORT_ID(PortId)         DIO_STATIC_ASSERT_ID(PortId, DIO_CONFIGURED_PORTS)
+#endif
+
+#if ((DIO_DEV_ERROR_DETECT == STD_ON) && defined(__GNUC__))
+
+#define Dio_ReadPort(PortId)                                          \
+    (DIO_CHECK_PORT_ID(PortId), (Dio_ReadPort)(PortId))
+
+#define Dio_WritePort(PortId, Level)                                  \
+    (DIO_CHECK_PORT_ID(PortId), (Dio_WritePort)(PortId, Level))
+
+#define Dio_MaskedWritePort(PortId, Level, Mask)                      \
+    (DIO_CHECK_PORT_ID(PortId), (Dio_MaskedWritePort)(PortId, Level, Mask))
+
+#define Dio_FlipChannel(ChannelId)                                    \
+    (DIO_CHECK_CHANNEL_ID(ChannelId), (Dio_FlipChannel)(ChannelId))
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+#define Dio_EnableNotification(ChannelId)                             \
+    (DIO_CHECK_CHANNEL_ID(ChannelId), (Dio_EnableNotification)(ChannelId))
+
+#define Dio_DisableNotification(ChannelId)                            \
+    (DIO_CHECK_CHANNEL_ID(ChannelId), (Dio_DisableNotification)(ChannelId))
+#endif
+
+#if (DIO_INLINE_FAST_PATH == STD_OFF)
+#define Dio_ReadChannel(ChannelId)                                    \
+    (DIO_CHECK_CHANNEL_ID(ChannelId), (Dio_ReadChannel)(ChannelId))
+
+#define Dio_WriteChannel(ChannelId, Level)                            \
+    (DIO_CHECK_CHANNEL_ID(ChannelId), (Dio_WriteChannel)(ChannelId, Level))
+#endif
+#endif
+
+#if ((DIO_INLINE_FAST_PATH == STD_ON) && defined(__GNUC__))
+/******************************************************************************
+ *                      Inline Fast Path                                      *
+ ******************************************************************************/
+#include "DIO_Private.h"
+#include "../Trace/Trace.h"
+
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+/* Pin of channel CHANNEL is in DioConf_PORTx_SHADOW_PINS, a constant when CHANNEL is a constant. Such channels
+   keep the DIO.c functions, which update and read back the output shadow */
+#define DIO_CHANNEL_SHADOWED(CHANNEL)                                 \
+    ((((DIO_CHANNEL_PORT(CHANNEL) == PORTA) ? DioConf_PORTA_SHADOW_PINS :   \
+       (DIO_CHANNEL_PORT(CHANNEL) == PORTB) ? DioConf_PORTB_SHADOW_PINS :   \
+       (DIO_CHANNEL_PORT(CHANNEL) == PORTC) ? DioConf_PORTC_SHADOW_PINS :   \
+       (DIO_CHANNEL_PORT(CHANNEL) == PORTD) ? DioConf_PORTD_SHADOW_PINS :   \
+       (DIO_CHANNEL_PORT(CHANNEL) == PORTE) ? DioConf_PORTE_SHADOW_PINS :   \
+                                              DioConf_PORTF_SHADOW_PINS)    \
+      >> DIO_CHANNEL_PIN(CHANNEL)) & 1U)
+#else
+#define DIO_CHANNEL_SHADOWED(CHANNEL)     (0U)
+#endif
+
+/* Address of the DATA aperture of the pin of channel CHANNEL, a constant when CHANNEL is a constant. It is
+   the bits_address of the Dio_PBcfg.c descriptor: both come from DIO_CHANNEL_PORT/DIO_CHANNEL_PIN */
+#define DIO_CHANNEL_BITS_ADDRESS(CHANNEL)                             \
+    DIO_DATA_BITS_ADDRESS(DIO_PORT_BASE_ADDRESS(DIO_CHANNEL_PORT(CHANNEL)), 1U << DIO_CHANNEL_PIN(CHANNEL))
+
+/* Dio_ReadChannel folded to one load of the pin aperture, traced as the DIO.c function when TRACE_API is on */
+LOCAL_INLINE Dio_LevelType Dio_ReadChannelInline(Dio_ChannelType ChannelId)
+{
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_READ_CHANNEL_SID, ChannelId);
+    return (Dio_LevelType)(DIO_READ_REG(DIO_CHANNEL_BITS_ADDRESS(ChannelId)) != 0U);
+}
+
+/* Dio_WriteChannel folded to one store to the pin aperture, traced as the DIO.c function when TRACE_API is on */
+LOCAL_INLINE void Dio_WriteChannelInline(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    TRACE_SERVICE(DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID, ChannelId);
+    DIO_WRITE_REG(DIO_CHANNEL_BITS_ADDRESS(ChannelId), (Level == STD_HIGH) ? 0xFFU : 0U);
+}
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+/* Only integer constant expressions, which are asserted at compile time, take the inline path, unless shadowed */
+#define DIO_FAST_PATH_SELECT(ChannelId, INLINE_CALL, CALL)            \
+    __builtin_choose_expr(__builtin_constant_p(ChannelId),            \
+        (DIO_CHECK_CHANNEL_ID(ChannelId), ((DIO_CHANNEL_SHADOWED(ChannelId) != 0U) ? (CALL) : (INLINE_CALL))), CALL)
+#else
+/* Stops the build when a call to it is left after optimization, see DIO_CHECK_FOLDED_CHANNEL_ID */
+extern void Dio_InlineChannelIdOutOfRange(void)
+    __attribute__((error("constant channel ID out of DIO_CONFIGURED_CHANNELS on the inline fast path")));
+
+/* Out of range channel ID known constant by the optimizer only: the call below is not folded away */
+#define DIO_CHECK_FOLDED_CHANNEL_ID(ChannelId)                        \
+    (((ChannelId) >= DIO_CONFIGURED_CHANNELS) ? Dio_InlineChannelIdOutOfRange() : (void)0)
+
+/* Channel IDs known constant by the optimizer take the inline path unless shadowed, out of range ones stop the
+   build as there is no run-time check left to catch them */
+#define DIO_FAST_PATH_SELECT(ChannelId, INLINE_CALL, CALL)            \
+    ((__builtin_constant_p(ChannelId) && (DIO_CHANNEL_SHADOWED(ChannelId) == 0U))                      \
+        ? (DIO_CHECK_CHANNEL_ID(ChannelId), DIO_CHECK_FOLDED_CHANNEL_ID(ChannelId), (INLINE_CALL)) : (CALL))
+#endif
+
+/* Constant channel IDs take the inline path, any other channel ID calls the DIO.c function */
+#define Dio_ReadChannel(ChannelId)                                    \
+    DIO_FAST_PATH_SELECT(ChannelId, Dio_ReadChannelInline(ChannelId), (Dio_ReadChannel)(ChannelId))
+
+#define Dio_WriteChannel(ChannelId, Level)                            \
+    DIO_FAST_PATH_SELECT(ChannelId, Dio_WriteChannelInline(ChannelId, Level), (Dio_WriteChannel)(ChannelId, Level))
+#endif
+
 
 
 #endif
\ No newline at end of file
@@ -14,6 +14,234 @@
 
 #include "../tm4c123gh6pm.h"
 #include "../tm4c123gh6pm_bits.h"
+#include "../Mcal_Reg.h"
 
+/* GPIO Registers base addresses */
+#if (DIO_GPIO_AHB_APERTURE == STD_ON)
+#define DIO_GPIO_PORTA_BASE_ADDRESS       0x40058000U
+#define DIO_GPIO_PORTB_BASE_ADDRESS       0x40059000U
+#define DIO_GPIO_PORTC_BASE_ADDRESS       0x4005A000U
+#define DIO_GPIO_PORTD_BASE_ADDRESS       0x4005B000U
+#define DIO_GPIO_PORTE_BASE_ADDRESS       0x4005C000U
+#define DIO_GPIO_PORTF_BASE_ADDRESS       0x4005D000U
+#else
+#define DIO_GPIO_PORTA_BASE_ADDRESS       0x40004000U
+#define DIO_GPIO_PORTB_BASE_ADDRESS       0x40005000U
+#define DIO_GPIO_PORTC_BASE_ADDRESS       0x40006000U
+#define DIO_GPIO_PORTD_BASE_ADDRESS       0x40007000U
+#define DIO_GPIO_PORTE_BASE_ADDRESS       0x40024000U
+#define DIO_GPIO_PORTF_BASE_ADDRESS       0x40025000U
+#endif
 
-#endif /* DIO_REGS_H */
\ No newline at end of file
+/* DATA register offset (all the 8 address mask bits set, so the whole port is accessed) */
+#define DIO_DATA_REG_OFFSET               0x3FCU
+
+/* Direction register offset */
+#define DIO_DIR_REG_OFFSET                0x400U
+
+/* Interrupt registers offsets */
+#define DIO_INT_SENSE_REG_OFFSET          0x404U
+#define DIO_INT_BOTH_EDGES_REG_OFFSET     0x408U
+#define DIO_INT_EVENT_REG_OFFSET          0x40CU
+#define DIO_INT_MASK_REG_OFFSET           0x410U
+#define DIO_RAW_INT_STATUS_REG_OFFSET     0x414U
+#define DIO_MASKED_INT_STATUS_REG_OFFSET  0x418U
+#define DIO_INT_CLEAR_REG_OFFSET          0x41CU
+
+/* GPIO peripheral ready register, bit PortId is set once the clock of the port is running */
+#define DIO_PRGPIO_REGISTER_ADDRESS       0x400FEA08U
+
+/* No development error, result of the validation of a pattern or a capture */
+#define DIO_E_OK                          (uint8)0x00
+
+/* Index of the most significant bit set in VALUE (CLZ on the Cortex-M4), VALUE must not be 0 */
+#define DIO_MSB_INDEX(VALUE)              ((uint8)(31U - (uint32)__builtin_clz(VALUE)))
+
+/*
+ * Address of the DATA register aperture that only reaches the pins set in MASK.
+ * Address bits [9:2] mask the access, so a store changes only those pins and a
+ * load returns 0 for all the other pins: no read-modify-write is needed.
+ */
+#define DIO_DATA_BITS_ADDRESS(BASE, MASK) ((BASE) + ((uint32)(MASK) << 2U))
+
+/* Peripheral bit-band region and its alias region (Cortex-M4) */
+#define DIO_PERIPHERAL_BASE_ADDRESS       0x40000000U
+#define DIO_BITBAND_ALIAS_BASE_ADDRESS    0x42000000U
+
+/*
+ * Address of the bit-band alias word of bit BIT of the peripheral register at ADDRESS.
+ * A load of the alias word returns the bit as 0 or 1 and a store writes bit 0 of the
+ * stored value to it, so no shift or mask is needed.
+ */
+#define DIO_BITBAND_ADDRESS(ADDRESS, BIT)                             \
+    (DIO_BITBAND_ALIAS_BASE_ADDRESS + (((ADDRESS) - DIO_PERIPHERAL_BASE_ADDRESS) << 5U) + ((uint32)(BIT) << 2U))
+
+/* Read/Write a GPIO register through its absolute address */
+#define DIO_READ_REG(ADDRESS)             MCAL_REG_READ32(ADDRESS)
+#define DIO_WRITE_REG(ADDRESS, VALUE)     MCAL_REG_WRITE32(ADDRESS, VALUE)
+
+#ifdef MCAL_HOST_SIM
+/* The host has no exclusive monitor and no PRIMASK, the simulator models them */
+#define Dio_LoadExclusive(ADDRESS)            Mcal_Sim_ReadExclusive32(ADDRESS)
+#define Dio_StoreExclusive(ADDRESS, VALUE)    Mcal_Sim_WriteExclusive32(ADDRESS, VALUE)
+#define Dio_SuspendInterrupts()               Mcal_Sim_SuspendInterrupts()
+#define Dio_ResumeInterrupts(PRIMASK)         Mcal_Sim_ResumeInterrupts(PRIMASK)
+#else
+#if (DIO_FLIP_EXCLUSIVE_ACCESS == STD_ON)
+/* Exclusive load (LDREX) of the register at ADDRESS, arms the local exclusive monitor */
+LOCAL_INLINE uint32 Dio_LoadExclusive(uint32 Address)
+{
+    uint32 Value;
+    __asm volatile ("ldrex %0, [%1]" : "=r" (Value) : "r" (Address) : "memory");
+    return Value;
+}
+
+/* Exclusive store (STREX) of Value to the register at ADDRESS, returns 0 on success and 1 when the monitor was lost */
+LOCAL_INLINE uint32 Dio_StoreExclusive(uint32 Address, uint32 Value)
+{
+    uint32 Result;
+    __asm volatile ("strex %0, %2, [%1]" : "=&r" (Result) : "r" (Address), "r" (Value) : "memory");
+    return Result;
+}
+#endif
+
+/* Mask the interrupts (PRIMASK) and return the previous PRIMASK value */
+LOCAL_INLINE uint32 Dio_SuspendInterrupts(void)
+{
+    uint32 Primask;
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Primask) : : "memory");
+    return Primask;
+}
+
+/* Restore the PRIMASK value returned by Dio_SuspendInterrupts */
+LOCAL_INLINE void Dio_ResumeInterrupts(uint32 Primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (Primask) : "memory");
+}
+#endif
+
+#if ((DIO_PATTERN_API == STD_ON) || (DIO_CAPTURE_API == STD_ON) || (DIO_SHARED_DMA_API == STD_ON))
+#if (DIO_PATTERN_TIMER > 2U)
+#error "DIO_PATTERN_TIMER must be 0, 1 or 2 (timers whose timer A request is on uDMA encoding 0)"
+#endif
+
+/* Clock gating and peripheral ready registers of the timers and the uDMA */
+#define DIO_RCGCTIMER_REGISTER_ADDRESS    0x400FE604U
+#define DIO_RCGCDMA_REGISTER_ADDRESS      0x400FE60CU
+#define DIO_PRTIMER_REGISTER_ADDRESS      0x400FEA04U
+#define DIO_PRDMA_REGISTER_ADDRESS        0x400FEA0CU
+
+/* 16/32-bit timers base address and registers offsets */
+#define DIO_TIMER_BASE_ADDRESS(TIMER)     (0x40030000U + ((uint32)(TIMER) * 0x1000U))
+#define DIO_TIMER_CFG_REG_OFFSET          0x000U
+#define DIO_TIMER_TAMR_REG_OFFSET         0x004U
+#define DIO_TIMER_TBMR_REG_OFFSET         0x008U
+#define DIO_TIMER_CTL_REG_OFFSET          0x00CU
+#define DIO_TIMER_SYNC_REG_OFFSET         0x010U
+#define DIO_TIMER_ICR_REG_OFFSET          0x024U
+#define DIO_TIMER_TAILR_REG_OFFSET        0x028U
+#define DIO_TIMER_TBILR_REG_OFFSET        0x02CU
+
+/* uDMA registers */
+#define DIO_UDMA_CFG_REGISTER_ADDRESS         0x400FF004U
+#define DIO_UDMA_CTLBASE_REGISTER_ADDRESS     0x400FF008U
+#define DIO_UDMA_USEBURSTCLR_REGISTER_ADDRESS 0x400FF01CU
+#define DIO_UDMA_REQMASKCLR_REGISTER_ADDRESS  0x400FF024U
+#define DIO_UDMA_ENASET_REGISTER_ADDRESS      0x400FF028U
+#define DIO_UDMA_ENACLR_REGISTER_ADDRESS      0x400FF02CU
+#define DIO_UDMA_ALTCLR_REGISTER_ADDRESS      0x400FF034U
+#define DIO_UDMA_PRIOCLR_REGISTER_ADDRESS     0x400FF03CU
+#define DIO_UDMA_CHIS_REGISTER_ADDRESS        0x400FF504U
+#define DIO_UDMA_CHMAP2_REGISTER_ADDRESS      0x400FF518U
+
+/* uDMA channel of the timer A (HALF = 0) or B (HALF = 1) request of timer TIMER (0..2), encoding 0 in DMACHMAP2 */
+#define DIO_TIMER_UDMA_CHANNEL(TIMER, HALF)  (18U + (2U * (uint32)(TIMER)) + (uint32)(HALF))
+
+/* Field of uDMA channel CHANNEL (16..23) in DMACHMAP2 */
+#define DIO_UDMA_CHMAP2_SHIFT(CHANNEL)       (((uint32)(CHANNEL) - 16U) * 4U)
+
+/* Interrupt of timer A/B of timer TIMER (0..2), the uDMA completion of its channel is signalled on it */
+#define DIO_TIMER_IRQ(TIMER, HALF)           (19U + (2U * (uint32)(TIMER)) + (uint32)(HALF))
+#define DIO_NVIC_EN0_REGISTER_ADDRESS        0xE000E100U
+
+/* Timer, uDMA channel and interrupt of the pattern generator (timer A of DIO_PATTERN_TIMER) */
+#define DIO_PATTERN_TIMER_BASE_ADDRESS       DIO_TIMER_BASE_ADDRESS(DIO_PATTERN_TIMER)
+#define DIO_PATTERN_UDMA_CHANNEL             DIO_TIMER_UDMA_CHANNEL(DIO_PATTERN_TIMER, 0U)
+#define DIO_PATTERN_TIMER_IRQ                DIO_TIMER_IRQ(DIO_PATTERN_TIMER, 0U)
+
+/* Number of channels of the uDMA control table, the alternate structures follow the primary ones */
+#define DIO_UDMA_CHANNELS                 (32U)
+
+/* Bus address of a RAM object as programmed in the uDMA */
+#define DIO_RAM_ADDRESS(PTR, SIZE)        MCAL_RAM_ADDRESS(PTR, SIZE)
+
+/* Control word of one half of the pattern: byte reads from the buffer, byte writes to one fixed DATA aperture,
+   one transfer per timer request, ping-pong mode */
+#define DIO_PATTERN_CHCTL(LENGTH)                                     \
+    (UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_8 | UDMA_CHCTL_SRCSIZE_8 | \
+     UDMA_CHCTL_ARBSIZE_1 | (((uint32)(LENGTH) - 1U) << 4U) | UDMA_CHCTL_XFERMODE_PINGPONG)
+
+/* Control word of one half of a capture ring: byte reads from one fixed DATA register, byte writes to the ring,
+   one transfer per timer request, ping-pong mode */
+#define DIO_CAPTURE_CHCTL(LENGTH)                                     \
+    (UDMA_CHCTL_DSTINC_8 | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_NONE | UDMA_CHCTL_SRCSIZE_8 | \
+     UDMA_CHCTL_ARBSIZE_1 | (((uint32)(LENGTH) - 1U) << 4U) | UDMA_CHCTL_XFERMODE_PINGPONG)
+#endif
+
+/* Base address of the given port, a constant expression when PORT is a constant */
+#define DIO_PORT_BASE_ADDRESS(PORT)                                   \
+    (((PORT) == PORTA) ? DIO_GPIO_PORTA_BASE_ADDRESS :                \
+     ((PORT) == PORTB) ? DIO_GPIO_PORTB_BASE_ADDRESS :                \
+     ((PORT) == PORTC) ? DIO_GPIO_PORTC_BASE_ADDRESS :                \
+     ((PORT) == PORTD) ? DIO_GPIO_PORTD_BASE_ADDRESS :                \
+     ((PORT) == PORTE) ? DIO_GPIO_PORTE_BASE_ADDRESS :                \
+                         DIO_GPIO_PORTF_BASE_ADDRESS)
+
+/* Initializer of the descriptor of channel PIN of port PORT */
+#if (DIO_BITBAND_ACCESS == STD_ON)
+#define DIO_CHANNEL_DESC(PORT, PIN)                                   \
+    { DIO_DATA_BITS_ADDRESS(DIO_PORT_BASE_ADDRESS(PORT), 1U << (PIN)), \
+      DIO_BITBAND_ADDRESS(DIO_PORT_BASE_ADDRESS(PORT) + DIO_DATA_REG_OFFSET, PIN), \
+      (uint8)(1U << (PIN)), (PORT) }
+#else
+#define DIO_CHANNEL_DESC(PORT, PIN)                                   \
+    { DIO_DATA_BITS_ADDRESS(DIO_PORT_BASE_ADDRESS(PORT), 1U << (PIN)), (uint8)(1U << (PIN)), (PORT) }
+#endif
+
+/* Initializer of the descriptor of channel CHANNEL, at the pin DIO_CHANNEL_PORT/DIO_CHANNEL_PIN map it to */
+#define DIO_MAPPED_CHANNEL_DESC(CHANNEL)                              \
+    DIO_CHANNEL_DESC(DIO_CHANNEL_PORT(CHANNEL), DIO_CHANNEL_PIN(CHANNEL))
+
+/* Initializers of the descriptors of the 8 channels FIRST..FIRST + 7 */
+#define DIO_MAPPED_CHANNELS_DESC(FIRST)                                                   \
+    DIO_MAPPED_CHANNEL_DESC((FIRST) + 0U), DIO_MAPPED_CHANNEL_DESC((FIRST) + 1U),        \
+    DIO_MAPPED_CHANNEL_DESC((FIRST) + 2U), DIO_MAPPED_CHANNEL_DESC((FIRST) + 3U),        \
+    DIO_MAPPED_CHANNEL_DESC((FIRST) + 4U), DIO_MAPPED_CHANNEL_DESC((FIRST) + 5U),        \
+    DIO_MAPPED_CHANNEL_DESC((FIRST) + 6U), DIO_MAPPED_CHANNEL_DESC((FIRST) + 7U)
+
+/* Initializers of the filter depths of the 8 channels of a port, all set to DEPTH */
+#define DIO_PORT_DEBOUNCE_DEPTHS(DEPTH)                               \
+    (DEPTH), (DEPTH), (DEPTH), (DEPTH), (DEPTH), (DEPTH), (DEPTH), (DEPTH)
+
+/* Initializer of a channel group of the pins MASK of port PORT, starting at bit OFFSET */
+#define DIO_CHANNEL_GROUP_DESC(PORT, MASK, OFFSET)                    \
+    { DIO_DATA_BITS_ADDRESS(DIO_PORT_BASE_ADDRESS(PORT), MASK), (uint8)(MASK), (uint8)(OFFSET), (PORT) }
+
+/* Initializer of a synchronous port write entry of the pins MASK of port PORT */
+#define DIO_PORT_WRITE_DESC(PORT, MASK)                               \
+    { DIO_DATA_BITS_ADDRESS(DIO_PORT_BASE_ADDRESS(PORT), MASK), (Dio_PortLevelType)(MASK), (PORT) }
+
+/* Pins mask of WIDTH adjoining pins from pin FIRST */
+#define DIO_VPORT_PINS(FIRST, WIDTH)                                  \
+    ((Dio_PortLevelType)(((1U << (WIDTH)) - 1U) << (FIRST)))
+
+/* Initializer of the access of a virtual port to the pins MASK of port PORT, its segments end before SEGMENT_END */
+#define DIO_VPORT_ACCESS_DESC(PORT, MASK, SEGMENT_END)                \
+    { DIO_DATA_BITS_ADDRESS(DIO_PORT_BASE_ADDRESS(PORT), MASK), (Dio_PortLevelType)(MASK), (PORT), (uint8)(SEGMENT_END) }
+
+/* Initializer of a virtual port segment: WIDTH pins from pin FIRST carry the word bits from bit BIT */
+#define DIO_VPORT_SEGMENT_DESC(FIRST, WIDTH, BIT)                     \
+    { DIO_VPORT_PINS(FIRST, WIDTH), (uint8)(((BIT) > (FIRST)) ? ((BIT) - (FIRST)) : 0U),  \
+      (uint8)(((FIRST) > (BIT)) ? ((FIRST) - (BIT)) : 0U) }
+
+#endif /* DIO_REGS_H */
@@ -26,12 +26,174 @@
 #define DIO_CFG_AR_RELEASE_MINOR_VERSION     (6U)
 #define DIO_CFG_AR_RELEASE_PATCH_VERSION     (0U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect: IDs are checked against the configuration and reported to the
+   Det, constant IDs are also asserted at compile time. STD_OFF removes every check from the build */
 #define DIO_DEV_ERROR_DETECT                (STD_ON)
 
 /* Pre-compile option for Version Info API */
 #define DIO_VERSION_INFO_API                (STD_OFF)
 
+/* Pre-compile option to access the GPIO ports through the AHB apertures instead of the legacy APB ones,
+   must be set the same as PORT_GPIO_AHB_APERTURE in Port_Cfg.h (Port_Init routes the ports to AHB, checked
+   in Dio_PBcfg.c) */
+#ifndef DIO_GPIO_AHB_APERTURE
+#define DIO_GPIO_AHB_APERTURE               (STD_OFF)
+#endif
+
+/* Pre-compile option to read and write single channels through the bit-band alias region */
+#ifndef DIO_BITBAND_ACCESS
+#define DIO_BITBAND_ACCESS                  (STD_OFF)
+#endif
+
+/* Pre-compile option to flip channels with an exclusive access (LDREX/STREX) loop on the pin aperture */
+#ifndef DIO_FLIP_EXCLUSIVE_ACCESS
+#define DIO_FLIP_EXCLUSIVE_ACCESS           (STD_OFF)
+#endif
+
+/* Pre-compile option to resolve Dio_ReadChannel/Dio_WriteChannel calls with a constant channel ID
+   inline in DIO.h (GCC/Clang only), calls with a runtime channel ID still use the DIO.c functions. With
+   DIO_OUTPUT_SHADOW on, the channels of DioConf_PORTx_SHADOW_PINS also keep the DIO.c functions */
+#ifndef DIO_INLINE_FAST_PATH
+#define DIO_INLINE_FAST_PATH                (STD_OFF)
+#endif
+
+/* Pre-compile option for the cyclic input debouncing of Dio_MainFunction */
+#define DIO_DEBOUNCE_API                    (STD_ON)
+
+/* Pre-compile option for the interrupt driven channel notifications (Dio_EnableNotification and the port ISRs) */
+#define DIO_NOTIFICATION_API                (STD_ON)
+
+/* Pre-compile option for the uDMA output pattern generator (Dio_StartPattern) */
+#define DIO_PATTERN_API                     (STD_OFF)
+
+/* Pre-compile option for the uDMA logic capture (Dio_StartCapture), it shares the uDMA control table and
+   the 16/32-bit timers 0..2 with the pattern generator */
+#define DIO_CAPTURE_API                     (STD_ON)
+
+/* Pre-compile option to lend the uDMA control table to the modules built on DIO (Dio_GetDmaControl), there is
+   one table per device and the capture and the pattern generator already own it */
+#define DIO_SHARED_DMA_API                  (STD_ON)
+
+/* Pre-compile option to keep the levels written to the shadowed output pins in RAM, so reading them back does
+   not access the bus and Dio_CheckOutputShadow can compare them with the DATA registers. DIO_INLINE_FAST_PATH
+   does not inline the channels of the shadowed pins, their calls go to DIO.c */
+#ifndef DIO_OUTPUT_SHADOW
+#define DIO_OUTPUT_SHADOW                   (STD_ON)
+#endif
+
+/* Pre-compile option for the virtual ports (Dio_ReadVirtualPort/Dio_WriteVirtualPort), words made of pins
+   spread over several ports */
+#define DIO_VIRTUAL_PORT_API                (STD_ON)
+
+/* Number of DIO channels (8 channels for each of the 6 ports) */
+#define DIO_CONFIGURED_CHANNELS             (48U)
+
+/* Port and pin of channel CHANNEL, constant expressions when CHANNEL is a constant. The channel table of
+   Dio_PBcfg.c and the inline fast path of DIO_INLINE_FAST_PATH are both built from them, a board variant
+   maps its channel IDs to other pins here */
+#define DIO_CHANNEL_PORT(CHANNEL)           ((CHANNEL) >> 3U)
+#define DIO_CHANNEL_PIN(CHANNEL)            ((CHANNEL) & 7U)
+
+/* Symbolic channel IDs of the channels used by the application */
+#define DioConf_LED1_CHANNEL_ID             (41U)   /* PF1 */
+#define DioConf_SW1_CHANNEL_ID              (44U)   /* PF4 */
+
+/* Channels of the software serial buses (SoftSerial_PBcfg.c) */
+#define DioConf_SOFT_SPI_SCK_CHANNEL_ID     (24U)   /* PD0 */
+#define DioConf_SOFT_SPI_MISO_CHANNEL_ID    (26U)   /* PD2 */
+#define DioConf_SOFT_SPI_MOSI_CHANNEL_ID    (27U)   /* PD3 */
+#define DioConf_SOFT_I2C_SCL_CHANNEL_ID     (2U)    /* PA2 */
+#define DioConf_SOFT_I2C_SDA_CHANNEL_ID     (3U)    /* PA3 */
+#define DioConf_ONE_WIRE_DQ_CHANNEL_ID      (4U)    /* PA4 */
+
+/* Control lines of the parallel display bus (ParBus_PBcfg.c), its data lines are the DISPLAY_BUS group */
+#define DioConf_TFT_CS_CHANNEL_ID           (20U)   /* PC4 */
+#define DioConf_TFT_DC_CHANNEL_ID           (21U)   /* PC5 */
+#define DioConf_TFT_WR_CHANNEL_ID           (22U)   /* PC6, WT1CCP0 */
+#define DioConf_TFT_RD_CHANNEL_ID           (23U)   /* PC7 */
+
+/* Heater outputs of SoftPwm (SoftPwm_PBcfg.c), on pins no other module uses */
+#define DioConf_HEATER_0_CHANNEL_ID         (34U)   /* PE2 */
+#define DioConf_HEATER_1_CHANNEL_ID         (35U)   /* PE3 */
+#define DioConf_HEATER_2_CHANNEL_ID         (40U)   /* PF0 */
+
+/* Number of DIO ports */
+#define DIO_CONFIGURED_PORTS                (6U)
+
+/* Number of DIO channel groups */
+#define DIO_CONFIGURED_GROUPS               (2U)
+
+/* Channel group 0: 8-bit parallel display data bus on PB0..PB7 */
+#define DioConf_DISPLAY_BUS_GROUP_INDEX     (0U)
+#define DioConf_DISPLAY_BUS_GROUP_PORT      PORTB
+#define DioConf_DISPLAY_BUS_GROUP_MASK      (0xFFU)
+#define DioConf_DISPLAY_BUS_GROUP_OFFSET    (0U)
+
+/* Channel group 1: 2-bit mux select on PE0..PE1 */
+#define DioConf_MUX_SELECT_GROUP_INDEX      (1U)
+#define DioConf_MUX_SELECT_GROUP_PORT       PORTE
+#define DioConf_MUX_SELECT_GROUP_MASK       (0x03U)
+#define DioConf_MUX_SELECT_GROUP_OFFSET     (0U)
+
+/* Number of entries of the synchronous port write list (Dio_WritePortsSynchronous) */
+#define DIO_CONFIGURED_SYNC_PORT_WRITES     (3U)
+
+/* Motor commutation outputs (outputs in Port_PBcfg.c, on no other module's pins), written together by
+   Dio_WritePortsSynchronous */
+#define DioConf_COMMUTATION_A_SYNC_INDEX    (0U)
+#define DioConf_COMMUTATION_A_SYNC_PORT     PORTA
+#define DioConf_COMMUTATION_A_SYNC_MASK     (0xC0U)   /* PA6, PA7 */
+
+#define DioConf_COMMUTATION_D_SYNC_INDEX    (1U)
+#define DioConf_COMMUTATION_D_SYNC_PORT     PORTD
+#define DioConf_COMMUTATION_D_SYNC_MASK     (0xC0U)   /* PD6, PD7 */
+
+#define DioConf_COMMUTATION_E_SYNC_INDEX    (2U)
+#define DioConf_COMMUTATION_E_SYNC_PORT     PORTE
+#define DioConf_COMMUTATION_E_SYNC_MASK     (0x30U)   /* PE4, PE5 */
+
+/* Number of virtual ports, and the largest number of physical ports and of pin segments of one virtual port */
+#define DIO_CONFIGURED_VIRTUAL_PORTS        (2U)
+#define DIO_VIRTUAL_PORT_MAX_ACCESSES       (3U)
+#define DIO_VIRTUAL_PORT_MAX_SEGMENTS       (3U)
+
+/* Virtual port 0: 4-bit character LCD data bus (outputs), D0 on PA5, D1 on PD1, D2..D3 on PF2..PF3 */
+#define DioConf_LCD_BUS_VPORT_INDEX         (0U)
+
+/* Virtual port 1: 4-bit parallel ADC data bus (inputs), D0..D1 on PA0..PA1, D2..D3 on PD4..PD5 */
+#define DioConf_ADC_BUS_VPORT_INDEX         (1U)
+
+/* Width of the vertical debounce counters, a filter depth is at most 2^DIO_DEBOUNCE_COUNTER_BITS samples */
+#define DIO_DEBOUNCE_COUNTER_BITS           (3U)
+
+/* Filter depths (consecutive differing samples before a level is accepted), 0 leaves the channel unfiltered.
+   Every pin of the TM4C123GH6PM is filtered at the default depth: PA0..PA7, PB0..PB7, PC0..PC7 (PC0..PC3 read
+   the JTAG lines), PD0..PD7, PE0..PE5 and PF0..PF4, SW1 deeper. The channels of PE6..PE7 and PF5..PF7 have no
+   pin and stay unfiltered */
+#define DIO_DEBOUNCE_DEFAULT_DEPTH          (4U)
+#define DioConf_SW1_DEBOUNCE_DEPTH          (8U)
+
+/* Number of channel notifications */
+#define DIO_CONFIGURED_NOTIFICATIONS        (1U)
+
+/* Notification 0: SW1 pressed (active low), calls DioConf_SW1_NOTIFICATION from the PORTF ISR */
+#define DioConf_SW1_NOTIFICATION_INDEX      (0U)
+#define DioConf_SW1_NOTIFICATION_SENSE      DIO_FALLING_EDGE
+#define DioConf_SW1_NOTIFICATION            App_Sw1Notification
+
+/* Shadowed output pins of every port, only the pins that are outputs at Dio_Init are kept. A shadowed pin must
+   have an unchangeable direction and be written only through the DIO write services (not by SoftSerial, not by
+   the pattern generator) */
+#define DioConf_PORTA_SHADOW_PINS           (0xC0U)   /* PA6, PA7 commutation */
+#define DioConf_PORTB_SHADOW_PINS           (0x00U)   /* PB0..PB7 display bus: changeable direction, uDMA stores */
+#define DioConf_PORTC_SHADOW_PINS           (0x00U)
+#define DioConf_PORTD_SHADOW_PINS           (0xC0U)   /* PD6, PD7 commutation, PD0, PD3 are driven by SoftSerial */
+#define DioConf_PORTE_SHADOW_PINS           (0x33U)   /* PE0, PE1 mux select, PE4, PE5 commutation */
+#define DioConf_PORTF_SHADOW_PINS           (0x02U)   /* PF1 LED1 */
+
+/* 16/32-bit timer (0..2) pacing the pattern generator, its timer A requests uDMA channel 18 + 2 * DIO_PATTERN_TIMER */
+#define DIO_PATTERN_TIMER                   (0U)
+
 
 
 #endif /* DIO_CFG_H */
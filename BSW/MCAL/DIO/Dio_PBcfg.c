@@ -1,46 +1,154 @@
-//  /******************************************************************************
-//  *
-//  * Module: Dio
-//  *
-//  * File Name: Dio_PBcfg.c
-//  *
-//  * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Dio Driver
-//  *
-//  * Author: Kassem
-//  ******************************************************************************/
-
-// #include "Dio.h"
-
-// /*
-//  * Module Version 1.0.0
-//  */
-// #define DIO_PBCFG_SW_MAJOR_VERSION              (1U)
-// #define DIO_PBCFG_SW_MINOR_VERSION              (0U)
-// #define DIO_PBCFG_SW_PATCH_VERSION              (0U)
-
-// /*
-//  * AUTOSAR Version 4.0.3
-//  */
-// #define DIO_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
-// #define DIO_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
-// #define DIO_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
-
-// /* AUTOSAR Version checking between Dio_PBcfg.c and Dio.h files */
-// #if ((DIO_PBCFG_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
-//  ||  (DIO_PBCFG_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION)\
-//  ||  (DIO_PBCFG_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
-//   #error "The AR version of PBcfg.c does not match the expected version"
-// #endif
-
-// /* Software Version checking between Dio_PBcfg.c and Dio.h files */
-// #if ((DIO_PBCFG_SW_MAJOR_VERSION != DIO_SW_MAJOR_VERSION)\
-//  ||  (DIO_PBCFG_SW_MINOR_VERSION != DIO_SW_MINOR_VERSION)\
-//  ||  (DIO_PBCFG_SW_PATCH_VERSION != DIO_SW_PATCH_VERSION))
-//   #error "The SW version of PBcfg.c does not match the expected version"
-// #endif
-
-// /* PB structure used with Dio_Init API */
-// const Dio_ConfigType Dio_Configuration = {
-//                                              DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-// 				             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
-// 				         };
\ No newline at end of file
+/**
+ * @file Dio_PBcfg.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Dio Driver
+ * @version 0.1
+ * @date 2022-08-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "DIO.h"
+#include "DIO_Private.h"
+#include "../Port/Port_Cfg.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define DIO_PBCFG_SW_MAJOR_VERSION              (1U)
+#define DIO_PBCFG_SW_MINOR_VERSION              (0U)
+#define DIO_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define DIO_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define DIO_PBCFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define DIO_PBCFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* AUTOSAR Version checking between Dio_PBcfg.c and DIO.h files */
+#if ((DIO_PBCFG_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
+ ||  (DIO_PBCFG_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION)\
+ ||  (DIO_PBCFG_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Dio_PBcfg.c and DIO.h files */
+#if ((DIO_PBCFG_SW_MAJOR_VERSION != DIO_SW_MAJOR_VERSION)\
+ ||  (DIO_PBCFG_SW_MINOR_VERSION != DIO_SW_MINOR_VERSION)\
+ ||  (DIO_PBCFG_SW_PATCH_VERSION != DIO_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* The base addresses below must be on the aperture Port_Init routes the ports to */
+#if (DIO_GPIO_AHB_APERTURE != PORT_GPIO_AHB_APERTURE)
+  #error "DIO_GPIO_AHB_APERTURE in Dio_Cfg.h must be set the same as PORT_GPIO_AHB_APERTURE in Port_Cfg.h"
+#endif
+
+/* The last channel must be on a configured port */
+#if (DIO_CHANNEL_PORT(DIO_CONFIGURED_CHANNELS - 1U) >= DIO_CONFIGURED_PORTS)
+  #error "DIO_CHANNEL_PORT in Dio_Cfg.h maps a channel ID to a port out of DIO_CONFIGURED_PORTS"
+#endif
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/* Notification callbacks, provided by the application */
+extern void DioConf_SW1_NOTIFICATION(Dio_ChannelType ChannelId);
+#endif
+
+/*Configuration structure that will be used by the Dio driver, every channel, port and group
+  is resolved here at build time so Dio_Init only has to keep a pointer to it.
+
+  Channels are listed in the order of their channel ID, at the pins DIO_CHANNEL_PORT/DIO_CHANNEL_PIN
+  of Dio_Cfg.h map them to. Another board variant remaps channels there, not in this table, so the
+  inline fast path of DIO_INLINE_FAST_PATH keeps resolving them to the same pins.*/
+
+const Dio_ConfigType Dio_Configuration =
+{
+    {
+        DIO_MAPPED_CHANNELS_DESC(0U),
+        DIO_MAPPED_CHANNELS_DESC(8U),
+        DIO_MAPPED_CHANNELS_DESC(16U),
+        DIO_MAPPED_CHANNELS_DESC(24U),
+        DIO_MAPPED_CHANNELS_DESC(32U),
+        DIO_MAPPED_CHANNELS_DESC(40U)
+    },
+    {
+        DIO_GPIO_PORTA_BASE_ADDRESS,
+        DIO_GPIO_PORTB_BASE_ADDRESS,
+        DIO_GPIO_PORTC_BASE_ADDRESS,
+        DIO_GPIO_PORTD_BASE_ADDRESS,
+        DIO_GPIO_PORTE_BASE_ADDRESS,
+        DIO_GPIO_PORTF_BASE_ADDRESS
+    },
+    {
+        DIO_CHANNEL_GROUP_DESC(DioConf_DISPLAY_BUS_GROUP_PORT, DioConf_DISPLAY_BUS_GROUP_MASK, DioConf_DISPLAY_BUS_GROUP_OFFSET),
+        DIO_CHANNEL_GROUP_DESC(DioConf_MUX_SELECT_GROUP_PORT, DioConf_MUX_SELECT_GROUP_MASK, DioConf_MUX_SELECT_GROUP_OFFSET)
+    },
+    {
+        DIO_PORT_WRITE_DESC(DioConf_COMMUTATION_A_SYNC_PORT, DioConf_COMMUTATION_A_SYNC_MASK),
+        DIO_PORT_WRITE_DESC(DioConf_COMMUTATION_D_SYNC_PORT, DioConf_COMMUTATION_D_SYNC_MASK),
+        DIO_PORT_WRITE_DESC(DioConf_COMMUTATION_E_SYNC_PORT, DioConf_COMMUTATION_E_SYNC_MASK)
+    }
+#if (DIO_DEBOUNCE_API == STD_ON)
+    ,
+    {
+        DIO_PORT_DEBOUNCE_DEPTHS(DIO_DEBOUNCE_DEFAULT_DEPTH),                                  /* PORTA */
+        DIO_PORT_DEBOUNCE_DEPTHS(DIO_DEBOUNCE_DEFAULT_DEPTH),                                  /* PORTB */
+        DIO_PORT_DEBOUNCE_DEPTHS(DIO_DEBOUNCE_DEFAULT_DEPTH),                                  /* PORTC */
+        DIO_PORT_DEBOUNCE_DEPTHS(DIO_DEBOUNCE_DEFAULT_DEPTH),                                  /* PORTD */
+        DIO_DEBOUNCE_DEFAULT_DEPTH, DIO_DEBOUNCE_DEFAULT_DEPTH, DIO_DEBOUNCE_DEFAULT_DEPTH,
+        DIO_DEBOUNCE_DEFAULT_DEPTH, DIO_DEBOUNCE_DEFAULT_DEPTH, DIO_DEBOUNCE_DEFAULT_DEPTH,
+        0U, 0U,                                                                                /* PORTE, no PE6..PE7 */
+        DIO_DEBOUNCE_DEFAULT_DEPTH, DIO_DEBOUNCE_DEFAULT_DEPTH, DIO_DEBOUNCE_DEFAULT_DEPTH,
+        DIO_DEBOUNCE_DEFAULT_DEPTH, DioConf_SW1_DEBOUNCE_DEPTH,
+        0U, 0U, 0U                                                                             /* PORTF, PF4 is SW1, no PF5..PF7 */
+    }
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
+    ,
+    {
+        { DioConf_SW1_NOTIFICATION, DioConf_SW1_CHANNEL_ID, DioConf_SW1_NOTIFICATION_SENSE }
+    }
+#endif
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    ,
+    {
+        DioConf_PORTA_SHADOW_PINS,
+        DioConf_PORTB_SHADOW_PINS,
+        DioConf_PORTC_SHADOW_PINS,
+        DioConf_PORTD_SHADOW_PINS,
+        DioConf_PORTE_SHADOW_PINS,
+        DioConf_PORTF_SHADOW_PINS
+    }
+#endif
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    ,
+    {
+        {   /* LCD bus: D0 on PA5, D1 on PD1, D2..D3 on PF2..PF3 */
+            {
+                DIO_VPORT_ACCESS_DESC(PORTA, DIO_VPORT_PINS(5U, 1U), 1U),
+                DIO_VPORT_ACCESS_DESC(PORTD, DIO_VPORT_PINS(1U, 1U), 2U),
+                DIO_VPORT_ACCESS_DESC(PORTF, DIO_VPORT_PINS(2U, 2U), 3U)
+            },
+            {
+                DIO_VPORT_SEGMENT_DESC(5U, 1U, 0U),
+                DIO_VPORT_SEGMENT_DESC(1U, 1U, 1U),
+                DIO_VPORT_SEGMENT_DESC(2U, 2U, 2U)
+            },
+            3U
+        },
+        {   /* ADC bus: D0..D1 on PA0..PA1, D2..D3 on PD4..PD5 */
+            {
+                DIO_VPORT_ACCESS_DESC(PORTA, DIO_VPORT_PINS(0U, 2U), 1U),
+                DIO_VPORT_ACCESS_DESC(PORTD, DIO_VPORT_PINS(4U, 2U), 2U)
+            },
+            {
+                DIO_VPORT_SEGMENT_DESC(0U, 2U, 0U),
+                DIO_VPORT_SEGMENT_DESC(4U, 2U, 2U)
+            },
+            2U
+        }
+    }
+#endif
+};
@@ -0,0 +1,72 @@
+/**
+ * @file Det.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Det.c is the source file for Det.h file which contains the implementation of the functions.
+ * @version 0.1
+ * @date 2022-08-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#include "Det.h"
+
+STATIC Det_ErrorType Det_LastError = { 0U, 0U, 0U, 0U, 0U };  /* Last reported error and number of reports */
+
+/* Default hook, an application definition of Det_ErrorHook replaces it */
+__attribute__((weak)) void Det_ErrorHook (uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId){
+    (void)ModuleId;
+    (void)InstanceId;
+    (void)ApiId;
+    (void)ErrorId;
+}
+
+/**
+ * @brief Det_Init is a service that clears the recorded errors.
+ * 
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ */
+void Det_Init (void){
+    Det_LastError.ModuleId = 0U;
+    Det_LastError.InstanceId = 0U;
+    Det_LastError.ApiId = 0U;
+    Det_LastError.ErrorId = 0U;
+    Det_LastError.Count = 0U;
+}
+
+/**
+ * @brief Det_ReportError is a service to report a development error.
+ * 
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Reentrant
+ * 
+ * @param [in] ModuleId      Module ID of the calling module.
+ * @param [in] InstanceId    Instance ID of the calling module.
+ * @param [in] ApiId         Service ID of the API that detected the error.
+ * @param [in] ErrorId       Development error code.
+ * @return Std_ReturnType    Always E_OK.
+ */
+Std_ReturnType Det_ReportError (uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId){
+    Det_LastError.ModuleId = ModuleId;
+    Det_LastError.InstanceId = InstanceId;
+    Det_LastError.ApiId = ApiId;
+    Det_LastError.ErrorId = ErrorId;
+    Det_LastError.Count++;
+    Det_ErrorHook(ModuleId, InstanceId, ApiId, ErrorId);
+    return E_OK;
+}
+
+/**
+ * @brief Det_GetLastError is a service that returns the last reported error and the number of reports.
+ * 
+ * @details Service ID [hex] 0x80
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Reentrant
+ * 
+ * @param [out] Error        Pointer to where to store the last error.
+ */
+void Det_GetLastError (Det_ErrorType* Error){
+    *Error = Det_LastError;
+}
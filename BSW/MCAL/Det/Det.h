@@ -0,0 +1,98 @@
+/**
+ * @file Det.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Default Error Tracer header file, the development errors reported by the MCAL drivers end here.
+ * @version 0.1
+ * @date 2022-08-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#ifndef DET_H
+#define DET_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define DET_SW_MAJOR_VERSION           (1U)
+#define DET_SW_MINOR_VERSION           (0U)
+#define DET_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define DET_AR_RELEASE_MAJOR_VERSION   (4U)
+#define DET_AR_RELEASE_MINOR_VERSION   (6U)
+#define DET_AR_RELEASE_PATCH_VERSION   (0U)
+
+/* Det Vendor Id */
+#define DET_VENDOR_ID    (1000U)
+
+/* Det Module Id */
+#define DET_MODULE_ID    (15U)
+
+#include "../Std_types.h"
+
+/* AUTOSAR checking between Std Types and Det Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DET_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != DET_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != DET_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/**
+ * @brief Last development error reported to the Det, and the number of reports since Det_Init.
+ * 
+ */
+typedef struct
+{
+    uint16 ModuleId;    // Module that reported the error.
+    uint8  InstanceId;  // Instance of the module.
+    uint8  ApiId;       // Service ID of the API that detected the error.
+    uint8  ErrorId;     // Development error code.
+    uint32 Count;       // Number of errors reported since Det_Init.
+}Det_ErrorType;
+
+/**
+ * @brief Det_Init is a service that clears the recorded errors.
+ * 
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ */
+void Det_Init (void);
+
+/**
+ * @brief Det_ReportError is a service to report a development error.
+ * 
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Reentrant
+ * 
+ *          The error is recorded and Det_ErrorHook is called with it, the default hook returns so the
+ *          service that detected the error returns without side effect.
+ * 
+ * @param [in] ModuleId      Module ID of the calling module.
+ * @param [in] InstanceId    Instance ID of the calling module.
+ * @param [in] ApiId         Service ID of the API that detected the error.
+ * @param [in] ErrorId       Development error code.
+ * @return Std_ReturnType    Always E_OK.
+ */
+Std_ReturnType Det_ReportError (uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+/**
+ * @brief Det_GetLastError is a service that returns the last reported error and the number of reports.
+ * 
+ * @details Service ID [hex] 0x80
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Reentrant
+ * 
+ * @param [out] Error        Pointer to where to store the last error.
+ */
+void Det_GetLastError (Det_ErrorType* Error);
+
+/* Called on every report, weak in Det.c so the application can break or log there */
+void Det_ErrorHook (uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+#endif /* DET_H */
@@ -0,0 +1,62 @@
+/**
+ * @file Mcal_Reg.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Register access abstraction used by the MCAL drivers
+ * @version 0.1
+ * @date 2022-08-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ * @details On target every access is a plain volatile load/store of the MMIO address.
+ *          When built with MCAL_HOST_SIM defined, the accesses go to the simulated
+ *          peripheral memory of Sim/Mcal_Sim.c so the drivers can run on the host.
+ */
+
+#ifndef MCAL_REG_H
+#define MCAL_REG_H
+
+#include "Std_types.h"
+
+#ifdef MCAL_HOST_SIM
+
+#include "Sim/Mcal_Sim.h"
+
+/* Read the 32-bit register at ADDRESS */
+#define MCAL_REG_READ32(ADDRESS)            Mcal_Sim_Read32((uint32)(ADDRESS))
+
+/* Write VALUE to the 32-bit register at ADDRESS */
+#define MCAL_REG_WRITE32(ADDRESS, VALUE)    Mcal_Sim_Write32((uint32)(ADDRESS), (uint32)(VALUE))
+
+/* Bus address of the RAM object at PTR of SIZE bytes, as programmed in a bus master (uDMA) */
+#define MCAL_RAM_ADDRESS(PTR, SIZE)         Mcal_Sim_MapMemory((PTR), (uint32)(SIZE))
+
+/* Busy wait of CYCLES system clocks, the simulated time advances instead */
+#define MCAL_DELAY_CYCLES(CYCLES)           Mcal_Sim_AdvanceClock((uint32)(CYCLES))
+
+#else
+
+/* Read the 32-bit register at ADDRESS */
+#define MCAL_REG_READ32(ADDRESS)            (*(volatile uint32 *)(ADDRESS))
+
+/* Write VALUE to the 32-bit register at ADDRESS */
+#define MCAL_REG_WRITE32(ADDRESS, VALUE)    (*(volatile uint32 *)(ADDRESS) = (uint32)(VALUE))
+
+/* Bus address of the RAM object at PTR of SIZE bytes, as programmed in a bus master (uDMA) */
+#define MCAL_RAM_ADDRESS(PTR, SIZE)         ((uint32)(PTR))
+
+/* Busy wait of CYCLES system clocks */
+#define MCAL_DELAY_CYCLES(CYCLES)           Mcal_DelayCycles((uint32)(CYCLES))
+
+/* Busy wait, one SUBS + taken BNE iteration is 3 clocks on the Cortex-M4 running from zero wait state memory */
+LOCAL_INLINE void Mcal_DelayCycles(uint32 Cycles)
+{
+    uint32 Count = Cycles / 3U;
+    if (Count != 0U)
+    {
+        __asm volatile ("1:\n\tsubs %0, %0, #1\n\tbne 1b" : "+r" (Count) : : "cc");
+    }
+}
+
+#endif
+
+#endif /* MCAL_REG_H */
@@ -0,0 +1,525 @@
+/**
+ * @file ParBus.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief ParBus.c is the source file for ParBus.h file which contains the implementation of the functions.
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include "ParBus.h"
+#include "ParBus_Private.h"
+
+/* Resolved bus */
+typedef struct
+{
+    uint32 lane_address[2];    // DATA apertures of the data lanes (bits 0..7, bits 8..15).
+    uint32 strobe_address;     // DATA aperture of the strobe.
+    uint32 strobe_active;      // Strobe level of the cycle.
+    uint32 strobe_idle;        // Strobe level between the cycles, the data is latched on the way back to it.
+    uint32 dc_address;         // DATA aperture of D/C.
+    uint32 dc_data;            // D/C level of a data cycle.
+    uint32 cs_address;         // DATA aperture of CS (mask 0, ignoring the stores, when tied).
+    uint32 cs_idle;            // CS level between the transfers.
+    boolean wide;              // 16-bit bus.
+}ParBus_ResolvedType;
+
+STATIC ParBus_ResolvedType ParBus_Buses[PARBUS_CONFIGURED_BUSES];
+STATIC uint8 ParBus_Status = PARBUS_NOT_INITIALIZED;         /* ParBus Status */
+
+#if (PARBUS_DMA_API == STD_ON)
+STATIC Dio_DmaControlType * ParBus_DmaControl[2];            /* Primary and alternate structures of the channel */
+STATIC uint32 ParBus_DmaChannelBit = 0U;                     /* Bit of the uDMA channel of the strobe port */
+STATIC uint32 ParBus_StrobeBase = 0U;                        /* GPIO base address of the strobe port */
+STATIC uint32 ParBus_StrobeMask = 0U;                        /* Strobe pin in its port */
+STATIC uint32 ParBus_TimerControl = 0U;                      /* GPTMCTL value of a running burst */
+STATIC const uint8 * ParBus_DmaNext = NULL_PTR;              /* First byte not armed yet */
+STATIC uint32 ParBus_DmaLeft = 0U;                           /* Bytes not armed yet */
+STATIC uint8 ParBus_DmaHalf = 0U;                            /* Structure completing next */
+STATIC volatile uint8 ParBus_DmaInFlight = 0U;               /* Structures armed and not completed */
+STATIC boolean ParBus_DmaActive = FALSE;                     /* Burst started and not released */
+STATIC boolean ParBus_DmaReady = FALSE;                      /* PARBUS_DMA_BUS can run uDMA bursts */
+#endif
+
+/* DATA aperture of channel ChannelId of DioConfig, the port base (mask 0) of PortId for PARBUS_NO_CHANNEL */
+STATIC uint32 ParBus_ChannelAddress(const Dio_ConfigType * DioConfig, Dio_ChannelType ChannelId, Dio_PortType PortId)
+{
+    if (ChannelId == PARBUS_NO_CHANNEL)
+    {
+        return DioConfig->PortBaseAddress[PortId];
+    }
+    return DioConfig->Channels[ChannelId].bits_address;
+}
+
+/* Pin mask of channel ChannelId of DioConfig, 0 for PARBUS_NO_CHANNEL */
+STATIC uint32 ParBus_ChannelMask(const Dio_ConfigType * DioConfig, Dio_ChannelType ChannelId)
+{
+    return (ChannelId == PARBUS_NO_CHANNEL) ? 0U : (uint32)DioConfig->Channels[ChannelId].mask;
+}
+
+/*
+ * One bus cycle: data lanes, strobe active, strobe idle. Expanded with a constant WIDE so the 8-bit loops keep
+ * no test.
+ */
+#define PARBUS_CYCLE(BUS, WORD, WIDE)                                                     \
+    do                                                                                    \
+    {                                                                                     \
+        PARBUS_WRITE_REG((BUS)->lane_address[0], (uint32)(WORD));                         \
+        if ((WIDE) == TRUE)                                                               \
+        {                                                                                 \
+            PARBUS_WRITE_REG((BUS)->lane_address[1], (uint32)(WORD) >> 8U);               \
+        }                                                                                 \
+        PARBUS_WRITE_REG((BUS)->strobe_address, (BUS)->strobe_active);                    \
+        PARBUS_WRITE_REG((BUS)->strobe_address, (BUS)->strobe_idle);                      \
+    } while (0)
+
+/* One strobe pulse, the data lanes keep their levels */
+#define PARBUS_STROBE(BUS)                                                                \
+    do                                                                                    \
+    {                                                                                     \
+        PARBUS_WRITE_REG((BUS)->strobe_address, (BUS)->strobe_active);                    \
+        PARBUS_WRITE_REG((BUS)->strobe_address, (BUS)->strobe_idle);                      \
+    } while (0)
+
+/* Data cycles of Length bytes on an 8-bit bus, 4 per iteration */
+LOCAL_INLINE void ParBus_Burst8(const ParBus_ResolvedType * Bus, const uint8 * Data, uint32 Length)
+{
+    uint32 Blocks = Length >> 2U;
+    while (Blocks > 0U)
+    {
+        PARBUS_CYCLE(Bus, Data[0], FALSE);
+        PARBUS_CYCLE(Bus, Data[1], FALSE);
+        PARBUS_CYCLE(Bus, Data[2], FALSE);
+        PARBUS_CYCLE(Bus, Data[3], FALSE);
+        Data += 4U;
+        Blocks--;
+    }
+    Length &= 3U;
+    while (Length > 0U)
+    {
+        PARBUS_CYCLE(Bus, *Data, FALSE);
+        Data++;
+        Length--;
+    }
+}
+
+/* Data cycles of Length words on a 16-bit bus, 4 per iteration */
+LOCAL_INLINE void ParBus_Burst16(const ParBus_ResolvedType * Bus, const uint16 * Data, uint32 Length)
+{
+    uint32 Blocks = Length >> 2U;
+    while (Blocks > 0U)
+    {
+        PARBUS_CYCLE(Bus, Data[0], TRUE);
+        PARBUS_CYCLE(Bus, Data[1], TRUE);
+        PARBUS_CYCLE(Bus, Data[2], TRUE);
+        PARBUS_CYCLE(Bus, Data[3], TRUE);
+        Data += 4U;
+        Blocks--;
+    }
+    Length &= 3U;
+    while (Length > 0U)
+    {
+        PARBUS_CYCLE(Bus, *Data, TRUE);
+        Data++;
+        Length--;
+    }
+}
+
+#if (PARBUS_DMA_API == STD_ON)
+/* Arms structure BufferIndex with the next chunk of the burst */
+STATIC void ParBus_ArmDmaHalf(uint8 BufferIndex)
+{
+    Dio_DmaControlType * Control = ParBus_DmaControl[BufferIndex];
+    uint32 Length = (ParBus_DmaLeft > PARBUS_DMA_MAX_CHUNK) ? PARBUS_DMA_MAX_CHUNK : ParBus_DmaLeft;
+
+    Control->SourceEnd = MCAL_RAM_ADDRESS(ParBus_DmaNext, Length) + (Length - 1U);
+    Control->DestinationEnd = ParBus_Buses[PARBUS_DMA_BUS].lane_address[0];
+    Control->Control = PARBUS_DMA_CHCTL(Length);
+    ParBus_DmaNext += Length;
+    ParBus_DmaLeft -= Length;
+    ParBus_DmaInFlight++;
+}
+
+/*
+ * Releases the strobe pin, the timer and the chip select once the last cycle is latched: every chunk completed
+ * and a timer timeout (the latching strobe edge) seen since the ISR stopped the strobe. Returns FALSE before.
+ */
+STATIC boolean ParBus_DmaFinished(void)
+{
+    if ((ParBus_DmaInFlight != 0U)
+        || ((PARBUS_TIMER_READ_REG(PARBUS_TIMER_RIS_REG_OFFSET) & TIMER_RIS_TATORIS) == 0U))
+    {
+        return FALSE;
+    }
+    PARBUS_WRITE_REG(ParBus_StrobeBase + PARBUS_GPIO_AFSEL_REG_OFFSET,
+                     PARBUS_READ_REG(ParBus_StrobeBase + PARBUS_GPIO_AFSEL_REG_OFFSET) & ~ParBus_StrobeMask);
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_CTL_REG_OFFSET, 0U);
+    PARBUS_WRITE_REG(ParBus_StrobeBase + PARBUS_GPIO_DMACTL_REG_OFFSET,
+                     PARBUS_READ_REG(ParBus_StrobeBase + PARBUS_GPIO_DMACTL_REG_OFFSET) & ~ParBus_StrobeMask);
+    PARBUS_WRITE_REG(PARBUS_UDMA_ENACLR_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(ParBus_Buses[PARBUS_DMA_BUS].cs_address, ParBus_Buses[PARBUS_DMA_BUS].cs_idle);
+    ParBus_DmaActive = FALSE;
+    return TRUE;
+}
+
+/* Sets up the wide timer, the strobe pin and the uDMA channel of PARBUS_DMA_BUS, FALSE when the bus is not an
+   8-bit bus strobed by the CCP0 pin of PARBUS_DMA_WIDE_TIMER */
+STATIC boolean ParBus_InitDma(const Dio_ConfigType * DioConfig, const ParBus_BusConfigType * Config)
+{
+    const Dio_ChannelConfigType * Strobe = &DioConfig->Channels[Config->strobe];
+    uint32 Channel = PARBUS_GPIO_UDMA_CHANNEL(PARBUS_DMA_CCP_PORT);
+    uint32 TimerBit = 1UL << PARBUS_DMA_WIDE_TIMER;
+    uint32 Address;
+
+    if ((Config->data[1] != PARBUS_NO_GROUP) || (Strobe->port != PARBUS_DMA_CCP_PORT)
+        || (Strobe->mask != (1UL << PARBUS_DMA_CCP_PIN)))
+    {
+        return FALSE;
+    }
+    ParBus_DmaControl[0] = Dio_GetDmaControl((uint8)Channel, 0U);
+    ParBus_DmaControl[1] = Dio_GetDmaControl((uint8)Channel, 1U);
+    if ((ParBus_DmaControl[0] == NULL_PTR) || (ParBus_DmaControl[1] == NULL_PTR))
+    {
+        return FALSE;
+    }
+    ParBus_DmaChannelBit = 1UL << Channel;
+    ParBus_StrobeBase = DioConfig->PortBaseAddress[Strobe->port];
+    ParBus_StrobeMask = Strobe->mask;
+    ParBus_TimerControl = TIMER_CTL_TAEN | ((Config->protocol == PARBUS_6800) ? TIMER_CTL_TAPWML : 0U);
+
+    /* Timer A in PWM mode: the output is in its idle state from the reload to the match, active after it */
+    if ((PARBUS_READ_REG(PARBUS_RCGCWTIMER_REGISTER_ADDRESS) & TimerBit) == 0U)
+    {
+        PARBUS_WRITE_REG(PARBUS_RCGCWTIMER_REGISTER_ADDRESS, PARBUS_READ_REG(PARBUS_RCGCWTIMER_REGISTER_ADDRESS) | TimerBit);
+        while ((PARBUS_READ_REG(PARBUS_PRWTIMER_REGISTER_ADDRESS) & TimerBit) == 0U);
+    }
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_CTL_REG_OFFSET, 0U);
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_CFG_REG_OFFSET, TIMER_CFG_16_BIT);   /* 32-bit timer A of the wide timer */
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_TAMR_REG_OFFSET, TIMER_TAMR_TAAMS | TIMER_TAMR_TAMR_PERIOD);
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_TAILR_REG_OFFSET, PARBUS_DMA_STROBE_PERIOD_CLOCKS - 1U);
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_TAMATCHR_REG_OFFSET, PARBUS_TIMER_NO_MATCH);
+
+    /* CCP function selected on the strobe pin, switched to it by AFSEL for the bursts only; the leading strobe
+       edge (falling for 8080, rising for 6800) is the uDMA trigger */
+    Address = ParBus_StrobeBase + PARBUS_GPIO_PCTL_REG_OFFSET;
+    PARBUS_WRITE_REG(Address, (PARBUS_READ_REG(Address) & ~(0xFUL << (PARBUS_DMA_CCP_PIN * 4U)))
+                              | ((uint32)PARBUS_GPIO_PCTL_CCP << (PARBUS_DMA_CCP_PIN * 4U)));
+    Address = ParBus_StrobeBase + PARBUS_GPIO_IS_REG_OFFSET;
+    PARBUS_WRITE_REG(Address, PARBUS_READ_REG(Address) & ~ParBus_StrobeMask);
+    Address = ParBus_StrobeBase + PARBUS_GPIO_IBE_REG_OFFSET;
+    PARBUS_WRITE_REG(Address, PARBUS_READ_REG(Address) & ~ParBus_StrobeMask);
+    Address = ParBus_StrobeBase + PARBUS_GPIO_IEV_REG_OFFSET;
+    PARBUS_WRITE_REG(Address, (Config->protocol == PARBUS_6800) ? (PARBUS_READ_REG(Address) | ParBus_StrobeMask)
+                                                                : (PARBUS_READ_REG(Address) & ~ParBus_StrobeMask));
+
+    /* GPIO trigger, default priority, single requests and primary structure first */
+    PARBUS_WRITE_REG(PARBUS_UDMA_CHMAP_ADDRESS(Channel),
+                     (PARBUS_READ_REG(PARBUS_UDMA_CHMAP_ADDRESS(Channel)) & ~(0xFUL << PARBUS_UDMA_CHMAP_SHIFT(Channel)))
+                     | ((uint32)PARBUS_UDMA_GPIO_ENCODING << PARBUS_UDMA_CHMAP_SHIFT(Channel)));
+    PARBUS_WRITE_REG(PARBUS_UDMA_PRIOCLR_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(PARBUS_UDMA_ALTCLR_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(PARBUS_UDMA_USEBURSTCLR_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(PARBUS_UDMA_REQMASKCLR_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(PARBUS_NVIC_EN_REGISTER_ADDRESS(PARBUS_GPIO_IRQ(PARBUS_DMA_CCP_PORT)),
+                     PARBUS_NVIC_BIT(PARBUS_GPIO_IRQ(PARBUS_DMA_CCP_PORT)));
+    ParBus_DmaInFlight = 0U;
+    return TRUE;
+}
+#endif
+
+/* E_OK when the module is initialized, Bus is valid and no uDMA burst runs on it */
+STATIC Std_ReturnType ParBus_CheckBus(ParBus_BusType Bus)
+{
+    if ((ParBus_Status != PARBUS_INITIALIZED) || (Bus >= PARBUS_CONFIGURED_BUSES))
+    {
+        return E_NOT_OK;
+    }
+    return (ParBus_GetStatus(Bus) == PARBUS_IDLE) ? E_OK : E_NOT_OK;
+}
+
+/**
+ * @brief ParBus_Init is a service that resolves the bus pins and puts every bus in its idle state.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] ConfigPtr         Pointer to the post-build configuration set.
+ */
+void ParBus_Init (const ParBus_ConfigType* ConfigPtr){
+    const Dio_ConfigType * DioConfig = Dio_GetConfig();
+    uint8 Index;
+
+    ParBus_Status = PARBUS_NOT_INITIALIZED;
+    if ((ConfigPtr == NULL_PTR) || (DioConfig == NULL_PTR))
+    {
+        return;
+    }
+    for (Index = 0U; Index < PARBUS_CONFIGURED_BUSES; Index++)
+    {
+        const ParBus_BusConfigType * Config = &ConfigPtr->Buses[Index];
+        ParBus_ResolvedType * Bus = &ParBus_Buses[Index];
+        const Dio_ChannelConfigType * Strobe = &DioConfig->Channels[Config->strobe];
+        const Dio_ChannelGroupType * Low;
+        const Dio_ChannelGroupType * High;
+        uint32 ReadMask = ParBus_ChannelMask(DioConfig, Config->read);
+
+        /* A data lane is a whole port: its aperture takes the byte as it is */
+        if ((Config->data[0] >= DIO_CONFIGURED_GROUPS)
+            || ((Config->data[1] != PARBUS_NO_GROUP) && (Config->data[1] >= DIO_CONFIGURED_GROUPS)))
+        {
+            return;
+        }
+        Low = &DioConfig->Groups[Config->data[0]];
+        High = (Config->data[1] != PARBUS_NO_GROUP) ? &DioConfig->Groups[Config->data[1]] : Low;
+        if ((Low->mask != 0xFFU) || (High->mask != 0xFFU))
+        {
+            return;
+        }
+        Bus->wide = (Config->data[1] != PARBUS_NO_GROUP) ? TRUE : FALSE;
+        Bus->lane_address[0] = Low->bits_address;
+        Bus->lane_address[1] = High->bits_address;
+        Bus->strobe_address = Strobe->bits_address;
+        Bus->strobe_idle = (Config->protocol == PARBUS_8080) ? Strobe->mask : 0U;
+        Bus->strobe_active = Strobe->mask ^ Bus->strobe_idle;
+        Bus->dc_address = DioConfig->Channels[Config->dc].bits_address;
+        Bus->dc_data = DioConfig->Channels[Config->dc].mask;
+        Bus->cs_address = ParBus_ChannelAddress(DioConfig, Config->cs, Strobe->port);
+        Bus->cs_idle = ParBus_ChannelMask(DioConfig, Config->cs);
+
+        /* Idle bus: chip deselected first so no cycle is seen, RD high (8080) or R/W low for a write (6800),
+           strobe idle */
+        PARBUS_WRITE_REG(Bus->cs_address, Bus->cs_idle);
+        PARBUS_WRITE_REG(ParBus_ChannelAddress(DioConfig, Config->read, Strobe->port),
+                         (Config->protocol == PARBUS_8080) ? ReadMask : 0U);
+        PARBUS_WRITE_REG(Bus->dc_address, Bus->dc_data);
+        PARBUS_WRITE_REG(Bus->strobe_address, Bus->strobe_idle);
+    }
+#if (PARBUS_DMA_API == STD_ON)
+    ParBus_DmaActive = FALSE;
+    ParBus_DmaReady = ParBus_InitDma(DioConfig, &ConfigPtr->Buses[PARBUS_DMA_BUS]);
+#endif
+    ParBus_Status = PARBUS_INITIALIZED;
+}
+
+/**
+ * @brief ParBus_WriteCommand is a service that writes one command cycle (D/C low).
+ *
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               Bus.
+ * @param [in] Command           Command, bits 8..15 are ignored on an 8-bit bus.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, the bus is invalid or busy.
+ */
+Std_ReturnType ParBus_WriteCommand (ParBus_BusType Bus, uint16 Command){
+    const ParBus_ResolvedType * Resolved;
+
+    if (ParBus_CheckBus(Bus) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    Resolved = &ParBus_Buses[Bus];
+    PARBUS_WRITE_REG(Resolved->cs_address, 0U);
+    PARBUS_WRITE_REG(Resolved->dc_address, 0U);
+    if (Resolved->wide == TRUE)
+    {
+        PARBUS_CYCLE(Resolved, Command, TRUE);
+    }
+    else
+    {
+        PARBUS_CYCLE(Resolved, Command, FALSE);
+    }
+    PARBUS_WRITE_REG(Resolved->dc_address, Resolved->dc_data);
+    PARBUS_WRITE_REG(Resolved->cs_address, Resolved->cs_idle);
+    return E_OK;
+}
+
+/**
+ * @brief ParBus_WriteBurst is a service that writes a block of data cycles (D/C high).
+ *
+ * @details Service ID [hex] 0x02
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               Bus.
+ * @param [in] Data              Data words: uint8 on an 8-bit bus, uint16 on a 16-bit bus.
+ * @param [in] Length            Number of data words.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, a parameter is invalid or
+ *                               the bus is busy.
+ */
+Std_ReturnType ParBus_WriteBurst (ParBus_BusType Bus, const void* Data, uint32 Length){
+    const ParBus_ResolvedType * Resolved;
+
+    if ((ParBus_CheckBus(Bus) != E_OK) || (Data == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    Resolved = &ParBus_Buses[Bus];
+    PARBUS_WRITE_REG(Resolved->cs_address, 0U);
+    if (Resolved->wide == TRUE)
+    {
+        ParBus_Burst16(Resolved, (const uint16 *)Data, Length);
+    }
+    else
+    {
+        ParBus_Burst8(Resolved, (const uint8 *)Data, Length);
+    }
+    PARBUS_WRITE_REG(Resolved->cs_address, Resolved->cs_idle);
+    return E_OK;
+}
+
+/**
+ * @brief ParBus_Fill is a service that writes the same data word Count times (D/C high).
+ *
+ * @details Service ID [hex] 0x03
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               Bus.
+ * @param [in] Word              Data word, bits 8..15 are ignored on an 8-bit bus.
+ * @param [in] Count             Number of data cycles.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, the bus is invalid or busy.
+ */
+Std_ReturnType ParBus_Fill (ParBus_BusType Bus, uint16 Word, uint32 Count){
+    const ParBus_ResolvedType * Resolved;
+    uint32 Blocks;
+
+    if (ParBus_CheckBus(Bus) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    Resolved = &ParBus_Buses[Bus];
+    PARBUS_WRITE_REG(Resolved->cs_address, 0U);
+    PARBUS_WRITE_REG(Resolved->lane_address[0], (uint32)Word);
+    PARBUS_WRITE_REG(Resolved->lane_address[1], (Resolved->wide == TRUE) ? ((uint32)Word >> 8U) : (uint32)Word);
+    Blocks = Count >> 2U;
+    while (Blocks > 0U)
+    {
+        PARBUS_STROBE(Resolved);
+        PARBUS_STROBE(Resolved);
+        PARBUS_STROBE(Resolved);
+        PARBUS_STROBE(Resolved);
+        Blocks--;
+    }
+    Count &= 3U;
+    while (Count > 0U)
+    {
+        PARBUS_STROBE(Resolved);
+        Count--;
+    }
+    PARBUS_WRITE_REG(Resolved->cs_address, Resolved->cs_idle);
+    return E_OK;
+}
+
+#if (PARBUS_DMA_API == STD_ON)
+/**
+ * @brief ParBus_WriteBurstDma is a service that starts a block of data cycles (D/C high) paced by the hardware.
+ *
+ * @details Service ID [hex] 0x04
+ *          Synchronous/Asynchronous: Asynchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] Bus               Bus, only PARBUS_DMA_BUS.
+ * @param [in] Data              Bytes.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, a parameter is invalid, the
+ *                               bus cannot run uDMA bursts or is busy.
+ */
+Std_ReturnType ParBus_WriteBurstDma (ParBus_BusType Bus, const uint8* Data, uint32 Length){
+    const ParBus_ResolvedType * Resolved;
+
+    if ((ParBus_CheckBus(Bus) != E_OK) || (Bus != PARBUS_DMA_BUS) || (ParBus_DmaReady == FALSE) || (Data == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    if (Length == 0U)
+    {
+        return E_OK;
+    }
+    Resolved = &ParBus_Buses[Bus];
+    PARBUS_WRITE_REG(Resolved->cs_address, 0U);
+
+    /* Both structures armed, the alternate one stopped when the first chunk holds the whole burst */
+    ParBus_DmaNext = Data;
+    ParBus_DmaLeft = Length;
+    ParBus_DmaHalf = 0U;
+    ParBus_DmaInFlight = 0U;
+    ParBus_ArmDmaHalf(0U);
+    if (ParBus_DmaLeft != 0U)
+    {
+        ParBus_ArmDmaHalf(1U);
+    }
+    else
+    {
+        ParBus_DmaControl[1]->Control = UDMA_CHCTL_XFERMODE_STOP;
+    }
+    ParBus_DmaActive = TRUE;
+    PARBUS_WRITE_REG(PARBUS_UDMA_ALTCLR_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(PARBUS_UDMA_ENASET_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(ParBus_StrobeBase + PARBUS_GPIO_ICR_REG_OFFSET, ParBus_StrobeMask);
+    PARBUS_WRITE_REG(ParBus_StrobeBase + PARBUS_GPIO_DMACTL_REG_OFFSET,
+                     PARBUS_READ_REG(ParBus_StrobeBase + PARBUS_GPIO_DMACTL_REG_OFFSET) | ParBus_StrobeMask);
+
+    /* The strobe starts in its idle state at the reload, the first leading edge comes at the first match */
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_TAMATCHR_REG_OFFSET, PARBUS_DMA_STROBE_ACTIVE_CLOCKS - 1U);
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_ICR_REG_OFFSET, TIMER_ICR_TATOCINT);
+    PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_CTL_REG_OFFSET, ParBus_TimerControl);
+    PARBUS_WRITE_REG(ParBus_StrobeBase + PARBUS_GPIO_AFSEL_REG_OFFSET,
+                     PARBUS_READ_REG(ParBus_StrobeBase + PARBUS_GPIO_AFSEL_REG_OFFSET) | ParBus_StrobeMask);
+    return E_OK;
+}
+
+/*
+ * uDMA completion of one structure: the next chunk goes to it, or the strobe is stopped in its idle state after
+ * the last one. The timeout status is cleared with it, so the next timeout is the latching edge of the last cycle.
+ */
+void ParBus_Dma_Isr (void){
+    PARBUS_WRITE_REG(PARBUS_UDMA_CHIS_REGISTER_ADDRESS, ParBus_DmaChannelBit);
+    PARBUS_WRITE_REG(ParBus_StrobeBase + PARBUS_GPIO_ICR_REG_OFFSET, ParBus_StrobeMask);
+    if (ParBus_DmaInFlight == 0U)
+    {
+        return;
+    }
+    if (ParBus_DmaLeft != 0U)
+    {
+        ParBus_DmaInFlight--;
+        ParBus_ArmDmaHalf(ParBus_DmaHalf);
+    }
+    else if (ParBus_DmaInFlight == 1U)
+    {
+        PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_TAMATCHR_REG_OFFSET, PARBUS_TIMER_NO_MATCH);
+        PARBUS_TIMER_WRITE_REG(PARBUS_TIMER_ICR_REG_OFFSET, TIMER_ICR_TATOCINT);
+        ParBus_DmaInFlight = 0U;
+    }
+    else
+    {
+        ParBus_DmaInFlight--;
+    }
+    ParBus_DmaHalf ^= 1U;
+}
+#endif
+
+/**
+ * @brief ParBus_GetStatus is a service that tells if a bus is still running a uDMA burst.
+ *
+ * @details Service ID [hex] 0x05
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] Bus               Bus.
+ * @return ParBus_StatusType     PARBUS_BUSY while the last cycle is not latched, PARBUS_IDLE otherwise.
+ */
+ParBus_StatusType ParBus_GetStatus (ParBus_BusType Bus){
+#if (PARBUS_DMA_API == STD_ON)
+    if ((Bus == PARBUS_DMA_BUS) && (ParBus_DmaActive == TRUE) && (ParBus_DmaFinished() == FALSE))
+    {
+        return PARBUS_BUSY;
+    }
+#else
+    (void)Bus;
+#endif
+    return PARBUS_IDLE;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file ParBus.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief ParBus file used for the 8080/6800 parallel bus master on DIO channels types and functions prototypes
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Master side of the write cycles of the 8080 (WR strobe, active low, data latched on its rising
+ *          edge) and 6800 (E strobe, active high, data latched on its falling edge) parallel buses of display
+ *          and memory controllers. The data lanes are DIO channel groups and the control lines DIO channels;
+ *          ParBus_Init resolves them once to DATA apertures and store values, so a bus cycle is three stores
+ *          (data, strobe active, strobe idle) and the block loops are unrolled by 4. The DIO services are not
+ *          used on the bus pins: they must be left out of the DIO output shadow (DioConf_<PORT>_SHADOW_PINS).
+ *          The uDMA burst hands the cycles to the hardware: timer A of a wide timer generates the strobe in
+ *          PWM mode on its CCP0 pin, and the GPIO uDMA trigger of that pin stores the next byte to the data
+ *          lane on every leading strobe edge, so the CPU only re-arms the ping-pong halves every 1024 bytes.
+ */
+#ifndef PARBUS_H
+#define PARBUS_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define PARBUS_SW_MAJOR_VERSION           (1U)
+#define PARBUS_SW_MINOR_VERSION           (0U)
+#define PARBUS_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define PARBUS_AR_RELEASE_MAJOR_VERSION   (4U)
+#define PARBUS_AR_RELEASE_MINOR_VERSION   (6U)
+#define PARBUS_AR_RELEASE_PATCH_VERSION   (0U)
+
+/*
+ * Macros for ParBus Status
+ */
+#define PARBUS_INITIALIZED                (1U)
+#define PARBUS_NOT_INITIALIZED            (0U)
+
+#include "../Std_types.h"
+#include "../DIO/DIO.h"
+#include "ParBus_Cfg.h"
+
+/* AUTOSAR checking between Std Types and ParBus Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != PARBUS_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != PARBUS_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != PARBUS_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* AUTOSAR Version checking between ParBus_Cfg.h and ParBus.h files */
+#if ((PARBUS_CFG_AR_RELEASE_MAJOR_VERSION != PARBUS_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PARBUS_CFG_AR_RELEASE_MINOR_VERSION != PARBUS_AR_RELEASE_MINOR_VERSION)\
+ ||  (PARBUS_CFG_AR_RELEASE_PATCH_VERSION != PARBUS_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of ParBus_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between ParBus_Cfg.h and ParBus.h files */
+#if ((PARBUS_CFG_SW_MAJOR_VERSION != PARBUS_SW_MAJOR_VERSION)\
+ ||  (PARBUS_CFG_SW_MINOR_VERSION != PARBUS_SW_MINOR_VERSION)\
+ ||  (PARBUS_CFG_SW_PATCH_VERSION != PARBUS_SW_PATCH_VERSION))
+  #error "The SW version of ParBus_Cfg.h does not match the expected version"
+#endif
+
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for ParBus Init */
+#define PARBUS_INIT_SID                   (uint8)0x00
+
+/* Service ID for ParBus Write Command */
+#define PARBUS_WRITE_COMMAND_SID          (uint8)0x01
+
+/* Service ID for ParBus Write Burst */
+#define PARBUS_WRITE_BURST_SID            (uint8)0x02
+
+/* Service ID for ParBus Fill */
+#define PARBUS_FILL_SID                   (uint8)0x03
+
+/* Service ID for ParBus Write Burst Dma */
+#define PARBUS_WRITE_BURST_DMA_SID        (uint8)0x04
+
+/* Service ID for ParBus Get Status */
+#define PARBUS_GET_STATUS_SID             (uint8)0x05
+
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef uint8 ParBus_BusType;  /**< Index of a bus in the configuration set */
+
+/* Enum to hold the bus protocol */
+typedef enum
+{
+    PARBUS_8080,   //!< 0x00 WR strobe active low, data latched on its rising edge, RD held high.
+    PARBUS_6800    //!< 0x01 E strobe active high, data latched on its falling edge, R/W held low.
+}ParBus_ProtocolType;
+
+/* Enum to hold the state of a bus */
+typedef enum
+{
+    PARBUS_IDLE,   //!< 0x00 No transfer running.
+    PARBUS_BUSY    //!< 0x01 A uDMA burst is running.
+}ParBus_StatusType;
+
+/* Channel ID of an unused control line (tied on the board) */
+#define PARBUS_NO_CHANNEL                 (0xFFU)
+
+/* Channel group index of the unused high data lane of an 8-bit bus */
+#define PARBUS_NO_GROUP                   (0xFFU)
+
+/**
+ * @brief Configuration of one bus, the data lanes are channel groups of 8 pins and the control lines channels,
+ *        resolved in the DIO configuration set given to Dio_Init.
+ *
+ */
+typedef struct
+{
+    uint8 data[2];                         // DIO channel group indexes of data bits 0..7 and 8..15, data[1] is PARBUS_NO_GROUP for an 8-bit bus.
+    Dio_ChannelType strobe;                // WR (8080) or E (6800).
+    Dio_ChannelType read;                  // RD (8080) or R/W (6800), held at its write level, or PARBUS_NO_CHANNEL.
+    Dio_ChannelType dc;                    // D/C (RS): low for a command, high for data.
+    Dio_ChannelType cs;                    // Chip select, active low, or PARBUS_NO_CHANNEL.
+    ParBus_ProtocolType protocol;          // Strobe polarity and latching edge.
+}ParBus_BusConfigType;
+
+/* Definition of the post-build configuration structure used by ParBus_Init.
+ * Member Buses holds the buses indexed by the ParBusConf_<NAME>_BUS symbols.
+ */
+typedef struct
+{
+    ParBus_BusConfigType Buses[PARBUS_CONFIGURED_BUSES];
+}ParBus_ConfigType;
+
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+/**
+ * @brief ParBus_Init is a service that resolves the bus pins and puts every bus in its idle state.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          The pins take their addresses from the DIO configuration set Dio_Init was called with, so Dio_Init
+ *          must have been called, and Port_Init must have configured them as outputs. With PARBUS_DMA_API the wide timer and the uDMA channel of the strobe port are set up for
+ *          PARBUS_DMA_BUS when it is an 8-bit bus whose strobe is the CCP0 pin of PARBUS_DMA_WIDE_TIMER. A
+ *          data lane that is not a whole port leaves the module uninitialized.
+ *
+ * @param [in] ConfigPtr         Pointer to the post-build configuration set.
+ */
+void ParBus_Init (const ParBus_ConfigType* ConfigPtr);
+
+/**
+ * @brief ParBus_WriteCommand is a service that writes one command cycle (D/C low).
+ *
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ *          The chip select is asserted for the cycle only, parameters follow with ParBus_WriteBurst.
+ *
+ * @param [in] Bus               Bus.
+ * @param [in] Command           Command, bits 8..15 are ignored on an 8-bit bus.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, the bus is invalid or busy.
+ */
+Std_ReturnType ParBus_WriteCommand (ParBus_BusType Bus, uint16 Command);
+
+/**
+ * @brief ParBus_WriteBurst is a service that writes a block of data cycles (D/C high).
+ *
+ * @details Service ID [hex] 0x02
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ *          A cycle costs one store per data lane and two strobe stores, 4 cycles per loop iteration.
+ *
+ * @param [in] Bus               Bus.
+ * @param [in] Data              Data words: uint8 on an 8-bit bus, uint16 on a 16-bit bus.
+ * @param [in] Length            Number of data words.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, a parameter is invalid or
+ *                               the bus is busy.
+ */
+Std_ReturnType ParBus_WriteBurst (ParBus_BusType Bus, const void* Data, uint32 Length);
+
+/**
+ * @brief ParBus_Fill is a service that writes the same data word Count times (D/C high).
+ *
+ * @details Service ID [hex] 0x03
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ *          The data lanes are written once, then only the strobe toggles: two stores per cycle.
+ *
+ * @param [in] Bus               Bus.
+ * @param [in] Word              Data word, bits 8..15 are ignored on an 8-bit bus.
+ * @param [in] Count             Number of data cycles.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, the bus is invalid or busy.
+ */
+Std_ReturnType ParBus_Fill (ParBus_BusType Bus, uint16 Word, uint32 Count);
+
+#if (PARBUS_DMA_API == STD_ON)
+/**
+ * @brief ParBus_WriteBurstDma is a service that starts a block of data cycles (D/C high) paced by the hardware.
+ *
+ * @details Service ID [hex] 0x04
+ *          Synchronous/Asynchronous: Asynchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          One cycle every PARBUS_DMA_STROBE_PERIOD_CLOCKS, the CPU is free during the burst except for one
+ *          interrupt every 1024 bytes. Data must stay unchanged until ParBus_GetStatus returns PARBUS_IDLE, the
+ *          other services of the bus return E_NOT_OK meanwhile.
+ *
+ * @param [in] Bus               Bus, only PARBUS_DMA_BUS.
+ * @param [in] Data              Bytes.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized, a parameter is invalid, the
+ *                               bus cannot run uDMA bursts or is busy.
+ */
+Std_ReturnType ParBus_WriteBurstDma (ParBus_BusType Bus, const uint8* Data, uint32 Length);
+
+/* Interrupt handler of the uDMA completions of PARBUS_DMA_BUS, to be placed in the vector table of the GPIO port
+   of its strobe instead of the Dio_GpioPort<X>_Isr handler */
+void ParBus_Dma_Isr (void);
+#endif
+
+/**
+ * @brief ParBus_GetStatus is a service that tells if a bus is still running a uDMA burst.
+ *
+ * @details Service ID [hex] 0x05
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          The first call that finds the burst over releases the strobe pin and the chip select.
+ *
+ * @param [in] Bus               Bus.
+ * @return ParBus_StatusType     PARBUS_BUSY while the last cycle is not latched, PARBUS_IDLE otherwise.
+ */
+ParBus_StatusType ParBus_GetStatus (ParBus_BusType Bus);
+
+/* Extern PB structures to be used by ParBus and other modules */
+extern const ParBus_ConfigType ParBus_Configuration;
+
+#endif /* PARBUS_H */
@@ -0,0 +1,53 @@
+/**
+ * @file ParBus_Cfg.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - ParBus Driver
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef PARBUS_CFG_H
+#define PARBUS_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define PARBUS_CFG_SW_MAJOR_VERSION              (1U)
+#define PARBUS_CFG_SW_MINOR_VERSION              (0U)
+#define PARBUS_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define PARBUS_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PARBUS_CFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define PARBUS_CFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* System clock frequency the strobe timings are computed for */
+#define PARBUS_SYSTEM_CLOCK_HZ                 (16000000UL)
+
+/* Pre-compile option for the uDMA burst (ParBus_WriteBurstDma), needs DIO_SHARED_DMA_API */
+#define PARBUS_DMA_API                         (STD_ON)
+
+/* Wide timer (0..5) whose timer A generates the strobe of the uDMA burst on its CCP0 pin:
+   WT0CCP0 PC4, WT1CCP0 PC6, WT2CCP0 PD0, WT3CCP0 PD2, WT4CCP0 PD4, WT5CCP0 PD6 */
+#define PARBUS_DMA_WIDE_TIMER                  (1U)
+
+/* Strobe period of the uDMA burst (one bus cycle) and its active part, in system clocks. The completion
+   interrupt of the last transfer must stop the strobe within one period. */
+#define PARBUS_DMA_STROBE_PERIOD_CLOCKS        (32U)
+#define PARBUS_DMA_STROBE_ACTIVE_CLOCKS        (16U)
+
+/* Number of buses */
+#define PARBUS_CONFIGURED_BUSES                (1U)
+
+/* Bus 0: 8080 TFT controller, data on the DISPLAY_BUS group (PB0..PB7), CS PC4, D/C PC5, WR PC6, RD PC7 */
+#define ParBusConf_TFT_BUS                     (0U)
+
+/* Bus using the uDMA burst, its strobe must be the CCP0 pin of PARBUS_DMA_WIDE_TIMER */
+#define PARBUS_DMA_BUS                         ParBusConf_TFT_BUS
+
+#endif /* PARBUS_CFG_H */
@@ -0,0 +1,52 @@
+/**
+ * @file ParBus_PBcfg.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Post Build Configuration Source file for TM4C123GH6PM Microcontroller - ParBus Driver
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "ParBus.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define PARBUS_PBCFG_SW_MAJOR_VERSION              (1U)
+#define PARBUS_PBCFG_SW_MINOR_VERSION              (0U)
+#define PARBUS_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define PARBUS_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PARBUS_PBCFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define PARBUS_PBCFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* AUTOSAR Version checking between ParBus_PBcfg.c and ParBus.h files */
+#if ((PARBUS_PBCFG_AR_RELEASE_MAJOR_VERSION != PARBUS_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PARBUS_PBCFG_AR_RELEASE_MINOR_VERSION != PARBUS_AR_RELEASE_MINOR_VERSION)\
+ ||  (PARBUS_PBCFG_AR_RELEASE_PATCH_VERSION != PARBUS_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between ParBus_PBcfg.c and ParBus.h files */
+#if ((PARBUS_PBCFG_SW_MAJOR_VERSION != PARBUS_SW_MAJOR_VERSION)\
+ ||  (PARBUS_PBCFG_SW_MINOR_VERSION != PARBUS_SW_MINOR_VERSION)\
+ ||  (PARBUS_PBCFG_SW_PATCH_VERSION != PARBUS_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/*Configuration structure that will be used by the ParBus driver, every bus is listed by the DIO channel
+  group indexes of its data lanes and the DIO channel IDs of its control lines. They are resolved by ParBus_Init
+  in the DIO configuration set Dio_Init was called with.*/
+
+const ParBus_ConfigType ParBus_Configuration =
+{
+    {
+        { { DioConf_DISPLAY_BUS_GROUP_INDEX, PARBUS_NO_GROUP }, DioConf_TFT_WR_CHANNEL_ID, DioConf_TFT_RD_CHANNEL_ID,
+          DioConf_TFT_DC_CHANNEL_ID, DioConf_TFT_CS_CHANNEL_ID, PARBUS_8080 }
+    }
+};
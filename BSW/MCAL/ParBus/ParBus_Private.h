@@ -0,0 +1,111 @@
+/**
+ * @file ParBus_Private.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief ParBus Private Registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef PARBUS_PRIVATE_H
+#define PARBUS_PRIVATE_H
+
+#include "../tm4c123gh6pm.h"
+#include "../Mcal_Reg.h"
+
+/* Address of the DATA register aperture that only reaches the pins set in MASK */
+#define PARBUS_DATA_BITS_ADDRESS(BASE, MASK) ((BASE) + ((uint32)(MASK) << 2U))
+
+/* Read/Write a register through its absolute address */
+#define PARBUS_READ_REG(ADDRESS)             MCAL_REG_READ32(ADDRESS)
+#define PARBUS_WRITE_REG(ADDRESS, VALUE)     MCAL_REG_WRITE32(ADDRESS, VALUE)
+
+#if (PARBUS_DMA_API == STD_ON)
+#if (DIO_SHARED_DMA_API != STD_ON)
+#error "PARBUS_DMA_API needs DIO_SHARED_DMA_API (the uDMA control table belongs to DIO)"
+#endif
+
+#if (PARBUS_DMA_WIDE_TIMER > 5U)
+#error "PARBUS_DMA_WIDE_TIMER must be 0..5"
+#endif
+
+#if ((PARBUS_DMA_STROBE_ACTIVE_CLOCKS == 0U) || (PARBUS_DMA_STROBE_ACTIVE_CLOCKS >= PARBUS_DMA_STROBE_PERIOD_CLOCKS))
+#error "PARBUS_DMA_STROBE_ACTIVE_CLOCKS must be in 1..PARBUS_DMA_STROBE_PERIOD_CLOCKS - 1"
+#endif
+
+/* GPIO registers offsets: interrupt sense/both edges/event, clear, alternate function, port control, uDMA trigger */
+#define PARBUS_GPIO_IS_REG_OFFSET            0x404U
+#define PARBUS_GPIO_IBE_REG_OFFSET           0x408U
+#define PARBUS_GPIO_IEV_REG_OFFSET           0x40CU
+#define PARBUS_GPIO_ICR_REG_OFFSET           0x41CU
+#define PARBUS_GPIO_AFSEL_REG_OFFSET         0x420U
+#define PARBUS_GPIO_PCTL_REG_OFFSET          0x52CU
+#define PARBUS_GPIO_DMACTL_REG_OFFSET        0x534U
+
+/* GPIOPCTL value of a timer CCP pin */
+#define PARBUS_GPIO_PCTL_CCP                 (7U)
+
+/* Clock gating and peripheral ready registers of the wide timers */
+#define PARBUS_RCGCWTIMER_REGISTER_ADDRESS   0x400FE65CU
+#define PARBUS_PRWTIMER_REGISTER_ADDRESS     0x400FEA5CU
+
+/* Timer A registers of PARBUS_DMA_WIDE_TIMER (WT0, WT1 at 0x40036000, WT2..WT5 at 0x4004C000) */
+#define PARBUS_TIMER_BASE_ADDRESS                                     \
+    ((PARBUS_DMA_WIDE_TIMER < 2U) ? (0x40036000U + ((uint32)PARBUS_DMA_WIDE_TIMER * 0x1000U)) \
+                                  : (0x4004C000U + (((uint32)PARBUS_DMA_WIDE_TIMER - 2U) * 0x1000U)))
+#define PARBUS_TIMER_CFG_REG_OFFSET          0x000U
+#define PARBUS_TIMER_TAMR_REG_OFFSET         0x004U
+#define PARBUS_TIMER_CTL_REG_OFFSET          0x00CU
+#define PARBUS_TIMER_RIS_REG_OFFSET          0x01CU
+#define PARBUS_TIMER_ICR_REG_OFFSET          0x024U
+#define PARBUS_TIMER_TAILR_REG_OFFSET        0x028U
+#define PARBUS_TIMER_TAMATCHR_REG_OFFSET     0x030U
+
+/* Read/Write a timer register */
+#define PARBUS_TIMER_READ_REG(OFFSET)        MCAL_REG_READ32(PARBUS_TIMER_BASE_ADDRESS + (OFFSET))
+#define PARBUS_TIMER_WRITE_REG(OFFSET, VALUE) MCAL_REG_WRITE32(PARBUS_TIMER_BASE_ADDRESS + (OFFSET), VALUE)
+
+/* Port and pin of the CCP0 output of PARBUS_DMA_WIDE_TIMER */
+#define PARBUS_DMA_CCP_PORT                  ((PARBUS_DMA_WIDE_TIMER < 2U) ? PORTC : PORTD)
+#define PARBUS_DMA_CCP_PIN                   ((PARBUS_DMA_WIDE_TIMER < 2U) ? (4U + (2U * (uint32)PARBUS_DMA_WIDE_TIMER)) \
+                                                                           : (2U * ((uint32)PARBUS_DMA_WIDE_TIMER - 2U)))
+
+/* Match value above the period: the PWM output stays in its reload (idle) state */
+#define PARBUS_TIMER_NO_MATCH                0xFFFFFFFFU
+
+/* uDMA registers */
+#define PARBUS_UDMA_ENASET_REGISTER_ADDRESS      0x400FF028U
+#define PARBUS_UDMA_ENACLR_REGISTER_ADDRESS      0x400FF02CU
+#define PARBUS_UDMA_USEBURSTCLR_REGISTER_ADDRESS 0x400FF01CU
+#define PARBUS_UDMA_REQMASKCLR_REGISTER_ADDRESS  0x400FF024U
+#define PARBUS_UDMA_ALTCLR_REGISTER_ADDRESS      0x400FF034U
+#define PARBUS_UDMA_PRIOCLR_REGISTER_ADDRESS     0x400FF03CU
+#define PARBUS_UDMA_CHIS_REGISTER_ADDRESS        0x400FF504U
+#define PARBUS_UDMA_CHMAP0_REGISTER_ADDRESS      0x400FF510U
+
+/* uDMA channel of the GPIO trigger of each port (encoding 3) and GPIO interrupt of each port */
+#define PARBUS_GPIO_UDMA_CHANNEL(PORT)       (((PORT) < PORTE) ? (4U + (uint32)(PORT)) : (14U + ((uint32)(PORT) - PORTE)))
+#define PARBUS_GPIO_IRQ(PORT)                (((PORT) < PORTF) ? (uint32)(PORT) : 30U)
+#define PARBUS_UDMA_GPIO_ENCODING            (3U)
+
+/* Register of the DMACHMAPn field of uDMA channel CHANNEL and its shift */
+#define PARBUS_UDMA_CHMAP_ADDRESS(CHANNEL)   (PARBUS_UDMA_CHMAP0_REGISTER_ADDRESS + (((uint32)(CHANNEL) >> 3U) * 4U))
+#define PARBUS_UDMA_CHMAP_SHIFT(CHANNEL)     (((uint32)(CHANNEL) & 7U) * 4U)
+
+/* NVIC set enable register and bit of interrupt IRQ */
+#define PARBUS_NVIC_EN_REGISTER_ADDRESS(IRQ) (0xE000E100U + (((uint32)(IRQ) >> 5U) * 4U))
+#define PARBUS_NVIC_BIT(IRQ)                 (1UL << ((uint32)(IRQ) & 31U))
+
+/* Largest transfer of one control structure */
+#define PARBUS_DMA_MAX_CHUNK                 (1024U)
+
+/* Control word of one chunk: byte reads from the buffer, byte writes to one fixed DATA aperture, one transfer
+   per strobe edge, ping-pong mode */
+#define PARBUS_DMA_CHCTL(LENGTH)                                      \
+    (UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_8 | UDMA_CHCTL_SRCSIZE_8 | \
+     UDMA_CHCTL_ARBSIZE_1 | (((uint32)(LENGTH) - 1U) << 4U) | UDMA_CHCTL_XFERMODE_PINGPONG)
+#endif
+
+#endif /* PARBUS_PRIVATE_H */
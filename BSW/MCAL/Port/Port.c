@@ -11,13 +11,116 @@
 
 #include "Port.h"
 #include "Port_Private.h"
+#include "../Trace/Trace.h"
 
 
 
 STATIC const Port_ConfigChannel * Port_Channels = NULL_PTR; /* Pointer to the first element in the Port_ConfigChannel array */
 uint8 Port_Status = PORT_NOT_INITIALIZED;                   /* Port Status */
 
+/*
+ * Register images of one port folded from the configured pins: the value of every pin of Pins in each register,
+ * the pins outside Pins are not configured and keep their register bits.
+ */
+typedef struct
+{
+    uint32 Pins;       /* Configured pins */
+    uint32 Outputs;    /* Configured output pins, their DATA bit is written */
+    uint32 Commit;     /* Locked pins (PD7, PF0) to commit before their configuration is written */
+    uint32 Data;
+    uint32 Dir;
+    uint32 PullUp;
+    uint32 PullDown;
+    uint32 Analog;
+    uint32 AltFunc;
+    uint32 Digital;
+    uint32 Ctl;        /* GPIOPCTL, 4 bits per pin */
+}Port_ImageType;
+
+/* GPIO base addresses indexed by the port number */
+STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Writes Value to the bits Mask of the register at OFFSET, with a single store when Mask covers the register */
+LOCAL_INLINE void Port_WriteImage(uint32 Base, uint32 Offset, uint32 Mask, uint32 Value)
+{
+    if (Mask != 0xFFFFFFFFU)
+    {
+        Value = (PORT_READ_REG(Base, Offset) & ~Mask) | (Value & Mask);
+    }
+    PORT_WRITE_REG(Base, Offset, Value);
+}
+
+/* GPIOPCTL mask of the pins Pins: the 4 bits of every pin */
+LOCAL_INLINE uint32 Port_CtlMask(uint32 Pins)
+{
+    uint32 Mask = 0U;
+    uint8 Pin;
+    for (Pin = 0U; Pin < 8U; Pin++)
+    {
+        Mask |= ((Pins >> Pin) & 1U) * (BYTE_MASK << (Pin * 4U));
+    }
+    return Mask;
+}
+
+/* Folds the configured pins into the zeroed images of the ports, returns the ports used */
+STATIC uint32 Port_FoldImages(const Port_ConfigChannel * Channels, Port_ImageType * Images)
+{
+    uint32 Ports = 0U;
+    uint8 PinIndex;
+
+    for (PinIndex = 0U; PinIndex < PORT_CONFIGURED_PINS; PinIndex++)
+    {
+        const Port_ConfigChannel * Channel = &Channels[PinIndex];
+        Port_ImageType * Image = &Images[Channel->port_num];
+        uint32 Bit = 1UL << Channel->pin_num;
+
+        Ports |= 1UL << Channel->port_num;
+        Image->Pins |= Bit;
+        if (((Channel->port_num == PORTD) && (Channel->pin_num == PIN7))
+            || ((Channel->port_num == PORTF) && (Channel->pin_num == PIN0)))
+        {
+            Image->Commit |= Bit;
+        }
+        if (Channel->direction == PORT_PIN_OUT)
+        {
+            Image->Dir |= Bit;
+            Image->Outputs |= Bit;
+            Image->Data |= ((Channel->initial_value & BIT_MASK) == STD_HIGH) ? Bit : 0U;
+        }
+        /* Setting a pull-up bit clears the pull-down one on the device, the image clears it as well */
+        Image->PullUp |= (Channel->resistor == PULL_UP) ? Bit : 0U;
+        Image->PullDown |= (Channel->resistor == PULL_DOWN) ? Bit : 0U;
+        switch (Channel->pin_mode)
+        {
+            case DIO:
+                Image->Digital |= Bit;
+                break;
+            case ADC:
+                Image->Analog |= Bit;
+                break;
+            default:
+                Image->Digital |= Bit;
+                Image->AltFunc |= Bit;
+                Image->Ctl |= (uint32)Channel->pin_mode << (Channel->pin_num * 4U);
+                break;
+        }
+    }
+    return Ports;
+}
+
+/**
+ * @brief Port_Init folds the configuration into one image per port and register, then writes every register of a
+ *        port once: a plain store when the 8 pins of the port are configured, a read-modify-write of the configured
+ *        pins otherwise. The initial levels are stored through the masked DATA aperture before the pins are turned
+ *        into outputs, so they come up at their level. The clocks of the used ports are enabled with one RCGCGPIO
+ *        write (the unused ports are gated off with PORT_GATE_UNUSED_PORTS) and PRGPIO is polled once for all.
+ */
 void Port_Init(const Port_ConfigType* ConfigPtr ){
+    TRACE_SERVICE(PORT_MODULE_ID, PORT_INIT_SID, 0U);
     #if (DEV_ERROR_DETECT == STD_ON)
         /* Check if the input configuration pointer is not a NULL_PTR */
         if (NULL_PTR == ConfigPtr)
@@ -31,164 +134,62 @@ void Port_Init(const Port_ConfigType* ConfigPtr ){
     Port_Channels = ConfigPtr->Channels; /* Set the Port_Channels to point to the first element in the Port_ConfigChannel array */
     Port_Status = PORT_INITIALIZED;      /* Set the Port_Status to PORT_INITIALIZED */
 
-
-    volatile uint32 * Port_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    volatile uint32 * PCTRreg_Ptr = NULL_PTR; /*Pointer to hold the Current Control Register Address*/
-
     #if (PORT_SET_PIN_DIRECTION_API == STD_ON)
-        uint8 PinIndex = 0; /* Loop index for the channels in the Port_ConfigChannel array */
-        for (PinIndex = 0; PinIndex < PORT_CONFIGURED_PINS; PinIndex++)
+        Port_ImageType Images[PORT_NUMBER_OF_PORTS] = { { 0U } };
+        uint32 Ports = Port_FoldImages(Port_Channels, Images);
+        uint32 Clocks = MCAL_REG_READ32(RCGCGPIO_REGISTER_ADDRESS);
+        uint8 PortIndex;
+
+        // enable the clocks of all the used ports with one write, then wait once until all of them are ready
+        #if (PORT_GATE_UNUSED_PORTS == STD_ON)
+        if (Clocks != Ports)
         {
-            switch(Port_Channels[PinIndex].port_num)
-            {
-                case PORTA:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-                    break;
-                case PORTB:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-                    break;
-                case PORTC:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-                    break;
-                case PORTD:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-                    break;
-                case PORTE:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-                    break;
-                case PORTF:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-                    break;
-                default:
-                    /* No Action Required */
-                    break;
-            }
+            MCAL_REG_WRITE32(RCGCGPIO_REGISTER_ADDRESS, Ports);
+        }
+        #else
+        if ((Clocks & Ports) != Ports)
+        {
+            MCAL_REG_WRITE32(RCGCGPIO_REGISTER_ADDRESS, Clocks | Ports);
+        }
+        #endif
+        while ((MCAL_REG_READ32(PRGPIO_REGISTER_ADDRESS) & Ports) != Ports);
+        #if (PORT_GPIO_AHB_APERTURE == STD_ON)
+        // route the ports to the AHB aperture
+        uint32 Ahb = MCAL_REG_READ32(GPIOHBCTL_REGISTER_ADDRESS);
+        if ((Ahb & Ports) != Ports)
+        {
+            MCAL_REG_WRITE32(GPIOHBCTL_REGISTER_ADDRESS, Ahb | Ports);
+        }
+        #endif
 
-            // if clock is not enabled for port then enable it
-            if (0 == (SYSCTL_RCGC2_R & (1 << Port_Channels[PinIndex].port_num)))
+        for (PortIndex = 0U; PortIndex < PORT_NUMBER_OF_PORTS; PortIndex++)
+        {
+            const Port_ImageType * Image = &Images[PortIndex];
+            uint32 Port_Base = Port_BaseAddress[PortIndex];
+            uint32 Mask = (Image->Pins == 0xFFU) ? 0xFFFFFFFFU : Image->Pins;
+
+            if (Image->Pins == 0U)
             {
-                SYSCTL_RCGC2_R |= (1 << Port_Channels[PinIndex].port_num);
-                // wait until clock is enabled
-                while (0 == (SYSCTL_PRGPIO_R & (1 << Port_Channels[PinIndex].port_num)));
+                continue;
             }
             /*use the unlock and commit register incase of PD7 & PF0*/
-            if (Port_Channels[PinIndex].port_num == PORTD && Port_Channels[PinIndex].pin_num == PIN7)
+            if (Image->Commit != 0U)
             {
-                GPIO_PORTD_LOCK_R = 0x4C4F434B;
-                GPIO_PORTD_CR_R |= (1 << Port_Channels[PinIndex].pin_num);
+                PORT_WRITE_REG(Port_Base, PORT_LOCK_REG_OFFSET, GPIO_LOCK_KEY);
+                PORT_WRITE_REG(Port_Base, PORT_COMMIT_REG_OFFSET, PORT_READ_REG(Port_Base, PORT_COMMIT_REG_OFFSET) | Image->Commit);
             }
-            else if (Port_Channels[PinIndex].port_num == PORTF && Port_Channels[PinIndex].pin_num == PIN0)
+            if (Image->Outputs != 0U)
             {
-                GPIO_PORTF_LOCK_R = 0x4C4F434B;
-                GPIO_PORTF_CR_R |= (1 << Port_Channels[PinIndex].pin_num);
+                /* Address bits [9:2] select the pins the store reaches */
+                PORT_WRITE_REG(Port_Base, Image->Outputs << 2U, Image->Data);
             }
-
-            /*switch case to set the direction of the pin (input or output)*/
-            switch (Port_Channels[PinIndex].direction)
-            {
-                case PORT_PIN_IN:
-                    CLEAR_BIT(*(Port_Ptr + PORT_DIR_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    break;
-                case PORT_PIN_OUT:
-                    SET_BIT(*(Port_Ptr + PORT_DIR_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    break;
-                default:
-                    /* No Action Required */
-                    break;
-            }
-
-            /*switch case to set resistor type of the pin (pull up or pull down)*/
-            switch (Port_Channels[PinIndex].resistor)
-            {
-                case PULL_UP:
-                    SET_BIT(*(Port_Ptr + PORT_PULL_UP_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    break;
-                case PULL_DOWN:
-                    SET_BIT(*(Port_Ptr + PORT_PULL_DOWN_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    break;
-                case OFF:
-                    CLEAR_BIT(*(Port_Ptr + PORT_PULL_UP_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    CLEAR_BIT(*(Port_Ptr + PORT_PULL_DOWN_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    break;
-                default:
-                    /* No Action Required */
-                    break;
-            }
-
-            // save the current control register address
-            PCTRreg_Ptr = Port_Ptr + PORT_CTL_REG_OFFSET;
-            // set the current control register
-
-            switch(Port_Channels[PinIndex].pin_mode)
-            {
-                case DIO:
-                    // clearing the corresponding bit in the analog register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    //clear control register
-                    *PCTRreg_Ptr &= ~(BYTE_MASK << (Port_Channels[PinIndex].pin_num * 4));
-                    //clear alternate function register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    //set the corresponding bit in the digital register
-                    SET_BIT(*(Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    // if the pin is output then set the corresponding bit in the data register
-                    if (Port_Channels[PinIndex].direction == PORT_PIN_OUT)
-                    {
-                        if ((Port_Channels[PinIndex].initial_value & BIT_MASK)  == STD_HIGH)
-                        {
-                            SET_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                        }
-                        else
-                        {
-                            CLEAR_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                        }
-                    }
-                    break;
-                case ADC:
-                    // clearing the corresponding bit in the digital register
-                    CLEAR_BIT(*(Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    //clear control register
-                    *PCTRreg_Ptr &= ~(BYTE_MASK << (Port_Channels[PinIndex].pin_num * 4));
-                    //clear alternate function register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    //set the corresponding bit in the analog register
-                    SET_BIT(*(Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    // if the pin is output then set the corresponding bit in the data register
-                    if (Port_Channels[PinIndex].direction == PORT_PIN_OUT)
-                    {
-                        if ((Port_Channels[PinIndex].initial_value & BIT_MASK)  == STD_HIGH)
-                        {
-                            SET_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                        }
-                        else
-                        {
-                            CLEAR_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                        }
-                    }
-                    break;
-                default:
-                    // clearing the corresponding bit in the analog register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    // setting the corresponding bits in the digital register
-                    SET_BIT(*(Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    // setting the corresponding bits in the alternate function register
-                    SET_BIT(*(Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                    /*Masking and setting the mode of the current pin in the right bits in the control register*/
-                    *PCTRreg_Ptr = (*PCTRreg_Ptr & ~(BYTE_MASK << (Port_Channels[PinIndex].pin_num * 4))) | (Port_Channels[PinIndex].pin_mode << (Port_Channels[PinIndex].pin_num * 4));
-                    // if the pin is output then set the corresponding bit in the data register
-                    if (Port_Channels[PinIndex].direction == PORT_PIN_OUT)
-                    {
-                        if ((Port_Channels[PinIndex].initial_value & BIT_MASK)  == STD_HIGH)
-                        {
-                            SET_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                        }
-                        else
-                        {
-                            CLEAR_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[PinIndex].pin_num);
-                        }
-                    }
-                    break;
-            }     
-                    
+            Port_WriteImage(Port_Base, PORT_DIR_REG_OFFSET, Mask, Image->Dir);
+            Port_WriteImage(Port_Base, PORT_PULL_UP_REG_OFFSET, Mask, Image->PullUp);
+            Port_WriteImage(Port_Base, PORT_PULL_DOWN_REG_OFFSET, Mask, Image->PullDown);
+            Port_WriteImage(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Mask, Image->Analog);
+            Port_WriteImage(Port_Base, PORT_CTL_REG_OFFSET, Port_CtlMask(Image->Pins), Image->Ctl);
+            Port_WriteImage(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Mask, Image->AltFunc);
+            Port_WriteImage(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Mask, Image->Digital);
         }
     #endif
 
@@ -207,6 +208,7 @@ void Port_Init(const Port_ConfigType* ConfigPtr ){
  * @return None
  */
 void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction ){
+    TRACE_SERVICE(PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID, Pin);
 #if (DET_DEV_ERROR_DETECT == STD_ON)
     /* Check if the driver is initialized */
     if (Port_Status == PORT_NOT_INITIALIZED)
@@ -229,26 +231,26 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction ){
 #endif    
 
 
-    volatile uint32 * Port_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+    uint32 Port_Base = 0U; /* the required Port Registers base address */
     switch (Port_Channels[Pin].port_num)
     {
         case PORTA:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
+            Port_Base = GPIO_PORTA_BASE_ADDRESS;
             break;
         case PORTB:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
+            Port_Base = GPIO_PORTB_BASE_ADDRESS;
             break;
         case PORTC:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
+            Port_Base = GPIO_PORTC_BASE_ADDRESS;
             break;
         case PORTD:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
+            Port_Base = GPIO_PORTD_BASE_ADDRESS;
             break;
         case PORTE:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
+            Port_Base = GPIO_PORTE_BASE_ADDRESS;
             break;
         case PORTF:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
+            Port_Base = GPIO_PORTF_BASE_ADDRESS;
             break;
         default:
             /* No Action Required */
@@ -256,11 +258,11 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction ){
     }
     if (Direction == PORT_PIN_IN)
     {
-        CLEAR_BIT(*(Port_Ptr + PORT_DIR_REG_OFFSET), Port_Channels[Pin].pin_num);
+        PORT_CLEAR_REG_BIT(Port_Base, PORT_DIR_REG_OFFSET, Port_Channels[Pin].pin_num);
     }
     else
     {
-        SET_BIT(*(Port_Ptr + PORT_DIR_REG_OFFSET), Port_Channels[Pin].pin_num);
+        PORT_SET_REG_BIT(Port_Base, PORT_DIR_REG_OFFSET, Port_Channels[Pin].pin_num);
     }
             
 }
@@ -280,6 +282,7 @@ void Port_SetPinDirection( Port_PinType Pin, Port_PinDirectionType Direction ){
  * @note This function shall refresh port direction.  
  */
 void Port_RefreshPortDirection(void){
+    TRACE_SERVICE(PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID, 0U);
     #if (PORT_DEV_ERROR_DETECT == STD_ON)
     if(Port_Status  == PORT_NOT_INITIALIZED)
     {
@@ -289,7 +292,7 @@ void Port_RefreshPortDirection(void){
     }
     #endif
 
-    volatile uint32 * Port_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+    uint32 Port_Base = 0U; /* the required Port Registers base address */
 
     int PinIndex=0;
     for(PinIndex=0 ; PinIndex < PORT_CONFIGURED_PINS ; PinIndex++)
@@ -299,26 +302,26 @@ void Port_RefreshPortDirection(void){
             switch(Port_Channels[PinIndex].port_num)
             {
                 case  PORTA: 
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+                    Port_Base = GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
                     break;
 
                 case  PORTB: 
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+                    Port_Base = GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
                     break;
 
                 case  PORTC: 
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+                    Port_Base = GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
                     break;
 
                 case  PORTD: 
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+                    Port_Base = GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
                     break;
         
                 case  PORTE: 
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+                    Port_Base = GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
                     break;
                 case PORTF:
-                    Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+                    Port_Base = GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
                     break;
                 default:
                     /* No Action Required */
@@ -329,23 +332,23 @@ void Port_RefreshPortDirection(void){
             /*use the unlock and commit register incase of PD7 & PF0*/
             if (Port_Channels[PinIndex].port_num == PORTD && Port_Channels[PinIndex].pin_num == PIN7)
             {
-                GPIO_PORTD_LOCK_R = 0x4C4F434B;
-                GPIO_PORTD_CR_R |= (1 << Port_Channels[PinIndex].pin_num);
+                PORT_WRITE_REG(Port_Base, PORT_LOCK_REG_OFFSET, GPIO_LOCK_KEY);
+                PORT_SET_REG_BIT(Port_Base, PORT_COMMIT_REG_OFFSET, Port_Channels[PinIndex].pin_num);
             }
             else if (Port_Channels[PinIndex].port_num == PORTF && Port_Channels[PinIndex].pin_num == PIN0)
             {
-                GPIO_PORTF_LOCK_R = 0x4C4F434B;
-                GPIO_PORTF_CR_R |= (1 << Port_Channels[PinIndex].pin_num);
+                PORT_WRITE_REG(Port_Base, PORT_LOCK_REG_OFFSET, GPIO_LOCK_KEY);
+                PORT_SET_REG_BIT(Port_Base, PORT_COMMIT_REG_OFFSET, Port_Channels[PinIndex].pin_num);
             }
 
             /*switch case to set the direction of the pin (input or output)*/
             switch(Port_Channels[PinIndex].direction)
             {
                 case PORT_PIN_IN:
-                    CLEAR_BIT(*(Port_Ptr + PORT_DIR_REG_OFFSET), Port_Channels[PinIndex].pin_num);
+                    PORT_CLEAR_REG_BIT(Port_Base, PORT_DIR_REG_OFFSET, Port_Channels[PinIndex].pin_num);
                     break;
                 case PORT_PIN_OUT:
-                    SET_BIT(*(Port_Ptr + PORT_DIR_REG_OFFSET), Port_Channels[PinIndex].pin_num);
+                    PORT_SET_REG_BIT(Port_Base, PORT_DIR_REG_OFFSET, Port_Channels[PinIndex].pin_num);
                     break;
                 default:
                     /* No Action Required */
@@ -370,6 +373,7 @@ void Port_RefreshPortDirection(void){
  * @note This function shall return the version information of this module.  
  */
 void Port_GetVersionInfo(Std_VersionInfoType *versioninfo){
+    TRACE_SERVICE(PORT_MODULE_ID, PORT_GET_VERSION_INFO_SID, 0U);
     #if (PORT_DEV_ERROR_DETECT == STD_ON)
     if(Port_Status  == PORT_NOT_INITIALIZED)
     {
@@ -409,6 +413,7 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo){
  * @note This function shall set the port pin mode.  
  */
 void Port_SetPinMode(  Port_PinType Pin, Port_PinModeType Mode ){
+    TRACE_SERVICE(PORT_MODULE_ID, PORT_SET_PIN_MODE_SID, Pin);
     #if (PORT_DEV_ERROR_DETECT == STD_ON)
     if(Port_Status  == PORT_NOT_INITIALIZED)
     {
@@ -439,26 +444,26 @@ void Port_SetPinMode(  Port_PinType Pin, Port_PinModeType Mode ){
     if(Port_Channels[Pin].pin_mode_changeable == STD_ON ) /*Checking if the pin mode is changable before changing it*/
     {
 
-        volatile uint32 * Port_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+        uint32 Port_Base = 0U; /* the required Port Registers base address */
 
-        switch(Port_Channels[Pin].port_num) /*Checking the current port number and saving its address to Port_Ptr*/
+        switch(Port_Channels[Pin].port_num) /*Checking the current port number and saving its address to Port_Base*/
         {
-            case  PORTA: Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+            case  PORTA: Port_Base = GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
                         break;
 
-            case  PORTB: Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+            case  PORTB: Port_Base = GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
                         break;
 
-            case  PORTC: Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+            case  PORTC: Port_Base = GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
                         break;
 
-            case  PORTD: Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+            case  PORTD: Port_Base = GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
                         break;
 
-            case  PORTE: Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+            case  PORTE: Port_Base = GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
                         break;
 
-            case  PORTF: Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+            case  PORTF: Port_Base = GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
                         break;
             default:        break; /*default case to obey MISRA rules*/
         }
@@ -469,85 +474,82 @@ void Port_SetPinMode(  Port_PinType Pin, Port_PinModeType Mode ){
         /*use the unlock and commit register incase of PD7 & PF0*/
         if (Port_Channels[Pin].port_num == PORTD && Port_Channels[Pin].pin_num == PIN7)
         {
-            GPIO_PORTD_LOCK_R = 0x4C4F434B;
-            GPIO_PORTD_CR_R |= (1 << Port_Channels[Pin].pin_num);
+            PORT_WRITE_REG(Port_Base, PORT_LOCK_REG_OFFSET, GPIO_LOCK_KEY);
+            PORT_SET_REG_BIT(Port_Base, PORT_COMMIT_REG_OFFSET, Port_Channels[Pin].pin_num);
         }
         else if (Port_Channels[Pin].port_num == PORTF && Port_Channels[Pin].pin_num == PIN0)
         {
-            GPIO_PORTF_LOCK_R = 0x4C4F434B;
-            GPIO_PORTF_CR_R |= (1 << Port_Channels[Pin].pin_num);
+            PORT_WRITE_REG(Port_Base, PORT_LOCK_REG_OFFSET, GPIO_LOCK_KEY);
+            PORT_SET_REG_BIT(Port_Base, PORT_COMMIT_REG_OFFSET, Port_Channels[Pin].pin_num);
         }
 
-        volatile uint32 * PCTRreg_Ptr = NULL_PTR; /*Pointer to hold the Current Control Register Address*/
 
-        /*Saving the Current Control Register Address in the PCTR_Ptr*/
-        PCTRreg_Ptr = Port_Ptr + PORT_CTL_REG_OFFSET ;
 
         switch(Port_Channels[Pin].pin_mode)
             {
                 case DIO:
                     // clearing the corresponding bit in the analog register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_CLEAR_REG_BIT(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_Channels[Pin].pin_num);
                     //clear control register
-                    *PCTRreg_Ptr &= ~(BYTE_MASK << (Port_Channels[Pin].pin_num * 4));
+                    PORT_WRITE_REG(Port_Base, PORT_CTL_REG_OFFSET, PORT_READ_REG(Port_Base, PORT_CTL_REG_OFFSET) & ~(BYTE_MASK << (Port_Channels[Pin].pin_num * 4)));
                     //clear alternate function register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_CLEAR_REG_BIT(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Port_Channels[Pin].pin_num);
                     //set the corresponding bit in the digital register
-                    SET_BIT(*(Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_SET_REG_BIT(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Port_Channels[Pin].pin_num);
                     // if the pin is output then set the corresponding bit in the data register
                     if (Port_Channels[Pin].direction == PORT_PIN_OUT)
                     {
                         if ((Port_Channels[Pin].initial_value & BIT_MASK)  == STD_HIGH)
                         {
-                            SET_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[Pin].pin_num);
+                            PORT_SET_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Port_Channels[Pin].pin_num);
                         }
                         else
                         {
-                            CLEAR_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[Pin].pin_num);
+                            PORT_CLEAR_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Port_Channels[Pin].pin_num);
                         }
                     }
                     break;
                 case ADC:
                     // clearing the corresponding bit in the digital register
-                    CLEAR_BIT(*(Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_CLEAR_REG_BIT(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Port_Channels[Pin].pin_num);
                     //clear control register
-                    *PCTRreg_Ptr &= ~(BYTE_MASK << (Port_Channels[Pin].pin_num * 4));
+                    PORT_WRITE_REG(Port_Base, PORT_CTL_REG_OFFSET, PORT_READ_REG(Port_Base, PORT_CTL_REG_OFFSET) & ~(BYTE_MASK << (Port_Channels[Pin].pin_num * 4)));
                     //clear alternate function register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_CLEAR_REG_BIT(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Port_Channels[Pin].pin_num);
                     //set the corresponding bit in the analog register
-                    SET_BIT(*(Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_SET_REG_BIT(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_Channels[Pin].pin_num);
                     // if the pin is output then set the corresponding bit in the data register
                     if (Port_Channels[Pin].direction == PORT_PIN_OUT)
                     {
                         if ((Port_Channels[Pin].initial_value & BIT_MASK)  == STD_HIGH)
                         {
-                            SET_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[Pin].pin_num);
+                            PORT_SET_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Port_Channels[Pin].pin_num);
                         }
                         else
                         {
-                            CLEAR_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[Pin].pin_num);
+                            PORT_CLEAR_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Port_Channels[Pin].pin_num);
                         }
                     }
                     break;
                 default:
                     // clearing the corresponding bit in the analog register
-                    CLEAR_BIT(*(Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_CLEAR_REG_BIT(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Port_Channels[Pin].pin_num);
                     // setting the corresponding bits in the digital register
-                    SET_BIT(*(Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_SET_REG_BIT(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Port_Channels[Pin].pin_num);
                     // setting the corresponding bits in the alternate function register
-                    SET_BIT(*(Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Channels[Pin].pin_num);
+                    PORT_SET_REG_BIT(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Port_Channels[Pin].pin_num);
                     /*Masking and setting the mode of the current pin in the right bits in the control register*/
-                    *PCTRreg_Ptr = (*PCTRreg_Ptr & ~(BYTE_MASK << (Port_Channels[Pin].pin_num * 4))) | (Port_Channels[Pin].pin_mode << (Port_Channels[Pin].pin_num * 4));
+                    PORT_WRITE_REG(Port_Base, PORT_CTL_REG_OFFSET, (PORT_READ_REG(Port_Base, PORT_CTL_REG_OFFSET) & ~(BYTE_MASK << (Port_Channels[Pin].pin_num * 4))) | (Port_Channels[Pin].pin_mode << (Port_Channels[Pin].pin_num * 4)));
                     // if the pin is output then set the corresponding bit in the data register
                     if (Port_Channels[Pin].direction == PORT_PIN_OUT)
                     {
                         if ((Port_Channels[Pin].initial_value & BIT_MASK)  == STD_HIGH)
                         {
-                            SET_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[Pin].pin_num);
+                            PORT_SET_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Port_Channels[Pin].pin_num);
                         }
                         else
                         {
-                            CLEAR_BIT(*(Port_Ptr + PORT_DATA_REG_OFFSET), Port_Channels[Pin].pin_num);
+                            PORT_CLEAR_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Port_Channels[Pin].pin_num);
                         }
                     }
                     break;
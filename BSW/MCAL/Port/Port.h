@@ -172,7 +172,7 @@ typedef struct
 
 typedef struct
 {
-	Port_ConfigChannel Channels[PINS_NUMBER_EXCEPT_JTAG];
+	Port_ConfigChannel Channels[PORT_CONFIGURED_PINS];
 }Port_ConfigType;
 
 
@@ -35,6 +35,16 @@
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API  				(STD_OFF)
 
+/* Pre-compile option to access the GPIO ports through the AHB apertures instead of the legacy APB ones,
+   must be set the same as DIO_GPIO_AHB_APERTURE in Dio_Cfg.h */
+#ifndef PORT_GPIO_AHB_APERTURE
+#define PORT_GPIO_AHB_APERTURE              (STD_OFF)
+#endif
+
+/* Pre-compile option to gate off the clock of the ports without a configured pin in Port_Init,
+   Dio_Init then leaves these ports out of its port loops and the DIO port services reject them */
+#define PORT_GATE_UNUSED_PORTS              (STD_ON)
+
 /* Number of Pins excluding JTAG Pins */
 #define PORT_CONFIGURED_PINS 				39
 
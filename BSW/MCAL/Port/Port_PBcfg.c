@@ -44,53 +44,58 @@
   using default settings of DIO,INPUT,RESISTANCE OFF,DIRECTION AND MODE NOT CHANGABLE.
 
   The configuration structure configures the Button in PF4 and LED in PF1 with the needed
-  configurations by the project*/
+  configurations by the project, PD0/PD3 as the software SPI outputs and PA2..PA4 as the
+  software I2C/1-Wire lines (pulled up, SoftSerial drives them low through their direction),
+  PA5/PD1/PF2/PF3 as the outputs of the LCD data bus virtual port, PA6/PA7, PD6/PD7, PE4/PE5
+  as the motor commutation outputs of the DIO synchronous port write list, PE2/PE3/PF0 as the
+  SoftPwm heater outputs and PB0..PB7/PC4..PC7 as the ParBus data lanes and control lines (outputs
+  whose direction the application may change to read the display back)*/
 
 const Port_ConfigType Port_Configuration= 
 {
 	PORTA,PIN0,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTA,PIN1,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTA,PIN2,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTA,PIN3,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTA,PIN4,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTA,PIN5,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTA,PIN6,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTA,PIN7,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTA,PIN2,PORT_PIN_IN,DIO,PULL_UP,STD_LOW,STD_OFF,STD_ON,
+	PORTA,PIN3,PORT_PIN_IN,DIO,PULL_UP,STD_LOW,STD_OFF,STD_ON,
+	PORTA,PIN4,PORT_PIN_IN,DIO,PULL_UP,STD_LOW,STD_OFF,STD_ON,
+	PORTA,PIN5,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTA,PIN6,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTA,PIN7,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 
-	PORTB,PIN0,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN1,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN2,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN3,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN4,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN5,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN6,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTB,PIN7,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTB,PIN0,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN1,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN2,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN3,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN4,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN5,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN6,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTB,PIN7,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
 
 
-	PORTC,PIN4,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTC,PIN5,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTC,PIN6,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTC,PIN7,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTC,PIN4,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTC,PIN5,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTC,PIN6,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
+	PORTC,PIN7,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_ON,
 
-	PORTD,PIN0,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTD,PIN1,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTD,PIN0,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTD,PIN1,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTD,PIN2,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTD,PIN3,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTD,PIN3,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTD,PIN4,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTD,PIN5,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTD,PIN6,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTD,PIN7,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTD,PIN6,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTD,PIN7,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 
 	PORTE,PIN0,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTE,PIN1,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTE,PIN2,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTE,PIN3,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTE,PIN4,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTE,PIN5,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTE,PIN2,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTE,PIN3,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTE,PIN4,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTE,PIN5,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 
-	PORTF,PIN0,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTF,PIN0,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTF,PIN1,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTF,PIN2,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
-	PORTF,PIN3,PORT_PIN_IN,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTF,PIN2,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
+	PORTF,PIN3,PORT_PIN_OUT,DIO,OFF,STD_LOW,STD_OFF,STD_OFF,
 	PORTF,PIN4,PORT_PIN_IN,DIO,PULL_UP,STD_LOW,STD_OFF,STD_OFF
 };
@@ -13,20 +13,42 @@
 #define PORT_PRIVATE_H_
 #include "../tm4c123gh6pm.h"
 #include "../tm4c123gh6pm_bits.h"
+#include "../Mcal_Reg.h"
 
 /* GPIO Registers base addresses */
+#if (PORT_GPIO_AHB_APERTURE == STD_ON)
+#define GPIO_PORTA_BASE_ADDRESS           0x40058000
+#define GPIO_PORTB_BASE_ADDRESS           0x40059000
+#define GPIO_PORTC_BASE_ADDRESS           0x4005A000
+#define GPIO_PORTD_BASE_ADDRESS           0x4005B000
+#define GPIO_PORTE_BASE_ADDRESS           0x4005C000
+#define GPIO_PORTF_BASE_ADDRESS           0x4005D000
+#else
 #define GPIO_PORTA_BASE_ADDRESS           0x40004000
 #define GPIO_PORTB_BASE_ADDRESS           0x40005000
 #define GPIO_PORTC_BASE_ADDRESS           0x40006000
 #define GPIO_PORTD_BASE_ADDRESS           0x40007000
 #define GPIO_PORTE_BASE_ADDRESS           0x40024000
 #define GPIO_PORTF_BASE_ADDRESS           0x40025000
+#endif
+
+/* Number of GPIO ports (A..F) */
+#define PORT_NUMBER_OF_PORTS              (6U)
 
 /*Clock Gating Register*/
 #define RCGC2_REGISTER_ADDRESS			  0X400FE108
 
+/* GPIO Run Mode Clock Gating Control Register, one bit per port */
+#define RCGCGPIO_REGISTER_ADDRESS         0x400FE608
+
+/*GPIO Peripheral Ready Register*/
+#define PRGPIO_REGISTER_ADDRESS			  0x400FEA08
+
+/*GPIO High-Performance Bus Control Register*/
+#define GPIOHBCTL_REGISTER_ADDRESS		  0x400FE06C
+
 /* GPIO Registers offset addresses */
-#define PORT_DATA_REG_OFFSET              0x000
+#define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
 #define PORT_PULL_UP_REG_OFFSET           0x510
@@ -37,4 +59,12 @@
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/* Read/Write the register at byte offset OFFSET from the GPIO base address BASE */
+#define PORT_READ_REG(BASE, OFFSET)            MCAL_REG_READ32((BASE) + (OFFSET))
+#define PORT_WRITE_REG(BASE, OFFSET, VALUE)    MCAL_REG_WRITE32((BASE) + (OFFSET), VALUE)
+
+/* Set/Clear bit BIT of the register at byte offset OFFSET from the GPIO base address BASE */
+#define PORT_SET_REG_BIT(BASE, OFFSET, BIT)    PORT_WRITE_REG(BASE, OFFSET, PORT_READ_REG(BASE, OFFSET) | (1UL << (BIT)))
+#define PORT_CLEAR_REG_BIT(BASE, OFFSET, BIT)  PORT_WRITE_REG(BASE, OFFSET, PORT_READ_REG(BASE, OFFSET) & ~(1UL << (BIT)))
+
 #endif
\ No newline at end of file
@@ -0,0 +1,381 @@
+/**
+ * @file Dio_AccessBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark of the register accesses made per Dio_ReadChannel and Dio_WriteChannel call
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Every channel is read from random input levels and written with random levels, through the DIO
+ *          services and through the per-port if/else chain with a read-modify-write of the whole DATA register
+ *          they used before the channel descriptor tables, kept here as the reference. Both must read the same
+ *          levels and drive the same output pins. The loads and stores per call, the APB, AHB and bit-band
+ *          accesses per call and the host time of both are reported, then the host instructions per call of
+ *          every port (x86-64 Linux hosts, the register model not counted): the DIO services must take as
+ *          many on PORTF as on PORTA where the if/else chain of the reference takes more. Every GPIO access must go through the
+ *          aperture of DIO_GPIO_AHB_APERTURE, none through the one GPIOHBCTL does not select, and every access
+ *          of the DIO services through the bit-band alias when DIO_BITBAND_ACCESS is on, but the writes of the
+ *          shadowed outputs, which stay one store of the masked aperture in the critical section of the shadow.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_AccessBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_AccessBench && ./Dio_AccessBench
+ *          and for the AHB apertures, with -DDIO_GPIO_AHB_APERTURE=STD_ON -DPORT_GPIO_AHB_APERTURE=STD_ON,
+ *          for the bit-band alias with -DDIO_BITBAND_ACCESS=STD_ON.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of checked and of timed passes over all the channels */
+#define BENCH_CHECKS                   (1000U)
+#define BENCH_PASSES                   (20000UL)
+
+STATIC const uint32 Bench_DataAddress[DIO_CONFIGURED_PORTS] =
+{
+    DIO_GPIO_PORTA_BASE_ADDRESS + DIO_DATA_REG_OFFSET, DIO_GPIO_PORTB_BASE_ADDRESS + DIO_DATA_REG_OFFSET,
+    DIO_GPIO_PORTC_BASE_ADDRESS + DIO_DATA_REG_OFFSET, DIO_GPIO_PORTD_BASE_ADDRESS + DIO_DATA_REG_OFFSET,
+    DIO_GPIO_PORTE_BASE_ADDRESS + DIO_DATA_REG_OFFSET, DIO_GPIO_PORTF_BASE_ADDRESS + DIO_DATA_REG_OFFSET
+};
+
+STATIC uint32 Bench_Random = 12345U;
+
+/* Reference: DATA register and pin of a channel found by the per-port if/else chain */
+STATIC uint32 Bench_RefAddress(Dio_ChannelType ChannelId, uint8 * Pin)
+{
+    uint8 Port;
+
+    if (ChannelId < 8U)
+    {
+        Port = PORTA;
+    }
+    else if (ChannelId < 16U)
+    {
+        Port = PORTB;
+    }
+    else if (ChannelId < 24U)
+    {
+        Port = PORTC;
+    }
+    else if (ChannelId < 32U)
+    {
+        Port = PORTD;
+    }
+    else if (ChannelId < 40U)
+    {
+        Port = PORTE;
+    }
+    else
+    {
+        Port = PORTF;
+    }
+    *Pin = (uint8)(ChannelId - (Port * 8U));
+    return Bench_DataAddress[Port];
+}
+
+/* Reference: bit of the whole DATA register */
+STATIC Dio_LevelType Bench_RefReadChannel(Dio_ChannelType ChannelId)
+{
+    uint8 Pin;
+    uint32 Address = Bench_RefAddress(ChannelId, &Pin);
+    return (Dio_LevelType)((MCAL_REG_READ32(Address) >> Pin) & 1U);
+}
+
+/* Reference: read-modify-write of the whole DATA register */
+STATIC void Bench_RefWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    uint8 Pin;
+    uint32 Address = Bench_RefAddress(ChannelId, &Pin);
+    uint32 Value = MCAL_REG_READ32(Address);
+    MCAL_REG_WRITE32(Address, (Level == STD_HIGH) ? (Value | (1UL << Pin)) : (Value & ~(1UL << Pin)));
+}
+
+STATIC Dio_LevelType Bench_DioReadChannel(Dio_ChannelType ChannelId)
+{
+    return Dio_ReadChannel(ChannelId);
+}
+
+STATIC void Bench_DioWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    Dio_WriteChannel(ChannelId, Level);
+}
+
+/* Bare register accesses of a channel, through the same calls: the floor of the host instruction counts */
+STATIC Dio_LevelType Bench_RawReadChannel(Dio_ChannelType ChannelId)
+{
+    return (Dio_LevelType)(MCAL_REG_READ32(Dio_Configuration.Channels[ChannelId].bits_address) != 0U);
+}
+
+STATIC void Bench_RawWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    MCAL_REG_WRITE32(Dio_Configuration.Channels[ChannelId].bits_address, (Level == STD_HIGH) ? 0xFFU : 0U);
+}
+
+/* Number of channels whose level differs between the two read functions, on random input levels */
+STATIC uint32 Bench_CheckReads(Dio_LevelType (*Read)(Dio_ChannelType), Dio_LevelType (*Reference)(Dio_ChannelType))
+{
+    uint32 Errors = 0U;
+    uint8 PortId;
+    Dio_ChannelType ChannelId;
+
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        Mcal_Sim_SetInputs(PortId, (uint8)Mcal_Sim_Random(&Bench_Random));
+    }
+    for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+    {
+        Errors += (Read(ChannelId) != Reference(ChannelId)) ? 1U : 0U;
+    }
+    return Errors;
+}
+
+/* Number of output pins that do not drive the levels written to them with Write */
+STATIC uint32 Bench_CheckWrites(void (*Write)(Dio_ChannelType, Dio_LevelType))
+{
+    uint8 Expected[DIO_CONFIGURED_PORTS];
+    uint32 Errors = 0U;
+    uint8 PortId;
+    Dio_ChannelType ChannelId;
+
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        Expected[PortId] = Mcal_Sim_GetOutputs(PortId);
+    }
+    for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+    {
+        Dio_LevelType Level = (Dio_LevelType)(Mcal_Sim_Random(&Bench_Random) & 1U);
+        uint8 Pin = (uint8)(1U << (ChannelId & 7U));
+
+        PortId = (uint8)(ChannelId >> 3U);
+        Write(ChannelId, Level);
+        Expected[PortId] = (uint8)((Expected[PortId] & ~Pin) | ((Level == STD_HIGH) ? Pin : 0U));
+        Expected[PortId] &= (uint8)MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[PortId] + DIO_DIR_REG_OFFSET);
+        Errors += (Mcal_Sim_GetOutputs(PortId) != Expected[PortId]) ? 1U : 0U;
+    }
+    return Errors;
+}
+
+/* TRUE when channel ChannelId is a shadowed output, read back from RAM */
+STATIC boolean Bench_IsShadowed(Dio_ChannelType ChannelId)
+{
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[ChannelId];
+    return ((Dio_Configuration.ShadowPins[Channel->port] & Channel->mask
+             & MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[Channel->port] + DIO_DIR_REG_OFFSET)) != 0U)
+           ? TRUE : FALSE;
+#else
+    (void)ChannelId;
+    return FALSE;
+#endif
+}
+
+/* Number of channels that are shadowed outputs, written through the masked aperture */
+STATIC uint32 Bench_ShadowedChannels(void)
+{
+    uint32 Count = 0U;
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    uint8 PortId;
+
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        Count += (uint32)__builtin_popcount(Dio_Configuration.ShadowPins[PortId]
+                                            & MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[PortId] + DIO_DIR_REG_OFFSET));
+    }
+#endif
+    return Count;
+}
+
+/*
+ * Prints the accesses and the host time of Calls calls of the DIO services (Driver = TRUE) or of the reference,
+ * returns the number of accesses through the wrong aperture or not through the expected one. Aperture is the
+ * number of accesses of the DIO services expected through the masked aperture instead of the bit-band alias.
+ */
+STATIC uint32 Bench_Report(const char * Name, boolean Driver, uint32 Aperture, const Mcal_Sim_StatsType * Before,
+                           clock_t Clocks, uint32 Calls)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Accesses = (Stats->loads - Before->loads) + (Stats->stores - Before->stores);
+    uint32 Apb = Stats->apb_accesses - Before->apb_accesses;
+    uint32 Ahb = Stats->ahb_accesses - Before->ahb_accesses;
+    uint32 Bitband = Stats->bitband_accesses - Before->bitband_accesses;
+    uint32 Errors = Stats->wrong_aperture_accesses - Before->wrong_aperture_accesses;
+
+    printf("%-30s %5.2f loads %5.2f stores %5.2f APB %5.2f AHB %5.2f bit-band/call %6.1f ns/call\n", Name,
+           (double)(Stats->loads - Before->loads) / Calls, (double)(Stats->stores - Before->stores) / Calls,
+           (double)Apb / Calls, (double)Ahb / Calls, (double)Bitband / Calls,
+           1.0e9 * (double)Clocks / CLOCKS_PER_SEC / Calls);
+#if (DIO_GPIO_AHB_APERTURE == STD_ON)
+    Errors += Apb;
+#else
+    Errors += Ahb;
+#endif
+#if (DIO_BITBAND_ACCESS == STD_ON)
+    Errors += (Bitband != ((Driver == TRUE) ? (Accesses - Aperture) : 0U)) ? 1U : 0U;
+#else
+    (void)Driver;
+    (void)Aperture;
+    (void)Accesses;
+    Errors += Bitband;
+#endif
+    return Errors;
+}
+
+/* Times BENCH_PASSES reads of all the channels with Read */
+STATIC uint32 Bench_TimeReads(const char * Name, boolean Driver, Dio_LevelType (*Read)(Dio_ChannelType))
+{
+    Mcal_Sim_StatsType Before = *Mcal_Sim_GetStats();
+    clock_t Start = clock();
+    uint32 Pass;
+    Dio_ChannelType ChannelId;
+
+    for (Pass = 0U; Pass < BENCH_PASSES; Pass++)
+    {
+        for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+        {
+            Bench_Random ^= Read(ChannelId);
+        }
+    }
+    return Bench_Report(Name, Driver, 0U, &Before, clock() - Start, BENCH_PASSES * DIO_CONFIGURED_CHANNELS);
+}
+
+/* Times BENCH_PASSES writes of all the channels with Write */
+STATIC uint32 Bench_TimeWrites(const char * Name, boolean Driver, void (*Write)(Dio_ChannelType, Dio_LevelType))
+{
+    uint32 Aperture = BENCH_PASSES * Bench_ShadowedChannels();
+    Mcal_Sim_StatsType Before = *Mcal_Sim_GetStats();
+    clock_t Start = clock();
+    uint32 Pass;
+    Dio_ChannelType ChannelId;
+
+    for (Pass = 0U; Pass < BENCH_PASSES; Pass++)
+    {
+        for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+        {
+            Write(ChannelId, (Dio_LevelType)((Pass ^ ChannelId) & 1U));
+        }
+    }
+    return Bench_Report(Name, Driver, Aperture, &Before, clock() - Start, BENCH_PASSES * DIO_CONFIGURED_CHANNELS);
+}
+
+/* Host instructions of one call of Read (when not NULL_PTR) or Write on ChannelId, less the start/stop pair */
+STATIC uint32 Bench_Instructions(Dio_LevelType (*Read)(Dio_ChannelType), void (*Write)(Dio_ChannelType, Dio_LevelType),
+                                 Dio_ChannelType ChannelId)
+{
+    uint32 Empty;
+    uint32 Count;
+
+    Mcal_Sim_StartInstructionCount();
+    Empty = Mcal_Sim_StopInstructionCount();
+    Mcal_Sim_StartInstructionCount();
+    if (Read != NULL_PTR)
+    {
+        Bench_Random ^= Read(ChannelId);
+    }
+    else
+    {
+        Write(ChannelId, (Dio_LevelType)(ChannelId & 1U));
+    }
+    Count = Mcal_Sim_StopInstructionCount();
+    return Count - Empty;
+}
+
+/*
+ * Prints the host instructions per call of every port, the average over its channels, for the bare accesses, the
+ * reference and the DIO services. Returns the number of failures: Dio_ReadChannel must take as many instructions
+ * on every channel but the shadowed outputs, the reference chain more on PORTF than on PORTA. Hosts that cannot count are not checked.
+ */
+STATIC uint32 Bench_PortInstructions(void)
+{
+    Dio_LevelType (* const Reads[3])(Dio_ChannelType) =
+    {
+        Bench_RawReadChannel, Bench_RefReadChannel, Bench_DioReadChannel
+    };
+    void (* const Writes[3])(Dio_ChannelType, Dio_LevelType) =
+    {
+        Bench_RawWriteChannel, Bench_RefWriteChannel, Bench_DioWriteChannel
+    };
+    uint32 RefRead[DIO_CONFIGURED_PORTS];
+    uint32 DioReadMin = 0xFFFFFFFFUL;
+    uint32 DioReadMax = 0U;
+    uint8 PortId;
+
+    printf("host x86-64 instructions/call (the register model not counted) of the bare access, the reference\n"
+           "and the DIO service\n");
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        uint32 Sums[6] = { 0U, 0U, 0U, 0U, 0U, 0U };
+        uint32 Channels = 0U;
+        uint8 Way;
+        Dio_ChannelType ChannelId;
+
+        for (ChannelId = (Dio_ChannelType)(PortId * 8U);
+             (ChannelId < (Dio_ChannelType)((PortId + 1U) * 8U)) && (ChannelId < DIO_CONFIGURED_CHANNELS); ChannelId++)
+        {
+            for (Way = 0U; Way < 3U; Way++)
+            {
+                uint32 Read = Bench_Instructions(Reads[Way], NULL_PTR, ChannelId);
+                Sums[Way] += Read;
+                Sums[3U + Way] += Bench_Instructions(NULL_PTR, Writes[Way], ChannelId);
+                if ((Way == 2U) && (Bench_IsShadowed(ChannelId) == FALSE))
+                {
+                    DioReadMin = (Read < DioReadMin) ? Read : DioReadMin;
+                    DioReadMax = (Read > DioReadMax) ? Read : DioReadMax;
+                }
+            }
+            Channels++;
+        }
+        RefRead[PortId] = Sums[1] / Channels;
+        printf("P%c read  %5.1f %5.1f %5.1f  write %5.1f %5.1f %5.1f\n", 'A' + PortId,
+               (double)Sums[0] / Channels, (double)Sums[1] / Channels, (double)Sums[2] / Channels,
+               (double)Sums[3] / Channels, (double)Sums[4] / Channels, (double)Sums[5] / Channels);
+    }
+    if (DioReadMax == 0U)
+    {
+        printf("instructions not counted on this host\n");
+        return 0U;
+    }
+    return ((DioReadMin != DioReadMax) ? 1U : 0U) + ((RefRead[PORTF] <= RefRead[PORTA]) ? 1U : 0U);
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+    uint32 Pass;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+
+    for (Pass = 0U; Pass < BENCH_CHECKS; Pass++)
+    {
+        Errors += Bench_CheckReads(Bench_DioReadChannel, Bench_RefReadChannel);
+        if ((Pass & 1U) != 0U)
+        {
+            Errors += Bench_CheckWrites(Bench_DioWriteChannel);
+        }
+        else
+        {
+            /* The reference stores bypass the output shadow, Dio_Init takes it again from the pins */
+            Errors += Bench_CheckWrites(Bench_RefWriteChannel);
+            Dio_Init(&Dio_Configuration);
+        }
+    }
+
+    printf("%u channels, %lu passes\n", (unsigned)DIO_CONFIGURED_CHANNELS, (unsigned long)BENCH_PASSES);
+    Errors += Bench_TimeReads("reference read", FALSE, Bench_RefReadChannel);
+    Errors += Bench_TimeReads("Dio_ReadChannel", TRUE, Bench_DioReadChannel);
+    Errors += Bench_TimeWrites("reference read-modify-write", FALSE, Bench_RefWriteChannel);
+    Dio_Init(&Dio_Configuration);
+    Errors += Bench_TimeWrites("Dio_WriteChannel", TRUE, Bench_DioWriteChannel);
+    Errors += Mcal_Sim_GetStats()->wrong_aperture_accesses;
+    Dio_Init(&Dio_Configuration);
+    Errors += Bench_PortInstructions();
+
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
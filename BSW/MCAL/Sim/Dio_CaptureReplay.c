@@ -0,0 +1,409 @@
+/**
+ * @file Dio_CaptureReplay.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host replay of recorded stimulus through the DIO logic capture and benchmark of its edge decoder
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details The stimulus is applied to the simulated GPIO inputs while the simulated timers and uDMA fill the
+ *          capture rings, every notified half is decoded with Dio_DecodeCaptureEdges and with a per-channel
+ *          reference decoder, the edges are checked against the ones expected from the stimulus.
+ *          A stimulus file holds one change per line, "<clock> <port A..F> <hex levels>" with the clocks
+ *          counted from the capture start and not decreasing, '#' starts a comment (see Dio_CaptureStimulus.txt).
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_CaptureReplay.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_CaptureReplay
+ *          ./Dio_CaptureReplay Sim/Dio_CaptureStimulus.txt   (replay a file)
+ *          ./Dio_CaptureReplay -g 200000                     (replay 200000 generated changes)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Capture of the replay: every port, period and ring length */
+#define REPLAY_PERIOD                  (800U)
+#define REPLAY_LENGTH                  (512U)
+#define REPLAY_HALF                    (REPLAY_LENGTH / 2U)
+
+/* Default number of generated changes */
+#define REPLAY_GENERATED_EVENTS        (200000UL)
+
+/* One change of the stimulus */
+typedef struct
+{
+    uint32 clock;
+    uint8 port;
+    uint8 levels;
+}Replay_EventType;
+
+STATIC Replay_EventType * Replay_Events = NULL_PTR;
+STATIC uint32 Replay_EventCount = 0U;
+
+STATIC Dio_PortLevelType Replay_Buffer[MCAL_SIM_GPIO_PORTS * REPLAY_LENGTH];
+STATIC const Dio_PortType Replay_Ports[MCAL_SIM_GPIO_PORTS] = { PORTA, PORTB, PORTC, PORTD, PORTE, PORTF };
+STATIC Dio_PortLevelType Replay_Level[MCAL_SIM_GPIO_PORTS];           /* Decoder state of Dio_DecodeCaptureEdges */
+STATIC Dio_PortLevelType Replay_ReferenceLevel[MCAL_SIM_GPIO_PORTS];  /* Decoder state of the reference decoder */
+
+/* Edges decoded by Dio_DecodeCaptureEdges */
+STATIC Dio_CaptureEdgeType * Replay_Decoded = NULL_PTR;
+STATIC uint32 Replay_DecodedCount = 0U;
+STATIC uint32 Replay_DecodedCapacity = 0U;
+STATIC uint32 Replay_ReferenceCount = 0U;
+STATIC double Replay_DecodeSeconds = 0.0;
+STATIC double Replay_ReferenceSeconds = 0.0;
+STATIC uint32 Replay_Halves = 0U;
+
+/* Appends one change to the stimulus */
+STATIC void Replay_AddEvent(uint32 Clock, uint8 Port, uint8 Levels)
+{
+    STATIC uint32 Capacity = 0U;
+    if (Replay_EventCount == Capacity)
+    {
+        Capacity = (Capacity == 0U) ? 1024U : (Capacity * 2U);
+        Replay_Events = realloc(Replay_Events, Capacity * sizeof(Replay_EventType));
+        if (Replay_Events == NULL_PTR)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(2);
+        }
+    }
+    Replay_Events[Replay_EventCount].clock = Clock;
+    Replay_Events[Replay_EventCount].port = Port;
+    Replay_Events[Replay_EventCount].levels = Levels;
+    Replay_EventCount++;
+}
+
+/* Reads a stimulus file, returns FALSE on a malformed line */
+STATIC boolean Replay_Load(const char * Path)
+{
+    char Line[128];
+    uint32 LineNumber = 0U;
+    uint32 Last = 0U;
+    FILE * File = fopen(Path, "r");
+
+    if (File == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", Path);
+        return FALSE;
+    }
+    while (fgets(Line, sizeof(Line), File) != NULL)
+    {
+        unsigned long Clock;
+        char Port;
+        unsigned int Levels;
+        char * Comment = strchr(Line, '#');
+
+        LineNumber++;
+        if (Comment != NULL)
+        {
+            *Comment = '\0';
+        }
+        if (strspn(Line, " \t\r\n") == strlen(Line))
+        {
+            continue;
+        }
+        if ((sscanf(Line, "%lu %c %x", &Clock, &Port, &Levels) != 3) || (Port < 'A') || (Port > 'F')
+            || (Levels > 0xFFU) || ((uint32)Clock < Last))
+        {
+            fprintf(stderr, "%s:%lu: malformed change\n", Path, (unsigned long)LineNumber);
+            fclose(File);
+            return FALSE;
+        }
+        Last = (uint32)Clock;
+        Replay_AddEvent((uint32)Clock, (uint8)(Port - 'A'), (uint8)Levels);
+    }
+    fclose(File);
+    return TRUE;
+}
+
+/* Generates Count changes of 1..3 pins, spread over all the ports with bursts shorter than the sample period */
+STATIC void Replay_Generate(uint32 Count)
+{
+    uint32 Random = 12345U;
+    uint8 Levels[MCAL_SIM_GPIO_PORTS] = { 0U };
+    uint32 Clock = REPLAY_PERIOD;
+    uint32 Index;
+
+    for (Index = 0U; Index < Count; Index++)
+    {
+        uint32 Value = Mcal_Sim_Random(&Random);
+        uint8 Port;
+        uint8 Bits;
+
+        Clock += (Value % (4U * REPLAY_PERIOD)) + 1U;
+        Port = (uint8)((Value >> 12U) % MCAL_SIM_GPIO_PORTS);
+        Value = Mcal_Sim_Random(&Random);
+        Bits = (uint8)(1U << (Value & 7U));
+        if (((Value >> 8U) & 3U) == 0U)
+        {
+            Bits |= (uint8)(1U << ((Value >> 12U) & 7U));
+        }
+        Levels[Port] ^= Bits;
+        Replay_AddEvent(Clock, Port, Levels[Port]);
+    }
+}
+
+/* Per-channel decoder: every configured channel of every sample is extracted and compared */
+STATIC uint32 Replay_ReferenceDecode(const Dio_PortLevelType * Samples, uint32 Count, uint8 Slot)
+{
+    uint32 Edges = 0U;
+    uint32 Index;
+    Dio_ChannelType ChannelId;
+
+    for (Index = 0U; Index < Count; Index++)
+    {
+        for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+        {
+            const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[ChannelId];
+            if ((Channel->port == Replay_Ports[Slot])
+                && (((Samples[Index] ^ Replay_ReferenceLevel[Slot]) & Channel->mask) != 0U))
+            {
+                Edges++;
+            }
+        }
+        Replay_ReferenceLevel[Slot] = Samples[Index];
+    }
+    return Edges;
+}
+
+/* Capture notification: decodes the half just filled on every port, then gives it back */
+STATIC void Replay_Notification(uint8 HalfIndex, uint32 FirstSample)
+{
+    uint8 Slot;
+    clock_t Start;
+
+    /* Room for every pin of every sample of the half */
+    if ((Replay_DecodedCapacity - Replay_DecodedCount) < (MCAL_SIM_GPIO_PORTS * REPLAY_HALF * 8U))
+    {
+        Replay_DecodedCapacity = (Replay_DecodedCapacity * 2U) + (MCAL_SIM_GPIO_PORTS * REPLAY_HALF * 8U);
+        Replay_Decoded = realloc(Replay_Decoded, Replay_DecodedCapacity * sizeof(Dio_CaptureEdgeType));
+        if (Replay_Decoded == NULL_PTR)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(2);
+        }
+    }
+
+    Start = clock();
+    for (Slot = 0U; Slot < MCAL_SIM_GPIO_PORTS; Slot++)
+    {
+        const Dio_PortLevelType * Samples = &Replay_Buffer[(Slot * REPLAY_LENGTH) + (HalfIndex * REPLAY_HALF)];
+        Replay_DecodedCount += Dio_DecodeCaptureEdges(Samples, REPLAY_HALF, Replay_Ports[Slot], FirstSample,
+                                                      &Replay_Level[Slot], &Replay_Decoded[Replay_DecodedCount],
+                                                      Replay_DecodedCapacity - Replay_DecodedCount);
+    }
+    Replay_DecodeSeconds += (double)(clock() - Start) / CLOCKS_PER_SEC;
+
+    Start = clock();
+    for (Slot = 0U; Slot < MCAL_SIM_GPIO_PORTS; Slot++)
+    {
+        Replay_ReferenceCount += Replay_ReferenceDecode(&Replay_Buffer[(Slot * REPLAY_LENGTH) + (HalfIndex * REPLAY_HALF)],
+                                                        REPLAY_HALF, Slot);
+    }
+    Replay_ReferenceSeconds += (double)(clock() - Start) / CLOCKS_PER_SEC;
+
+    Replay_Halves++;
+    Dio_ReleaseCaptureHalf(HalfIndex);
+}
+
+/* Orders edges by sample then channel */
+STATIC int Replay_CompareEdges(const void * Left, const void * Right)
+{
+    const Dio_CaptureEdgeType * A = Left;
+    const Dio_CaptureEdgeType * B = Right;
+    if (A->sample != B->sample)
+    {
+        return (A->sample < B->sample) ? -1 : 1;
+    }
+    return (int)A->channel - (int)B->channel;
+}
+
+/* Appends the edges of port Port between its last sampled level and its pending level */
+STATIC uint32 Replay_Flush(Dio_CaptureEdgeType * Edges, uint32 Count, uint8 Port, Dio_PortLevelType * Sampled,
+                           Dio_PortLevelType Pending, uint32 Sample)
+{
+    uint32 Changed = (uint32)(Pending ^ *Sampled);
+    uint8 Pin;
+
+    for (Pin = 0U; Pin < 8U; Pin++)
+    {
+        if (((Changed >> Pin) & 1U) != 0U)
+        {
+            Edges[Count].sample = Sample;
+            Edges[Count].channel = (Dio_ChannelType)((Port * 8U) + Pin);
+            Edges[Count].level = (Dio_LevelType)((Pending >> Pin) & 1U);
+            Count++;
+        }
+    }
+    *Sampled = Pending;
+    return Count;
+}
+
+/*
+ * Edges expected from the stimulus: sample n is taken at clock (n + 1) * REPLAY_PERIOD, so it sees the last
+ * change before that clock. Only the pins that read back as inputs (Visible) can change.
+ */
+STATIC uint32 Replay_Expected(Dio_CaptureEdgeType * Edges, const Dio_PortLevelType * Initial,
+                              const Dio_PortLevelType * Visible, uint32 Samples)
+{
+    Dio_PortLevelType Sampled[MCAL_SIM_GPIO_PORTS];
+    Dio_PortLevelType Pending[MCAL_SIM_GPIO_PORTS];
+    uint32 PendingSample[MCAL_SIM_GPIO_PORTS];
+    uint32 Count = 0U;
+    uint32 Index;
+    uint8 Port;
+
+    for (Port = 0U; Port < MCAL_SIM_GPIO_PORTS; Port++)
+    {
+        Sampled[Port] = Initial[Port];
+        Pending[Port] = Initial[Port];
+        PendingSample[Port] = 0U;
+    }
+    for (Index = 0U; Index < Replay_EventCount; Index++)
+    {
+        uint32 Sample = Replay_Events[Index].clock / REPLAY_PERIOD;
+
+        Port = Replay_Events[Index].port;
+        /* The pending level of the port is final once a later sample is reached */
+        if ((Sample != PendingSample[Port]) && (PendingSample[Port] < Samples))
+        {
+            Count = Replay_Flush(Edges, Count, Port, &Sampled[Port], Pending[Port], PendingSample[Port]);
+        }
+        Pending[Port] = (Dio_PortLevelType)((Replay_Events[Index].levels & Visible[Port]) | (Initial[Port] & ~Visible[Port]));
+        PendingSample[Port] = Sample;
+    }
+    for (Port = 0U; Port < MCAL_SIM_GPIO_PORTS; Port++)
+    {
+        if (PendingSample[Port] < Samples)
+        {
+            Count = Replay_Flush(Edges, Count, Port, &Sampled[Port], Pending[Port], PendingSample[Port]);
+        }
+    }
+    qsort(Edges, Count, sizeof(Dio_CaptureEdgeType), Replay_CompareEdges);
+    return Count;
+}
+
+int main(int argc, char * argv[])
+{
+    Dio_CaptureType Capture;
+    Dio_CaptureStatusType Status;
+    Dio_PortLevelType Initial[MCAL_SIM_GPIO_PORTS];
+    Dio_PortLevelType Visible[MCAL_SIM_GPIO_PORTS];
+    Dio_CaptureEdgeType * Expected;
+    uint32 ExpectedCount;
+    uint32 Mismatches = 0U;
+    uint32 Now = 0U;
+    uint32 LoadsBefore;
+    uint32 Index;
+    uint8 Port;
+
+    if ((argc == 3) && (strcmp(argv[1], "-g") == 0))
+    {
+        Replay_Generate((uint32)strtoul(argv[2], NULL, 0));
+    }
+    else if (argc == 2)
+    {
+        if (Replay_Load(argv[1]) == FALSE)
+        {
+            return 2;
+        }
+    }
+    else if (argc == 1)
+    {
+        Replay_Generate(REPLAY_GENERATED_EVENTS);
+    }
+    else
+    {
+        fprintf(stderr, "usage: %s [stimulus file | -g changes]\n", argv[0]);
+        return 2;
+    }
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+
+    /* Pins that read back the driven inputs (configured inputs, not locked, not outputs) */
+    for (Port = 0U; Port < MCAL_SIM_GPIO_PORTS; Port++)
+    {
+        Dio_PortLevelType High;
+        Mcal_Sim_SetInputs(Port, 0xFFU);
+        High = Dio_ReadPort(Port);
+        Mcal_Sim_SetInputs(Port, 0x00U);
+        Visible[Port] = (Dio_PortLevelType)(High & ~Dio_ReadPort(Port));
+        Initial[Port] = Dio_ReadPort(Port);
+        Replay_Level[Port] = Initial[Port];
+        Replay_ReferenceLevel[Port] = Initial[Port];
+    }
+    for (Index = 19U; Index < (19U + MCAL_SIM_GPIO_PORTS); Index++)
+    {
+        Mcal_Sim_SetIsr(Index, Dio_CaptureTimer_Isr);
+    }
+
+    Capture.buffer = Replay_Buffer;
+    Capture.ports = Replay_Ports;
+    Capture.port_count = MCAL_SIM_GPIO_PORTS;
+    Capture.length = REPLAY_LENGTH;
+    Capture.period = REPLAY_PERIOD;
+    Capture.notification = Replay_Notification;
+    if (Dio_StartCapture(&Capture) != E_OK)
+    {
+        fprintf(stderr, "Dio_StartCapture failed\n");
+        return 2;
+    }
+
+    LoadsBefore = Mcal_Sim_GetStats()->loads;
+    for (Index = 0U; Index < Replay_EventCount; Index++)
+    {
+        Mcal_Sim_AdvanceClock(Replay_Events[Index].clock - Now);
+        Now = Replay_Events[Index].clock;
+        Mcal_Sim_SetInputs(Replay_Events[Index].port, Replay_Events[Index].levels);
+    }
+    /* Let the last changes reach a notified half */
+    Mcal_Sim_AdvanceClock(REPLAY_LENGTH * REPLAY_PERIOD);
+    Dio_GetCaptureStatus(&Status);
+    Dio_StopCapture();
+
+    Expected = malloc(((Replay_EventCount * 8U) + 1U) * sizeof(Dio_CaptureEdgeType));
+    if (Expected == NULL_PTR)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 2;
+    }
+    ExpectedCount = Replay_Expected(Expected, Initial, Visible, Status.samples);
+    qsort(Replay_Decoded, Replay_DecodedCount, sizeof(Dio_CaptureEdgeType), Replay_CompareEdges);
+    for (Index = 0U; (Index < ExpectedCount) || (Index < Replay_DecodedCount); Index++)
+    {
+        if ((Index >= ExpectedCount) || (Index >= Replay_DecodedCount)
+            || (Replay_CompareEdges(&Expected[Index], &Replay_Decoded[Index]) != 0)
+            || (Expected[Index].level != Replay_Decoded[Index].level))
+        {
+            Mismatches++;
+        }
+    }
+
+    printf("%lu changes, %lu samples x %u ports, %lu halves, %lu overruns\n",
+           (unsigned long)Replay_EventCount, (unsigned long)Status.samples, MCAL_SIM_GPIO_PORTS,
+           (unsigned long)Replay_Halves, (unsigned long)Status.overruns);
+    printf("%lu uDMA transfers, %.3f CPU register loads/sample\n",
+           (unsigned long)Mcal_Sim_GetStats()->dma_transfers,
+           (double)(Mcal_Sim_GetStats()->loads - LoadsBefore) / ((double)Status.samples * MCAL_SIM_GPIO_PORTS));
+    printf("%-24s %10.1f Msamples/s  %lu edges, %lu mismatches against the stimulus\n", "Dio_DecodeCaptureEdges",
+           ((double)Status.samples * MCAL_SIM_GPIO_PORTS) / (Replay_DecodeSeconds * 1e6),
+           (unsigned long)Replay_DecodedCount, (unsigned long)Mismatches);
+    printf("%-24s %10.1f Msamples/s  %lu edges\n", "per-channel decoder",
+           ((double)Status.samples * MCAL_SIM_GPIO_PORTS) / (Replay_ReferenceSeconds * 1e6),
+           (unsigned long)Replay_ReferenceCount);
+
+    free(Expected);
+    free(Replay_Decoded);
+    free(Replay_Events);
+    return ((Mismatches == 0U) && (Status.overruns == 0U) && (Replay_ReferenceCount == Replay_DecodedCount)) ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file Dio_DebounceBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark of Dio_MainFunction against per-channel debouncing in the application
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Both filters see the same bouncing inputs on the simulated GPIO ports, the benchmark checks they
+ *          give the same debounced levels and reports the register loads and the host time of one tick.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_DebounceBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_DebounceBench && ./Dio_DebounceBench
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of simulated ticks */
+#define BENCH_TICKS                    (100000UL)
+
+/* Per-channel counters of the application filter */
+STATIC uint8 Bench_Counter[DIO_CONFIGURED_CHANNELS];
+STATIC Dio_LevelType Bench_Level[DIO_CONFIGURED_CHANNELS];
+STATIC uint32 Bench_Random = 12345U;
+
+/* Drives every port with its stable level plus a few bouncing pins */
+STATIC void Bench_DriveInputs(uint8 * Stable)
+{
+    uint8 Port;
+    for (Port = 0U; Port < MCAL_SIM_GPIO_PORTS; Port++)
+    {
+        if ((Mcal_Sim_Random(&Bench_Random) & 0x3FU) == 0U)
+        {
+            Stable[Port] ^= (uint8)(1U << (Mcal_Sim_Random(&Bench_Random) & 7U));
+        }
+        Mcal_Sim_SetInputs(Port, (uint8)(Stable[Port] ^ (Mcal_Sim_Random(&Bench_Random) & Mcal_Sim_Random(&Bench_Random) & Mcal_Sim_Random(&Bench_Random) & 0xFFU)));
+    }
+}
+
+/* Debouncing done by the application: one Dio_ReadChannel and one counter per channel */
+STATIC void Bench_ApplicationFilter(boolean Seed)
+{
+    uint8 ChannelId;
+    for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+    {
+        uint8 Depth = Dio_Configuration.DebounceDepth[ChannelId];
+        Dio_LevelType Sample = Dio_ReadChannel(ChannelId);
+        uint8 Reload = (uint8)(((Depth > (1U << DIO_DEBOUNCE_COUNTER_BITS)) ? (1U << DIO_DEBOUNCE_COUNTER_BITS) : Depth) - 1U);
+
+        if ((Seed == TRUE) || (Depth == 0U))
+        {
+            Bench_Level[ChannelId] = Sample;
+            Bench_Counter[ChannelId] = Reload;
+        }
+        else if (Sample == Bench_Level[ChannelId])
+        {
+            Bench_Counter[ChannelId] = Reload;
+        }
+        else if (Bench_Counter[ChannelId] == 0U)
+        {
+            Bench_Level[ChannelId] = Sample;
+            Bench_Counter[ChannelId] = Reload;
+        }
+        else
+        {
+            Bench_Counter[ChannelId]--;
+        }
+    }
+}
+
+/* Runs BENCH_TICKS ticks of one filter, returns the number of mismatches against the other one */
+STATIC uint32 Bench_Run(const char * Name, boolean Parallel)
+{
+    uint8 Stable[MCAL_SIM_GPIO_PORTS] = { 0x00U, 0xFFU, 0xA0U, 0x0FU, 0x3CU, 0x11U };
+    uint32 Mismatches = 0U;
+    uint32 Loads = 0U;
+    uint32 Edges = 0U;
+    double Seconds = 0.0;
+    uint32 Tick;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Bench_Random = 12345U;
+
+    for (Tick = 0U; Tick < BENCH_TICKS; Tick++)
+    {
+        uint32 LoadsBefore;
+        clock_t Start;
+        uint8 ChannelId;
+
+        Bench_DriveInputs(Stable);
+        LoadsBefore = Mcal_Sim_GetStats()->loads;
+        Start = clock();
+        if (Parallel == TRUE)
+        {
+            Dio_MainFunction();
+        }
+        else
+        {
+            Bench_ApplicationFilter((Tick == 0U) ? TRUE : FALSE);
+        }
+        Seconds += (double)(clock() - Start) / CLOCKS_PER_SEC;
+        Loads += Mcal_Sim_GetStats()->loads - LoadsBefore;
+
+        /* Both filters run on the same inputs, so the parallel one is checked against a reference run */
+        if (Parallel == TRUE)
+        {
+            Edges += (uint32)__builtin_popcountll(Dio_GetRisingEdges() | Dio_GetFallingEdges());
+            Bench_ApplicationFilter((Tick == 0U) ? TRUE : FALSE);
+            for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+            {
+                if (Dio_GetChannelFromImage(Dio_GetDebouncedLevels(), ChannelId) != Bench_Level[ChannelId])
+                {
+                    Mismatches++;
+                }
+            }
+        }
+    }
+
+    printf("%-24s %8.2f register loads/tick %10.1f ns/tick", Name,
+           (double)Loads / BENCH_TICKS, (Seconds * 1e9) / BENCH_TICKS);
+    if (Parallel == TRUE)
+    {
+        printf("  %lu edges, %lu mismatches", (unsigned long)Edges, (unsigned long)Mismatches);
+    }
+    printf("\n");
+    return Mismatches;
+}
+
+int main(void)
+{
+    uint32 Mismatches;
+    (void)Bench_Run("application filter", FALSE);
+    Mismatches = Bench_Run("Dio_MainFunction", TRUE);
+    return (Mismatches == 0U) ? 0 : 1;
+}
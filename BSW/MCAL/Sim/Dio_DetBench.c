@@ -0,0 +1,282 @@
+/**
+ * @file Dio_DetBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host check of the development errors reported by the DIO services
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Every DIO service is first called before Dio_Init, then with an invalid argument after it. Each
+ *          call must report its service ID and the expected error to the Det and return without any register
+ *          access. The IDs go through volatile variables so the compile-time checks of DIO.h let them through.
+ *          Dio_Init is then called with a copy of Dio_Configuration: the DioConf_<NAME>_PTR symbols must resolve
+ *          in it without any report, and the groups and virtual ports of Dio_Configuration must be rejected.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_DetBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_DetBench && ./Dio_DetBench
+ */
+
+#include <stdio.h>
+#include "DIO/DIO.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* One service call and the error it has to report */
+typedef struct
+{
+    const char * name;
+    void (*call)(void);
+    uint8 sid;
+    uint8 error;
+}Bench_CaseType;
+
+STATIC volatile Dio_ChannelType Bench_ChannelId = 0U;
+STATIC volatile Dio_PortType Bench_PortId = 0U;
+
+STATIC void Bench_ReadChannel(void)              { (void)Dio_ReadChannel(Bench_ChannelId); }
+STATIC void Bench_WriteChannel(void)             { Dio_WriteChannel(Bench_ChannelId, STD_HIGH); }
+STATIC void Bench_FlipChannel(void)              { (void)Dio_FlipChannel(Bench_ChannelId); }
+STATIC void Bench_ReadPort(void)                 { (void)Dio_ReadPort(Bench_PortId); }
+STATIC void Bench_WritePort(void)                { Dio_WritePort(Bench_PortId, 0x55U); }
+STATIC void Bench_MaskedWritePort(void)          { Dio_MaskedWritePort(Bench_PortId, 0x55U, 0x0FU); }
+/* Before Dio_Init there is no configuration set to resolve DioConf_<NAME>_GROUP_PTR in, the groups are taken from
+   the set the bench passes to it */
+STATIC void Bench_ReadGroup(void)                { (void)Dio_ReadChannelGroup(&Dio_Configuration.Groups[0]); }
+STATIC void Bench_WriteGroup(void)               { Dio_WriteChannelGroup(&Dio_Configuration.Groups[0], 0x55U); }
+STATIC void Bench_ReadNullGroup(void)            { (void)Dio_ReadChannelGroup(NULL_PTR); }
+STATIC void Bench_WriteNullGroup(void)           { Dio_WriteChannelGroup(NULL_PTR, 0x55U); }
+/* A copy of a configured group is not one of the groups of the configuration set */
+STATIC void Bench_ReadForeignGroup(void)
+{
+    Dio_ChannelGroupType Group = *DioConf_DISPLAY_BUS_GROUP_PTR;
+    (void)Dio_ReadChannelGroup(&Group);
+}
+STATIC void Bench_WriteForeignGroup(void)
+{
+    Dio_ChannelGroupType Group = *DioConf_DISPLAY_BUS_GROUP_PTR;
+    Dio_WriteChannelGroup(&Group, 0x55U);
+}
+STATIC void Bench_WriteSyncNull(void)            { Dio_WritePortsSynchronous(NULL_PTR); }
+STATIC void Bench_ReadAllPorts(void)             { (void)Dio_ReadAllPorts(); }
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+STATIC void Bench_CheckOutputShadow(void)        { (void)Dio_CheckOutputShadow(); }
+#endif
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+STATIC void Bench_ReadVirtualPort(void)          { (void)Dio_ReadVirtualPort(&Dio_Configuration.VirtualPorts[0]); }
+STATIC void Bench_WriteVirtualPort(void)         { Dio_WriteVirtualPort(&Dio_Configuration.VirtualPorts[0], 0x5555U); }
+STATIC void Bench_ReadForeignVirtualPort(void)
+{
+    Dio_VirtualPortType VirtualPort = *DioConf_ADC_BUS_VPORT_PTR;
+    (void)Dio_ReadVirtualPort(&VirtualPort);
+}
+STATIC void Bench_WriteForeignVirtualPort(void)
+{
+    Dio_VirtualPortType VirtualPort = *DioConf_LCD_BUS_VPORT_PTR;
+    Dio_WriteVirtualPort(&VirtualPort, 0x5555U);
+}
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
+STATIC void Bench_EnableNotification(void)       { Dio_EnableNotification(Bench_ChannelId); }
+STATIC void Bench_DisableNotification(void)      { Dio_DisableNotification(Bench_ChannelId); }
+#endif
+#if (DIO_CAPTURE_API == STD_ON)
+STATIC Dio_PortLevelType Bench_Samples[8];
+STATIC Dio_PortType Bench_CapturePorts[1] = { PORTF };
+STATIC Dio_CaptureType Bench_Capture = { Bench_Samples, Bench_CapturePorts, 1U, 8U, 100U, NULL_PTR };
+
+STATIC void Bench_StartCapture(void)             { (void)Dio_StartCapture(&Bench_Capture); }
+STATIC void Bench_StartNullCapture(void)         { (void)Dio_StartCapture(NULL_PTR); }
+STATIC void Bench_StartEmptyCapture(void)
+{
+    Dio_CaptureType Capture = Bench_Capture;
+    Capture.port_count = 0U;
+    (void)Dio_StartCapture(&Capture);
+}
+STATIC void Bench_StartInvalidCapture(void)
+{
+    STATIC Dio_PortType Ports[1];
+    Dio_CaptureType Capture = Bench_Capture;
+    Ports[0] = Bench_PortId;
+    Capture.ports = Ports;
+    (void)Dio_StartCapture(&Capture);
+}
+STATIC void Bench_DecodeEdges(void)
+{
+    Dio_PortLevelType Level = 0U;
+    Dio_CaptureEdgeType Edges[8];
+    (void)Dio_DecodeCaptureEdges(Bench_Samples, 8U, Bench_PortId, 0U, &Level, Edges, 8U);
+}
+STATIC void Bench_DecodeNullEdges(void)
+{
+    Dio_PortLevelType Level = 0U;
+    (void)Dio_DecodeCaptureEdges(Bench_Samples, 8U, PORTF, 0U, &Level, NULL_PTR, 8U);
+}
+STATIC void Bench_ReleaseCaptureHalf(void)       { Dio_ReleaseCaptureHalf(2U); }
+STATIC void Bench_GetNullCaptureStatus(void)     { Dio_GetCaptureStatus(NULL_PTR); }
+#endif
+#if (DIO_PATTERN_API == STD_ON)
+STATIC const Dio_PortLevelType Bench_PatternHalf[4] = { 0x01U, 0x02U, 0x04U, 0x08U };
+
+STATIC void Bench_StartInvalidPattern(void)
+{
+    Dio_PatternType Pattern = { { Bench_PatternHalf, Bench_PatternHalf }, 4U, 100U, NULL_PTR, 0U, 0x0FU };
+    Pattern.port = Bench_PortId;
+    (void)Dio_StartPattern(&Pattern);
+}
+STATIC void Bench_StartNullPattern(void)         { (void)Dio_StartPattern(NULL_PTR); }
+#endif
+
+/* Calls made before Dio_Init, with valid arguments */
+STATIC const Bench_CaseType Bench_UninitCases[] =
+{
+    { "Dio_ReadChannel",          Bench_ReadChannel,          DIO_READ_CHANNEL_SID,            DIO_E_UNINIT },
+    { "Dio_WriteChannel",         Bench_WriteChannel,         DIO_WRITE_CHANNEL_SID,           DIO_E_UNINIT },
+    { "Dio_FlipChannel",          Bench_FlipChannel,          DIO_FLIP_CHANNEL_SID,            DIO_E_UNINIT },
+    { "Dio_ReadPort",             Bench_ReadPort,             DIO_READ_PORT_SID,               DIO_E_UNINIT },
+    { "Dio_WritePort",            Bench_WritePort,            DIO_WRITE_PORT_SID,              DIO_E_UNINIT },
+    { "Dio_MaskedWritePort",      Bench_MaskedWritePort,      DIO_MASKED_WRITE_PORT_SID,       DIO_E_UNINIT },
+    { "Dio_ReadChannelGroup",     Bench_ReadGroup,            DIO_READ_CHANNEL_GROUP_SID,      DIO_E_UNINIT },
+    { "Dio_WriteChannelGroup",    Bench_WriteGroup,           DIO_WRITE_CHANNEL_GROUP_SID,     DIO_E_UNINIT },
+    { "Dio_WritePortsSynchronous", Bench_WriteSyncNull,       DIO_WRITE_PORTS_SYNCHRONOUS_SID, DIO_E_UNINIT },
+    { "Dio_ReadAllPorts",         Bench_ReadAllPorts,         DIO_READ_ALL_PORTS_SID,          DIO_E_UNINIT },
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+    { "Dio_CheckOutputShadow",    Bench_CheckOutputShadow,    DIO_CHECK_OUTPUT_SHADOW_SID,     DIO_E_UNINIT },
+#endif
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    { "Dio_ReadVirtualPort",      Bench_ReadVirtualPort,      DIO_READ_VIRTUAL_PORT_SID,       DIO_E_UNINIT },
+    { "Dio_WriteVirtualPort",     Bench_WriteVirtualPort,     DIO_WRITE_VIRTUAL_PORT_SID,      DIO_E_UNINIT },
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
+    { "Dio_EnableNotification",   Bench_EnableNotification,   DIO_ENABLE_NOTIFICATION_SID,     DIO_E_UNINIT },
+    { "Dio_DisableNotification",  Bench_DisableNotification,  DIO_DISABLE_NOTIFICATION_SID,    DIO_E_UNINIT },
+#endif
+#if (DIO_CAPTURE_API == STD_ON)
+    { "Dio_StartCapture",         Bench_StartCapture,         DIO_START_CAPTURE_SID,           DIO_E_UNINIT },
+    { "Dio_DecodeCaptureEdges",   Bench_DecodeEdges,          DIO_DECODE_CAPTURE_EDGES_SID,    DIO_E_UNINIT },
+#endif
+#if (DIO_PATTERN_API == STD_ON)
+    { "Dio_StartPattern",         Bench_StartInvalidPattern,  DIO_START_PATTERN_SID,           DIO_E_UNINIT },
+#endif
+};
+
+/* Calls made after Dio_Init, with Bench_ChannelId and Bench_PortId out of range */
+STATIC const Bench_CaseType Bench_ParamCases[] =
+{
+    { "Dio_ReadChannel",          Bench_ReadChannel,          DIO_READ_CHANNEL_SID,            DIO_E_PARAM_INVALID_CHANNEL_ID },
+    { "Dio_WriteChannel",         Bench_WriteChannel,         DIO_WRITE_CHANNEL_SID,           DIO_E_PARAM_INVALID_CHANNEL_ID },
+    { "Dio_FlipChannel",          Bench_FlipChannel,          DIO_FLIP_CHANNEL_SID,            DIO_E_PARAM_INVALID_CHANNEL_ID },
+    { "Dio_ReadPort",             Bench_ReadPort,             DIO_READ_PORT_SID,               DIO_E_PARAM_INVALID_PORT_ID },
+    { "Dio_WritePort",            Bench_WritePort,            DIO_WRITE_PORT_SID,              DIO_E_PARAM_INVALID_PORT_ID },
+    { "Dio_MaskedWritePort",      Bench_MaskedWritePort,      DIO_MASKED_WRITE_PORT_SID,       DIO_E_PARAM_INVALID_PORT_ID },
+    { "Dio_ReadChannelGroup",     Bench_ReadNullGroup,        DIO_READ_CHANNEL_GROUP_SID,      DIO_E_PARAM_POINTER },
+    { "Dio_WriteChannelGroup",    Bench_WriteNullGroup,       DIO_WRITE_CHANNEL_GROUP_SID,     DIO_E_PARAM_POINTER },
+    { "Dio_ReadChannelGroup",     Bench_ReadForeignGroup,     DIO_READ_CHANNEL_GROUP_SID,      DIO_E_PARAM_INVALID_GROUP },
+    { "Dio_WriteChannelGroup",    Bench_WriteForeignGroup,    DIO_WRITE_CHANNEL_GROUP_SID,     DIO_E_PARAM_INVALID_GROUP },
+    { "Dio_WritePortsSynchronous", Bench_WriteSyncNull,       DIO_WRITE_PORTS_SYNCHRONOUS_SID, DIO_E_PARAM_POINTER },
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    { "Dio_ReadVirtualPort",      Bench_ReadForeignVirtualPort,  DIO_READ_VIRTUAL_PORT_SID,    DIO_E_PARAM_INVALID_GROUP },
+    { "Dio_WriteVirtualPort",     Bench_WriteForeignVirtualPort, DIO_WRITE_VIRTUAL_PORT_SID,   DIO_E_PARAM_INVALID_GROUP },
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
+    { "Dio_EnableNotification",   Bench_EnableNotification,   DIO_ENABLE_NOTIFICATION_SID,     DIO_E_PARAM_INVALID_CHANNEL_ID },
+    { "Dio_DisableNotification",  Bench_DisableNotification,  DIO_DISABLE_NOTIFICATION_SID,    DIO_E_PARAM_INVALID_CHANNEL_ID },
+#endif
+#if (DIO_CAPTURE_API == STD_ON)
+    { "Dio_StartCapture",         Bench_StartNullCapture,     DIO_START_CAPTURE_SID,           DIO_E_PARAM_POINTER },
+    { "Dio_StartCapture",         Bench_StartEmptyCapture,    DIO_START_CAPTURE_SID,           DIO_E_PARAM_VALUE },
+    { "Dio_StartCapture",         Bench_StartInvalidCapture,  DIO_START_CAPTURE_SID,           DIO_E_PARAM_INVALID_PORT_ID },
+    { "Dio_DecodeCaptureEdges",   Bench_DecodeEdges,          DIO_DECODE_CAPTURE_EDGES_SID,    DIO_E_PARAM_INVALID_PORT_ID },
+    { "Dio_DecodeCaptureEdges",   Bench_DecodeNullEdges,      DIO_DECODE_CAPTURE_EDGES_SID,    DIO_E_PARAM_POINTER },
+    { "Dio_ReleaseCaptureHalf",   Bench_ReleaseCaptureHalf,   DIO_RELEASE_CAPTURE_HALF_SID,    DIO_E_PARAM_VALUE },
+    { "Dio_GetCaptureStatus",     Bench_GetNullCaptureStatus, DIO_GET_CAPTURE_STATUS_SID,      DIO_E_PARAM_POINTER },
+#endif
+#if (DIO_PATTERN_API == STD_ON)
+    { "Dio_StartPattern",         Bench_StartNullPattern,     DIO_START_PATTERN_SID,           DIO_E_PARAM_POINTER },
+    { "Dio_StartPattern",         Bench_StartInvalidPattern,  DIO_START_PATTERN_SID,           DIO_E_PARAM_INVALID_PORT_ID },
+#endif
+};
+
+/* Calls made after Dio_Init with Bench_OtherSet, on the groups and virtual ports of Dio_Configuration */
+STATIC const Bench_CaseType Bench_OtherSetCases[] =
+{
+    { "Dio_ReadChannelGroup",     Bench_ReadGroup,            DIO_READ_CHANNEL_GROUP_SID,      DIO_E_PARAM_INVALID_GROUP },
+    { "Dio_WriteChannelGroup",    Bench_WriteGroup,           DIO_WRITE_CHANNEL_GROUP_SID,     DIO_E_PARAM_INVALID_GROUP },
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    { "Dio_ReadVirtualPort",      Bench_ReadVirtualPort,      DIO_READ_VIRTUAL_PORT_SID,       DIO_E_PARAM_INVALID_GROUP },
+    { "Dio_WriteVirtualPort",     Bench_WriteVirtualPort,     DIO_WRITE_VIRTUAL_PORT_SID,      DIO_E_PARAM_INVALID_GROUP },
+#endif
+};
+
+/* Second configuration set, a copy of Dio_Configuration at another address */
+STATIC Dio_ConfigType Bench_OtherSet;
+
+/* Runs the cases, returns the number of calls that did not report their error or that accessed a register */
+STATIC uint32 Bench_Run(const char * Title, const Bench_CaseType * Cases, uint32 Count)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Errors = 0U;
+    uint32 Index;
+
+    for (Index = 0U; Index < Count; Index++)
+    {
+        const Bench_CaseType * Case = &Cases[Index];
+        uint32 Accesses = Stats->loads + Stats->stores;
+        Det_ErrorType Error;
+        uint32 Reports;
+
+        Det_GetLastError(&Error);
+        Reports = Error.Count;
+        Case->call();
+        Det_GetLastError(&Error);
+        Accesses = Stats->loads + Stats->stores - Accesses;
+        if ((Error.Count != (Reports + 1U)) || (Error.ModuleId != DIO_MODULE_ID) || (Error.ApiId != Case->sid)
+            || (Error.ErrorId != Case->error) || (Accesses != 0U))
+        {
+            printf("%s %-26s reported 0x%02X/0x%02X (expected 0x%02X/0x%02X), %lu register accesses\n", Title, Case->name,
+                   Error.ApiId, Error.ErrorId, Case->sid, Case->error, (unsigned long)Accesses);
+            Errors++;
+        }
+    }
+    printf("%-24s %2lu services checked, %lu errors\n", Title, (unsigned long)Count, (unsigned long)Errors);
+    return Errors;
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Det_Init();
+    Port_Init(&Port_Configuration);
+
+    Errors += Bench_Run("before Dio_Init", Bench_UninitCases, sizeof(Bench_UninitCases) / sizeof(Bench_UninitCases[0]));
+
+    Dio_Init(&Dio_Configuration);
+    Bench_ChannelId = DIO_CONFIGURED_CHANNELS;
+    Bench_PortId = DIO_CONFIGURED_PORTS;
+    Errors += Bench_Run("invalid arguments", Bench_ParamCases, sizeof(Bench_ParamCases) / sizeof(Bench_ParamCases[0]));
+
+    /* The DioConf_<NAME>_PTR symbols follow the set Dio_Init was called with, the groups of another set are rejected */
+    Bench_OtherSet = Dio_Configuration;
+    Dio_Init(&Bench_OtherSet);
+    {
+        Det_ErrorType Error;
+        uint32 Reports;
+
+        Det_GetLastError(&Error);
+        Reports = Error.Count;
+        Dio_WriteChannelGroup(DioConf_DISPLAY_BUS_GROUP_PTR, Dio_ReadChannelGroup(DioConf_DISPLAY_BUS_GROUP_PTR));
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+        Dio_WriteVirtualPort(DioConf_LCD_BUS_VPORT_PTR, Dio_ReadVirtualPort(DioConf_LCD_BUS_VPORT_PTR));
+#endif
+        Det_GetLastError(&Error);
+        printf("%-24s %2lu reports on its own groups and virtual ports\n", "other configuration set",
+               (unsigned long)(Error.Count - Reports));
+        Errors += Error.Count - Reports;
+    }
+    Errors += Bench_Run("other configuration set", Bench_OtherSetCases,
+                        sizeof(Bench_OtherSetCases) / sizeof(Bench_OtherSetCases[0]));
+    return (Errors == 0U) ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file Dio_FastPathBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host check and benchmark of the inline fast path of Dio_ReadChannel and Dio_WriteChannel
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details The pin aperture the fast path builds for every channel ID must be the bits_address of the channel
+ *          descriptor of Dio_PBcfg.c. Reads and writes of constant channel IDs through the fast path must
+ *          return the same levels and drive the same pins as the DIO.c functions, called here by their
+ *          parenthesized names so the DIO.h macros do not apply. The channels of the shadowed pins must stay
+ *          on the DIO.c functions, so the output shadow keeps matching the pins. Then a write and a read of a
+ *          constant channel are timed both ways, with the register accesses and the host x86-64 instructions
+ *          (the register model not counted) per call, next to the bare register access (Bench_Raw*) whose time
+ *          is mostly the simulator's: the difference is the cost of the driver. The code size of both ways is
+ *          that of the Bench_Inline* and Bench_Call* functions, compare them with nm -S (plus the DIO.c
+ *          functions for the calls).
+ *          Build and run from BSW/MCAL, with the output shadow on or off:
+ *          gcc -O2 -DMCAL_HOST_SIM -DDIO_INLINE_FAST_PATH=STD_ON -I.
+ *              Sim/Dio_FastPathBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c Port/Port.c Port/Port_PBcfg.c
+ *              Det/Det.c -o Dio_FastPathBench && ./Dio_FastPathBench
+ *          nm -S --size-sort Dio_FastPathBench | grep -e Bench_ -e Dio_ReadChannel -e Dio_WriteChannel
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+#if (DIO_INLINE_FAST_PATH == STD_OFF)
+#error "Build with -DDIO_INLINE_FAST_PATH=STD_ON"
+#endif
+
+/* Number of checks of the constant channels, of calls of a timing run and of runs per timed line (best kept) */
+#define BENCH_CHECKS                   (1000U)
+#define BENCH_TIMED_CALLS              (1000000UL)
+#define BENCH_TIMED_RUNS               (5U)
+
+/* Timed channels: an output not shadowed (PF3, LCD D3) and an input (PF4) */
+#define BENCH_WRITE_CHANNEL            (43U)
+#define BENCH_READ_CHANNEL             DioConf_SW1_CHANNEL_ID
+
+STATIC uint32 Bench_Random = 12345U;
+
+/* Writes Level to output channel CHANNEL inline and through DIO.c, returns 1 when the pins differ */
+#define BENCH_CHECK_WRITE(CHANNEL, PORT, Level, Errors)                                 \
+    do {                                                                                \
+        uint8 Inline;                                                                   \
+        Dio_WriteChannel(CHANNEL, Level);                                               \
+        Inline = Mcal_Sim_GetOutputs(PORT);                                             \
+        Dio_WriteChannel(CHANNEL, (Dio_LevelType)(Level ^ STD_HIGH));                   \
+        (Dio_WriteChannel)(CHANNEL, Level);                                             \
+        (Errors) += (Mcal_Sim_GetOutputs(PORT) != Inline) ? 1U : 0U;                    \
+    } while (0)
+
+/* Reads channel CHANNEL inline and through DIO.c, returns 1 when the levels differ */
+#define BENCH_CHECK_READ(CHANNEL, Errors)                                               \
+    do {                                                                                \
+        (Errors) += (Dio_ReadChannel(CHANNEL) != (Dio_ReadChannel)(CHANNEL)) ? 1U : 0U; \
+    } while (0)
+
+__attribute__((noinline)) STATIC void Bench_RawWrite(Dio_LevelType Level)
+{
+    MCAL_REG_WRITE32(Dio_Configuration.Channels[BENCH_WRITE_CHANNEL].bits_address, (Level == STD_HIGH) ? 0xFFU : 0U);
+}
+
+__attribute__((noinline)) STATIC void Bench_InlineWrite(Dio_LevelType Level)
+{
+    Dio_WriteChannel(BENCH_WRITE_CHANNEL, Level);
+}
+
+__attribute__((noinline)) STATIC void Bench_CallWrite(Dio_LevelType Level)
+{
+    (Dio_WriteChannel)(BENCH_WRITE_CHANNEL, Level);
+}
+
+__attribute__((noinline)) STATIC Dio_LevelType Bench_RawRead(void)
+{
+    return (Dio_LevelType)(MCAL_REG_READ32(Dio_Configuration.Channels[BENCH_READ_CHANNEL].bits_address) != 0U);
+}
+
+__attribute__((noinline)) STATIC Dio_LevelType Bench_InlineRead(void)
+{
+    return Dio_ReadChannel(BENCH_READ_CHANNEL);
+}
+
+__attribute__((noinline)) STATIC Dio_LevelType Bench_CallRead(void)
+{
+    return (Dio_ReadChannel)(BENCH_READ_CHANNEL);
+}
+
+/* Times BENCH_TIMED_CALLS calls of Write (when not NULL_PTR) or Read and prints their line, returns the host
+   instructions of one call (0 on the hosts where they cannot be counted) */
+STATIC uint32 Bench_Time(const char * Name, void (*Write)(Dio_LevelType), Dio_LevelType (*Read)(void))
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Loads = Stats->loads;
+    uint32 Stores = Stats->stores;
+    uint32 Levels = 0U;
+    double Best = 0.0;
+    uint32 Empty;
+    uint32 Instructions;
+    uint32 Run;
+    uint32 Index;
+
+    for (Run = 0U; Run < BENCH_TIMED_RUNS; Run++)
+    {
+        clock_t Start = clock();
+        double Time;
+        for (Index = 0U; Index < BENCH_TIMED_CALLS; Index++)
+        {
+            if (Write != NULL_PTR)
+            {
+                Write((Dio_LevelType)(Index & 1U));
+            }
+            else
+            {
+                Levels += Read();
+            }
+        }
+        Time = ((double)(clock() - Start) / CLOCKS_PER_SEC) * 1e9 / BENCH_TIMED_CALLS;
+        Best = ((Run == 0U) || (Time < Best)) ? Time : Best;
+    }
+    Mcal_Sim_StartInstructionCount();
+    Empty = Mcal_Sim_StopInstructionCount();
+    Mcal_Sim_StartInstructionCount();
+    if (Write != NULL_PTR)
+    {
+        Write(STD_HIGH);
+    }
+    else
+    {
+        Levels += Read();
+    }
+    Instructions = Mcal_Sim_StopInstructionCount() - Empty;
+    printf("%-32s %5.2f loads %5.2f stores/call %6.1f ns/call %3lu instructions/call on the host\n", Name,
+           (double)(Stats->loads - Loads) / (BENCH_TIMED_CALLS * BENCH_TIMED_RUNS),
+           (double)(Stats->stores - Stores) / (BENCH_TIMED_CALLS * BENCH_TIMED_RUNS), Best,
+           (unsigned long)Instructions);
+    (void)Levels;
+    return Instructions;
+}
+
+int main(void)
+{
+    uint32 AddressErrors = 0U;
+    uint32 WriteErrors = 0U;
+    uint32 ReadErrors = 0U;
+    uint32 ShadowErrors = 0U;
+    uint32 CostErrors = 0U;
+    uint32 Instructions[6];
+    uint32 Check;
+    Dio_ChannelType ChannelId;
+    uint8 PortId;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+
+    for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+    {
+        AddressErrors += (DIO_CHANNEL_BITS_ADDRESS(ChannelId) != Dio_Configuration.Channels[ChannelId].bits_address)
+                       ? 1U : 0U;
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+        /* The inline path must leave every pin of the shadow of the configuration set to DIO.c */
+        ShadowErrors += ((DIO_CHANNEL_SHADOWED(ChannelId) != 0U)
+                         != ((Dio_Configuration.ShadowPins[Dio_Configuration.Channels[ChannelId].port]
+                              & Dio_Configuration.Channels[ChannelId].mask) != 0U)) ? 1U : 0U;
+#endif
+    }
+
+    for (Check = 0U; Check < BENCH_CHECKS; Check++)
+    {
+        Dio_LevelType Level = (Dio_LevelType)(Mcal_Sim_Random(&Bench_Random) & 1U);
+
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+        {
+            Mcal_Sim_SetInputs(PortId, (uint8)Mcal_Sim_Random(&Bench_Random));
+        }
+        BENCH_CHECK_WRITE(5U, PORTA, Level, WriteErrors);                              /* PA5, LCD D0 */
+        BENCH_CHECK_WRITE(25U, PORTD, Level, WriteErrors);                             /* PD1, LCD D1 */
+        BENCH_CHECK_WRITE(DioConf_LED1_CHANNEL_ID, PORTF, Level, WriteErrors);
+        BENCH_CHECK_WRITE(43U, PORTF, Level, WriteErrors);                             /* PF3, LCD D3 */
+        BENCH_CHECK_READ(0U, ReadErrors);                                              /* PA0, ADC D0 */
+        BENCH_CHECK_READ(28U, ReadErrors);                                             /* PD4, ADC D2 */
+        BENCH_CHECK_READ(DioConf_SW1_CHANNEL_ID, ReadErrors);
+        BENCH_CHECK_READ(DioConf_LED1_CHANNEL_ID, ReadErrors);
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+        /* LED1 (PF1) is shadowed, its constant writes must have updated the shadow */
+        ShadowErrors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+#endif
+    }
+    printf("%lu aperture, %lu write, %lu read mismatches with the channel table and the DIO.c functions, "
+           "%lu output shadow mismatches\n", (unsigned long)AddressErrors, (unsigned long)WriteErrors,
+           (unsigned long)ReadErrors, (unsigned long)ShadowErrors);
+
+    Instructions[0] = Bench_Time("register store PF3", Bench_RawWrite, NULL_PTR);
+    Instructions[1] = Bench_Time("Dio_WriteChannel PF3 (inline)", Bench_InlineWrite, NULL_PTR);
+    Instructions[2] = Bench_Time("Dio_WriteChannel PF3 (call)", Bench_CallWrite, NULL_PTR);
+    Instructions[3] = Bench_Time("register load PF4", NULL_PTR, Bench_RawRead);
+    Instructions[4] = Bench_Time("Dio_ReadChannel PF4 (inline)", NULL_PTR, Bench_InlineRead);
+    Instructions[5] = Bench_Time("Dio_ReadChannel PF4 (call)", NULL_PTR, Bench_CallRead);
+
+    /* The inline path must cost less than the call where it is counted, and no more than the bare access when
+       the trace is off */
+    if ((Instructions[2] != 0U) && ((Instructions[1] >= Instructions[2]) || (Instructions[4] >= Instructions[5])))
+    {
+        printf("the inline path is not cheaper than the call\n");
+        CostErrors++;
+    }
+#if (TRACE_API == STD_OFF)
+    if ((Instructions[1] > Instructions[0]) || (Instructions[4] > Instructions[3]))
+    {
+        printf("the inline path is dearer than the bare access\n");
+        CostErrors++;
+    }
+#endif
+    return ((AddressErrors + WriteErrors + ReadErrors + ShadowErrors + CostErrors) == 0U) ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file Dio_GatedPortBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host check of the DIO driver on a port whose clock Port_Init gated off
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details The port E pins of the Port configuration are replaced by copies of the PA0..PA5 ones, so Port_Init
+ *          leaves port E gated off (PORT_GATE_UNUSED_PORTS). Dio_Init, Dio_MainFunction, Dio_ReadAllPorts and
+ *          Dio_CheckOutputShadow then run on random input levels: none of them may access port E, which reads as
+ *          0 in the images while the other ports read their DATA register. The port services and Dio_StartCapture
+ *          called on port E, and the group, synchronous list and virtual port services whose pins are on it, must
+ *          report an invalid port ID without any register access. The channel services called on its channels
+ *          must report an invalid channel ID.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_GatedPortBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_GatedPortBench && ./Dio_GatedPortBench
+ */
+
+#include <stdio.h>
+#include "DIO/DIO.h"
+#include "Port/Port.h"
+#include "Port/Port_Private.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of Dio_MainFunction periods run on the gated configuration */
+#define BENCH_PERIODS                  (256U)
+
+/* Port left without a configured pin */
+#define BENCH_GATED_PORT               PORTE
+
+STATIC volatile Dio_PortType Bench_PortId = BENCH_GATED_PORT;
+STATIC volatile Dio_ChannelType Bench_ChannelId = 0U;
+STATIC const Dio_ChannelGroupType * volatile Bench_Group = NULL_PTR;
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+STATIC const Dio_VirtualPortType * volatile Bench_VirtualPort = NULL_PTR;
+#endif
+STATIC uint32 Bench_Random = 12345U;
+
+/* Calls Call on the gated port, returns 1 when it did not report ExpectedError or accessed a register */
+STATIC uint32 Bench_Reject(const char * Name, void (*Call)(void), uint8 Sid, uint8 ExpectedError)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Accesses = Stats->loads + Stats->stores;
+    Det_ErrorType Error;
+    uint32 Reports;
+
+    Det_GetLastError(&Error);
+    Reports = Error.Count;
+    Call();
+    Det_GetLastError(&Error);
+    Accesses = Stats->loads + Stats->stores - Accesses;
+    if ((Error.Count != (Reports + 1U)) || (Error.ApiId != Sid) || (Error.ErrorId != ExpectedError)
+        || (Accesses != 0U))
+    {
+        printf("%-22s reported 0x%02X/0x%02X, %lu register accesses\n", Name, Error.ApiId, Error.ErrorId,
+               (unsigned long)Accesses);
+        return 1U;
+    }
+    return 0U;
+}
+
+STATIC void Bench_ReadPort(void)                 { (void)Dio_ReadPort(Bench_PortId); }
+STATIC void Bench_WritePort(void)                { Dio_WritePort(Bench_PortId, 0x55U); }
+STATIC void Bench_MaskedWritePort(void)          { Dio_MaskedWritePort(Bench_PortId, 0x55U, 0x0FU); }
+STATIC void Bench_ReadChannel(void)              { (void)Dio_ReadChannel(Bench_ChannelId); }
+STATIC void Bench_WriteChannel(void)             { Dio_WriteChannel(Bench_ChannelId, STD_HIGH); }
+STATIC void Bench_FlipChannel(void)              { (void)Dio_FlipChannel(Bench_ChannelId); }
+STATIC void Bench_ReadGroup(void)                { (void)Dio_ReadChannelGroup(Bench_Group); }
+STATIC void Bench_WriteGroup(void)               { Dio_WriteChannelGroup(Bench_Group, 0x55U); }
+STATIC void Bench_WriteSync(void)
+{
+    Dio_PortLevelType Levels[DIO_CONFIGURED_SYNC_PORT_WRITES] = { 0U };
+    Dio_WritePortsSynchronous(Levels);
+}
+#if (DIO_NOTIFICATION_API == STD_ON)
+STATIC void Bench_EnableNotification(void)       { Dio_EnableNotification(Bench_ChannelId); }
+STATIC void Bench_DisableNotification(void)      { Dio_DisableNotification(Bench_ChannelId); }
+#endif
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+STATIC void Bench_ReadVirtualPort(void)          { (void)Dio_ReadVirtualPort(Bench_VirtualPort); }
+STATIC void Bench_WriteVirtualPort(void)         { Dio_WriteVirtualPort(Bench_VirtualPort, 0x5555U); }
+
+/* Virtual port VirtualPort has pins on the gated port */
+STATIC boolean Bench_OnGatedPort(const Dio_VirtualPortType * VirtualPort)
+{
+    uint8 Index;
+
+    for (Index = 0U; Index < VirtualPort->access_count; Index++)
+    {
+        if (VirtualPort->accesses[Index].port == BENCH_GATED_PORT)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+#endif
+#if (DIO_CAPTURE_API == STD_ON)
+STATIC void Bench_StartCapture(void)
+{
+    STATIC Dio_PortLevelType Samples[8];
+    STATIC Dio_PortType Ports[1];
+    Dio_CaptureType Capture = { Samples, Ports, 1U, 8U, 100U, NULL_PTR };
+    Ports[0] = Bench_PortId;
+    (void)Dio_StartCapture(&Capture);
+}
+#endif
+
+/* Number of clocked ports whose byte of Image is not their DATA register, or gated ports whose byte is not 0 */
+STATIC uint32 Bench_CheckImage(Dio_PortsImageType Image)
+{
+    uint32 Errors = 0U;
+    uint8 PortId;
+
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        uint8 Expected = (PortId == BENCH_GATED_PORT) ? 0U
+                       : (uint8)MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[PortId] + PORT_DATA_REG_OFFSET);
+        Errors += (Dio_GetPortFromImage(Image, PortId) != Expected) ? 1U : 0U;
+    }
+    return Errors;
+}
+
+int main(void)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    Port_ConfigType Config = Port_Configuration;
+    uint32 Errors = 0U;
+    uint32 Checked = 0U;
+    uint32 Period;
+    uint8 PortId;
+    uint8 Index;
+
+    for (Index = 0U; Index < PORT_CONFIGURED_PINS; Index++)
+    {
+        if (Config.Channels[Index].port_num == BENCH_GATED_PORT)
+        {
+            Config.Channels[Index] = Config.Channels[Config.Channels[Index].pin_num];
+        }
+    }
+
+    Mcal_Sim_Reset();
+    Det_Init();
+    Port_Init(&Config);
+    Errors += ((MCAL_REG_READ32(RCGCGPIO_REGISTER_ADDRESS) >> BENCH_GATED_PORT) & 1U);
+    Dio_Init(&Dio_Configuration);
+
+    for (Period = 0U; Period < BENCH_PERIODS; Period++)
+    {
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+        {
+            Mcal_Sim_SetInputs(PortId, (uint8)Mcal_Sim_Random(&Bench_Random));
+        }
+        Dio_MainFunction();
+        Errors += Bench_CheckImage(Dio_ReadAllPorts());
+#if (DIO_OUTPUT_SHADOW == STD_ON)
+        Errors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+#endif
+    }
+
+    Errors += Bench_Reject("Dio_ReadPort", Bench_ReadPort, DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+    Errors += Bench_Reject("Dio_WritePort", Bench_WritePort, DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+    Errors += Bench_Reject("Dio_MaskedWritePort", Bench_MaskedWritePort, DIO_MASKED_WRITE_PORT_SID,
+                           DIO_E_PARAM_INVALID_PORT_ID);
+#if (DIO_CAPTURE_API == STD_ON)
+    Errors += Bench_Reject("Dio_StartCapture", Bench_StartCapture, DIO_START_CAPTURE_SID, DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+    for (Index = 0U; Index < DIO_CONFIGURED_CHANNELS; Index++)
+    {
+        if (Dio_Configuration.Channels[Index].port != BENCH_GATED_PORT)
+        {
+            continue;
+        }
+        Bench_ChannelId = Index;
+        Errors += Bench_Reject("Dio_ReadChannel", Bench_ReadChannel, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        Errors += Bench_Reject("Dio_WriteChannel", Bench_WriteChannel, DIO_WRITE_CHANNEL_SID,
+                               DIO_E_PARAM_INVALID_CHANNEL_ID);
+        Errors += Bench_Reject("Dio_FlipChannel", Bench_FlipChannel, DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+#if (DIO_NOTIFICATION_API == STD_ON)
+        Errors += Bench_Reject("Dio_EnableNotification", Bench_EnableNotification, DIO_ENABLE_NOTIFICATION_SID,
+                               DIO_E_PARAM_INVALID_CHANNEL_ID);
+        Errors += Bench_Reject("Dio_DisableNotification", Bench_DisableNotification, DIO_DISABLE_NOTIFICATION_SID,
+                               DIO_E_PARAM_INVALID_CHANNEL_ID);
+#endif
+        Checked++;
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_GROUPS; Index++)
+    {
+        if (Dio_Configuration.Groups[Index].port != BENCH_GATED_PORT)
+        {
+            continue;
+        }
+        Bench_Group = &Dio_Configuration.Groups[Index];
+        Errors += Bench_Reject("Dio_ReadChannelGroup", Bench_ReadGroup, DIO_READ_CHANNEL_GROUP_SID,
+                               DIO_E_PARAM_INVALID_PORT_ID);
+        Errors += Bench_Reject("Dio_WriteChannelGroup", Bench_WriteGroup, DIO_WRITE_CHANNEL_GROUP_SID,
+                               DIO_E_PARAM_INVALID_PORT_ID);
+        Checked++;
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+    {
+        if (Dio_Configuration.SyncPortWrites[Index].port == BENCH_GATED_PORT)
+        {
+            Errors += Bench_Reject("Dio_WritePortsSynchronous", Bench_WriteSync, DIO_WRITE_PORTS_SYNCHRONOUS_SID,
+                                   DIO_E_PARAM_INVALID_PORT_ID);
+            Checked++;
+            break;
+        }
+    }
+#if (DIO_VIRTUAL_PORT_API == STD_ON)
+    for (Index = 0U; Index < DIO_CONFIGURED_VIRTUAL_PORTS; Index++)
+    {
+        if (Bench_OnGatedPort(&Dio_Configuration.VirtualPorts[Index]) == FALSE)
+        {
+            continue;
+        }
+        Bench_VirtualPort = &Dio_Configuration.VirtualPorts[Index];
+        Errors += Bench_Reject("Dio_ReadVirtualPort", Bench_ReadVirtualPort, DIO_READ_VIRTUAL_PORT_SID,
+                               DIO_E_PARAM_INVALID_PORT_ID);
+        Errors += Bench_Reject("Dio_WriteVirtualPort", Bench_WriteVirtualPort, DIO_WRITE_VIRTUAL_PORT_SID,
+                               DIO_E_PARAM_INVALID_PORT_ID);
+        Checked++;
+    }
+#endif
+
+    printf("port %c gated off, %u Dio_MainFunction periods, %lu channels/groups/lists/virtual ports on it rejected, "
+           "%lu gated port accesses\n", 'A' + BENCH_GATED_PORT, BENCH_PERIODS, (unsigned long)Checked,
+           (unsigned long)Stats->ungated_accesses);
+    Errors += Stats->ungated_accesses;
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
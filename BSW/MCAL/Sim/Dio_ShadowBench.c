@@ -0,0 +1,183 @@
+/**
+ * @file Dio_ShadowBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark and check of the DIO output shadow against the simulated GPIO registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Random writes through every DIO write service are checked against the levels the simulated pins
+ *          drive, every read service must return them without loading DATA for the shadowed outputs. Then
+ *          a store that bypasses the DIO services and a shadowed pin turned into a driven input must both be
+ *          reported by Dio_CheckOutputShadow. The register accesses and the host time of the read services
+ *          are reported for the shadowed outputs and for an input channel.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_ShadowBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_ShadowBench && ./Dio_ShadowBench
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of random writes and of timed reads */
+#define BENCH_WRITES                   (200000UL)
+#define BENCH_READS                    (1000000UL)
+
+/* Channels read by the timing runs: PF1 (LED1, shadowed output) and PF4 (SW1, input) */
+#define BENCH_OUTPUT_CHANNEL           DioConf_LED1_CHANNEL_ID
+#define BENCH_INPUT_CHANNEL            DioConf_SW1_CHANNEL_ID
+
+STATIC uint32 Bench_Random = 12345U;
+
+/* Shadowed pins of port PortId once Dio_Init kept only the outputs */
+STATIC uint8 Bench_ShadowPins(Dio_PortType PortId)
+{
+    return (uint8)(Dio_Configuration.ShadowPins[PortId]
+                   & MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[PortId] + DIO_DIR_REG_OFFSET));
+}
+
+/* One random write through one of the DIO write services */
+STATIC void Bench_RandomWrite(void)
+{
+    Dio_PortLevelType Levels[DIO_CONFIGURED_SYNC_PORT_WRITES];
+    uint32 Value = Mcal_Sim_Random(&Bench_Random);
+    uint8 Index;
+
+    switch (Mcal_Sim_Random(&Bench_Random) % 7U)
+    {
+        case 0U:
+            Dio_WriteChannel((Dio_ChannelType)(Value % DIO_CONFIGURED_CHANNELS), (Dio_LevelType)((Value >> 8U) & 1U));
+            break;
+        case 1U:
+            (void)Dio_FlipChannel((Dio_ChannelType)(Value % DIO_CONFIGURED_CHANNELS));
+            break;
+        case 2U:
+            Dio_WritePort((Dio_PortType)(Value % DIO_CONFIGURED_PORTS), (Dio_PortLevelType)(Value >> 8U));
+            break;
+        case 3U:
+            Dio_MaskedWritePort((Dio_PortType)(Value % DIO_CONFIGURED_PORTS), (Dio_PortLevelType)(Value >> 8U),
+                                (Dio_PortLevelType)(Value >> 16U));
+            break;
+        case 4U:
+            Dio_WriteChannelGroup(DioConf_DISPLAY_BUS_GROUP_PTR, (Dio_PortLevelType)(Value >> 8U));
+            break;
+        case 5U:
+            Dio_WriteChannelGroup(DioConf_MUX_SELECT_GROUP_PTR, (Dio_PortLevelType)(Value >> 8U));
+            break;
+        default:
+            for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+            {
+                Levels[Index] = (Dio_PortLevelType)(Value >> (Index * 8U));
+            }
+            Dio_WritePortsSynchronous(Levels);
+            break;
+    }
+}
+
+/* Checks every read service of the shadowed pins against the driven levels, returns the number of mismatches */
+STATIC uint32 Bench_CheckReads(void)
+{
+    uint32 Errors = 0U;
+    uint8 ChannelId;
+    uint8 PortId;
+
+    for (ChannelId = 0U; ChannelId < DIO_CONFIGURED_CHANNELS; ChannelId++)
+    {
+        const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[ChannelId];
+        if ((Bench_ShadowPins(Channel->port) & Channel->mask) != 0U)
+        {
+            Errors += (Dio_ReadChannel(ChannelId) != ((Mcal_Sim_GetOutputs(Channel->port) & Channel->mask) != 0U)) ? 1U : 0U;
+        }
+    }
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        uint8 Pins = Bench_ShadowPins(PortId);
+        Errors += (((Dio_ReadPort(PortId) ^ Mcal_Sim_GetOutputs(PortId)) & Pins) != 0U) ? 1U : 0U;
+    }
+    Errors += (Dio_ReadChannelGroup(DioConf_DISPLAY_BUS_GROUP_PTR) != Mcal_Sim_GetOutputs(DioConf_DISPLAY_BUS_GROUP_PORT)) ? 1U : 0U;
+    Errors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+    return Errors;
+}
+
+/* Times BENCH_READS calls of Dio_ReadChannel on ChannelId and prints the register accesses per call */
+STATIC void Bench_TimeReads(const char * Name, Dio_ChannelType ChannelId)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Loads = Stats->loads;
+    uint32 Stores = Stats->stores;
+    volatile Dio_LevelType Sink = STD_LOW;
+    clock_t Start = clock();
+    uint32 Index;
+
+    for (Index = 0U; Index < BENCH_READS; Index++)
+    {
+        Sink ^= Dio_ReadChannel(ChannelId);
+    }
+    printf("%-30s %5.2f register loads/call %5.2f stores/call %7.1f ns/call on the host\n", Name,
+           (double)(Stats->loads - Loads) / BENCH_READS, (double)(Stats->stores - Stores) / BENCH_READS,
+           ((double)(clock() - Start) / CLOCKS_PER_SEC) * 1e9 / BENCH_READS);
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+    uint32 Index;
+    Dio_PortsImageType Mismatch;
+    const Mcal_Sim_StatsType * Stats;
+    uint32 Loads;
+    uint32 Stores;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    /* Board variant with the mux select as outputs, the commutation pins already are */
+    MCAL_REG_WRITE32(DIO_GPIO_PORTE_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0x3FU);
+    Dio_Init(&Dio_Configuration);
+
+    for (Index = 0U; Index < BENCH_WRITES; Index++)
+    {
+        Bench_RandomWrite();
+        if ((Index % 64U) == 0U)
+        {
+            Errors += Bench_CheckReads();
+        }
+    }
+    Errors += Bench_CheckReads();
+    printf("%lu random writes, %lu read mismatches\n", (unsigned long)BENCH_WRITES, (unsigned long)Errors);
+
+    Stats = Mcal_Sim_GetStats();
+    Loads = Stats->loads;
+    Stores = Stats->stores;
+    for (Index = 0U; Index < BENCH_READS; Index++)
+    {
+        (void)Dio_FlipChannel(BENCH_OUTPUT_CHANNEL);
+    }
+    printf("%-30s %5.2f register loads/call %5.2f stores/call\n", "Dio_FlipChannel (shadowed)",
+           (double)(Stats->loads - Loads) / BENCH_READS, (double)(Stats->stores - Stores) / BENCH_READS);
+    Bench_TimeReads("Dio_ReadChannel (shadowed)", BENCH_OUTPUT_CHANNEL);
+    Bench_TimeReads("Dio_ReadChannel (input)", BENCH_INPUT_CHANNEL);
+
+    /* A store that bypasses the DIO services: PD6 and PD7 flipped */
+    MCAL_REG_WRITE32(DIO_DATA_BITS_ADDRESS(DIO_GPIO_PORTD_BASE_ADDRESS, 0xC0U),
+                     ~MCAL_REG_READ32(DIO_GPIO_PORTD_BASE_ADDRESS + DIO_DATA_REG_OFFSET));
+    Mismatch = Dio_CheckOutputShadow();
+    printf("bypassing store on PD6, PD7    mismatch 0x%012llx\n", (unsigned long long)Mismatch);
+    Errors += (Mismatch != ((Dio_PortsImageType)0xC0U << (PORTD * 8U))) ? 1U : 0U;
+    Dio_MaskedWritePort(PORTD, Dio_ReadPort(PORTD), 0xC0U);
+    Errors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+
+    /* PE1 turned into an input and driven to the other level */
+    MCAL_REG_WRITE32(DIO_GPIO_PORTE_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0x3DU);
+    Mcal_Sim_SetInputs(PORTE, (uint8)~Dio_ReadPort(PORTE));
+    Mismatch = Dio_CheckOutputShadow();
+    printf("PE1 turned into a driven input mismatch 0x%012llx\n", (unsigned long long)Mismatch);
+    Errors += (Mismatch != ((Dio_PortsImageType)0x02U << (PORTE * 8U))) ? 1U : 0U;
+
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
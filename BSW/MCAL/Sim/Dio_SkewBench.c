@@ -0,0 +1,175 @@
+/**
+ * @file Dio_SkewBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host measurement of the port-to-port skew of Dio_WritePortsSynchronous against per-port writes
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Random commutation steps are written to the entries of the synchronous port write list (PA6..PA7,
+ *          PD6..PD7, PE4..PE5, outputs in Port_PBcfg.c) with Dio_WritePortsSynchronous, then with one
+ *          Dio_MaskedWritePort and one Dio_WritePort per port. The skew of a step is the difference between the store stamps of the
+ *          first and the last port written, in register accesses (2 DWT cycles each in the simulator). Every
+ *          writer runs without and with preemption: the preemption hook runs an "ISR" making
+ *          BENCH_ISR_ACCESSES register accesses after one access out of BENCH_PREEMPT_RATE. The synchronous
+ *          list must keep the stores back to back (a skew of one access per entry after the first) in both
+ *          runs, and the per-port writers must be caught with a larger skew under preemption. The pins must
+ *          drive the level of the step after every step.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_SkewBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_SkewBench && ./Dio_SkewBench
+ */
+
+#include <stdio.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of commutation steps of every run */
+#define BENCH_STEPS                    (100000UL)
+
+/* An ISR is run after one register access out of BENCH_PREEMPT_RATE on average, it makes BENCH_ISR_ACCESSES */
+#define BENCH_PREEMPT_RATE             (3U)
+#define BENCH_ISR_ACCESSES             (4U)
+
+/* Writers under test */
+#define BENCH_SYNC_WRITER              (0U)
+#define BENCH_MASKED_WRITER            (1U)
+#define BENCH_PORT_WRITER              (2U)
+#define BENCH_WRITERS                  (3U)
+
+STATIC const char * const Bench_WriterNames[BENCH_WRITERS] =
+{
+    "Dio_WritePortsSynchronous",
+    "Dio_MaskedWritePort per port",
+    "Dio_WritePort per port"
+};
+
+STATIC boolean Bench_InIsr = FALSE;
+STATIC uint32 Bench_Random = 12345U;
+
+/* Preemption hook: an ISR reading a port and driving LED1, not nested */
+STATIC void Bench_Preempt(void)
+{
+    uint32 Access;
+
+    if ((Bench_InIsr == TRUE) || ((Mcal_Sim_Random(&Bench_Random) % BENCH_PREEMPT_RATE) != 0U))
+    {
+        return;
+    }
+    Bench_InIsr = TRUE;
+    for (Access = 0U; Access < BENCH_ISR_ACCESSES; Access++)
+    {
+        if ((Access & 1U) == 0U)
+        {
+            (void)Dio_ReadPort(PORTD);
+        }
+        else
+        {
+            Dio_WriteChannel(DioConf_LED1_CHANNEL_ID, (Dio_LevelType)((Access >> 1U) & 1U));
+        }
+    }
+    Bench_InIsr = FALSE;
+}
+
+/* Writes Levels to the entries of the synchronous list with Writer, returns the address each entry was stored to */
+STATIC void Bench_Write(uint8 Writer, const Dio_PortLevelType * Levels, uint32 * Address)
+{
+    uint8 Index;
+
+    if (Writer == BENCH_SYNC_WRITER)
+    {
+        Dio_WritePortsSynchronous(Levels);
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+    {
+        const Dio_PortWriteType * Entry = &Dio_Configuration.SyncPortWrites[Index];
+        if (Writer == BENCH_MASKED_WRITER)
+        {
+            Dio_MaskedWritePort(Entry->port, Levels[Index], Entry->mask);
+        }
+        else if (Writer == BENCH_PORT_WRITER)
+        {
+            /* The other pins of the port keep the level they drive */
+            Dio_WritePort(Entry->port, (Dio_PortLevelType)((Dio_ReadPort(Entry->port) & ~Entry->mask) | Levels[Index]));
+        }
+        else
+        {
+            /* Dio_WritePortsSynchronous */
+        }
+        Address[Index] = (Writer == BENCH_PORT_WRITER)
+                       ? (Dio_Configuration.PortBaseAddress[Entry->port] + DIO_DATA_REG_OFFSET) : Entry->bits_address;
+    }
+}
+
+/* Runs BENCH_STEPS steps with Writer and prints their skew, returns the largest skew (and counts wrong levels) */
+STATIC uint32 Bench_Skew(uint8 Writer, boolean Preempt, uint32 * Errors)
+{
+    Dio_PortLevelType Levels[DIO_CONFIGURED_SYNC_PORT_WRITES];
+    uint32 Address[DIO_CONFIGURED_SYNC_PORT_WRITES];
+    uint32 Max = 0U;
+    uint32 Min = 0xFFFFFFFFUL;
+    double Sum = 0.0;
+    uint32 Step;
+    uint8 Index;
+
+    Mcal_Sim_SetPreemptionHook((Preempt == TRUE) ? Bench_Preempt : NULL_PTR);
+    for (Step = 0U; Step < BENCH_STEPS; Step++)
+    {
+        uint32 First = 0xFFFFFFFFUL;
+        uint32 Last = 0U;
+        uint32 Skew;
+
+        for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+        {
+            Levels[Index] = (Dio_PortLevelType)(Mcal_Sim_Random(&Bench_Random)
+                                                & Dio_Configuration.SyncPortWrites[Index].mask);
+        }
+        Bench_Write(Writer, Levels, Address);
+        for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+        {
+            const Dio_PortWriteType * Entry = &Dio_Configuration.SyncPortWrites[Index];
+            uint32 Stamp = Mcal_Sim_GetStoreStamp(Address[Index]);
+            First = (Stamp < First) ? Stamp : First;
+            Last = (Stamp > Last) ? Stamp : Last;
+            *Errors += ((Mcal_Sim_GetOutputs(Entry->port) & Entry->mask) != Levels[Index]) ? 1U : 0U;
+        }
+        Skew = Last - First;
+        Max = (Skew > Max) ? Skew : Max;
+        Min = (Skew < Min) ? Skew : Min;
+        Sum += (double)Skew;
+    }
+    Mcal_Sim_SetPreemptionHook(NULL_PTR);
+    printf("%-30s %-18s skew %3lu min %6.2f avg %3lu max accesses from the first to the last port\n",
+           Bench_WriterNames[Writer], (Preempt == TRUE) ? "with preemption" : "without preemption",
+           (unsigned long)Min, Sum / BENCH_STEPS, (unsigned long)Max);
+    return Max;
+}
+
+int main(void)
+{
+    uint32 MaxSkew[BENCH_WRITERS][2];
+    uint32 Errors = 0U;
+    uint8 Writer;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+
+    for (Writer = 0U; Writer < BENCH_WRITERS; Writer++)
+    {
+        MaxSkew[Writer][0] = Bench_Skew(Writer, FALSE, &Errors);
+        MaxSkew[Writer][1] = Bench_Skew(Writer, TRUE, &Errors);
+    }
+    printf("%lu wrong levels\n", (unsigned long)Errors);
+
+    /* Back to back stores whatever the ISRs do, and the per-port writers caught spreading under preemption */
+    return ((Errors == 0U)
+            && (MaxSkew[BENCH_SYNC_WRITER][0] == (DIO_CONFIGURED_SYNC_PORT_WRITES - 1U))
+            && (MaxSkew[BENCH_SYNC_WRITER][1] == (DIO_CONFIGURED_SYNC_PORT_WRITES - 1U))
+            && (MaxSkew[BENCH_MASKED_WRITER][1] > MaxSkew[BENCH_SYNC_WRITER][1])
+            && (MaxSkew[BENCH_PORT_WRITER][1] > MaxSkew[BENCH_SYNC_WRITER][1])) ? 0 : 1;
+}
@@ -0,0 +1,307 @@
+/**
+ * @file Dio_StressBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host stress test of the DIO write services under preemption, with their throughput
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details A task and two nested "ISRs" own disjoint pins of the same ports and keep writing them with
+ *          Dio_WriteChannel, Dio_WriteChannelGroup and Dio_MaskedWritePort. The preemption hook of the
+ *          simulator runs an ISR after randomly chosen register accesses, so an ISR lands between any load
+ *          and the next store of the context it preempts (the low ISR can be preempted by the high one).
+ *          After every task write the levels driven by the pins are compared with the last level each
+ *          owner wrote: a difference is a lost update. The output shadow is checked as well.
+ *          The same run is made with a read-modify-write writer of the whole DATA register (the SET_BIT and
+ *          CLR_BIT sequences the DIO used to have), which must lose updates, so the harness shows it detects
+ *          them. A third run has the three contexts flip one shared plain pin with Dio_FlipChannel: the flips
+ *          commute, so the pin must end at the parity of the flips. The simulator models the exclusive monitor
+ *          (an ISR run between LDREX and STREX fails the store), so the run checks the DIO_FLIP_EXCLUSIVE_ACCESS
+ *          retry loop: built with it, no flip may be lost and the loop must have retried; built without it,
+ *          the load and store of the pin aperture lose flips and the run only reports them.
+ *          Then every writer is timed without preemption.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_StressBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_StressBench && ./Dio_StressBench
+ *          Add -DDIO_FLIP_EXCLUSIVE_ACCESS=STD_ON for the exclusive access flip.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of task writes of the stress runs and of calls of the timing runs */
+#define BENCH_TASK_WRITES              (300000UL)
+#define BENCH_TIMED_CALLS              (1000000UL)
+
+/* An ISR is run after one register access out of BENCH_PREEMPT_RATE on average */
+#define BENCH_PREEMPT_RATE             (3U)
+
+/* Contexts: the task and the two ISR priority levels */
+#define BENCH_TASK                     (0U)
+#define BENCH_LOW_ISR                  (1U)
+#define BENCH_HIGH_ISR                 (2U)
+#define BENCH_CONTEXTS                 (3U)
+
+/* Writers under test */
+#define BENCH_DIO_WRITER               (0U)
+#define BENCH_RMW_WRITER               (1U)
+#define BENCH_FLIP_WRITER              (2U)
+
+/* Plain pin flipped by every context in the flip run (PC4, made an output by the board variant) */
+#define BENCH_FLIP_CHANNEL             DioConf_TFT_CS_CHANNEL_ID
+#define BENCH_FLIP_PORT                PORTC
+#define BENCH_FLIP_PIN                 (0x10U)
+
+/* Writes of a context: the pins of a port it owns, and the DIO service writing them */
+typedef enum
+{
+    BENCH_WRITE_CHANNEL,
+    BENCH_WRITE_GROUP,
+    BENCH_MASKED_WRITE_PORT
+}Bench_ServiceType;
+
+typedef struct
+{
+    Bench_ServiceType service;
+    Dio_PortType port;
+    Dio_PortLevelType pins;
+    Dio_ChannelType channel;                  // Channel of BENCH_WRITE_CHANNEL.
+    uint8 group;                              // Group index of BENCH_WRITE_GROUP.
+}Bench_WriteType;
+
+#define BENCH_WRITES_PER_CONTEXT       (3U)
+
+/*
+ * PORTA and PORTE mix shadowed (PA6, PA7, PE0, PE1, PE4, PE5) and plain pins, PORTB is plain
+ * (DioConf_<PORT>_SHADOW_PINS).
+ * Every pin has one owner.
+ */
+STATIC const Bench_WriteType Bench_Writes[BENCH_CONTEXTS][BENCH_WRITES_PER_CONTEXT] =
+{
+    {   /* Task */
+        { BENCH_WRITE_GROUP,       PORTE, 0x03U, 0U,  DioConf_MUX_SELECT_GROUP_INDEX },
+        { BENCH_MASKED_WRITE_PORT, PORTA, 0x07U, 0U,  0U },
+        { BENCH_WRITE_CHANNEL,     PORTA, 0x08U, 3U,  0U }
+    },
+    {   /* Low ISR */
+        { BENCH_WRITE_CHANNEL,     PORTE, 0x10U, 36U, 0U },
+        { BENCH_WRITE_CHANNEL,     PORTA, 0x40U, 6U,  0U },
+        { BENCH_WRITE_GROUP,       PORTB, 0xFFU, 0U,  DioConf_DISPLAY_BUS_GROUP_INDEX }
+    },
+    {   /* High ISR */
+        { BENCH_MASKED_WRITE_PORT, PORTE, 0x20U, 0U,  0U },
+        { BENCH_MASKED_WRITE_PORT, PORTA, 0x90U, 0U,  0U },
+        { BENCH_WRITE_CHANNEL,     PORTA, 0x20U, 5U,  0U }
+    }
+};
+
+STATIC uint8 Bench_Expected[MCAL_SIM_GPIO_PORTS];  /* Last level written by the owner of every pin */
+STATIC uint8 Bench_Owned[MCAL_SIM_GPIO_PORTS];     /* Pins with an owner */
+STATIC uint8 Bench_Writer = BENCH_DIO_WRITER;
+STATIC uint8 Bench_Level = BENCH_TASK;             /* Context running */
+STATIC uint32 Bench_IsrRuns = 0U;
+STATIC uint32 Bench_Random = 12345U;
+
+/* Read-modify-write of the whole DATA register, one load and one store */
+STATIC void Bench_RmwWrite(Dio_PortType PortId, uint8 Pins, uint8 Level)
+{
+    uint32 Address = Dio_Configuration.PortBaseAddress[PortId] + DIO_DATA_REG_OFFSET;
+    uint32 Value = MCAL_REG_READ32(Address);
+    MCAL_REG_WRITE32(Address, (Value & ~(uint32)Pins) | (Level & Pins));
+}
+
+/* Writes Level (in port position) to the pins of Write with the writer under test */
+STATIC void Bench_Write(const Bench_WriteType * Write, uint8 Level)
+{
+    if (Bench_Writer == BENCH_RMW_WRITER)
+    {
+        Bench_RmwWrite(Write->port, Write->pins, Level);
+        return;
+    }
+    if (Bench_Writer == BENCH_FLIP_WRITER)
+    {
+        (void)Dio_FlipChannel(BENCH_FLIP_CHANNEL);
+        return;
+    }
+    switch (Write->service)
+    {
+        case BENCH_WRITE_CHANNEL:
+            Dio_WriteChannel(Write->channel, ((Level & Write->pins) != 0U) ? STD_HIGH : STD_LOW);
+            break;
+        case BENCH_WRITE_GROUP:
+        {
+            const Dio_ChannelGroupType * Group = &Dio_GetConfig()->Groups[Write->group];
+            Dio_WriteChannelGroup(Group, (Dio_PortLevelType)((Level & Write->pins) >> Group->offset));
+            break;
+        }
+        default:
+            Dio_MaskedWritePort(Write->port, Level, Write->pins);
+            break;
+    }
+}
+
+/* One random write of context Context, its expected levels follow once the write returned */
+STATIC void Bench_ContextWrite(uint8 Context)
+{
+    const Bench_WriteType * Write = &Bench_Writes[Context][Mcal_Sim_Random(&Bench_Random) % BENCH_WRITES_PER_CONTEXT];
+    uint8 Level = (uint8)Mcal_Sim_Random(&Bench_Random);
+
+    if (Bench_Writer == BENCH_FLIP_WRITER)
+    {
+        /* Every context flips the same pin, whatever the order the pin ends at the parity of the flips */
+        Bench_Write(Write, Level);
+        Bench_Expected[BENCH_FLIP_PORT] ^= BENCH_FLIP_PIN;
+        return;
+    }
+    Bench_Write(Write, Level);
+    Bench_Expected[Write->port] = (uint8)((Bench_Expected[Write->port] & ~Write->pins) | (Level & Write->pins));
+}
+
+/* Preemption hook: runs an ISR of a higher level than the running context */
+STATIC void Bench_Preempt(void)
+{
+    uint8 Saved = Bench_Level;
+
+    if ((Saved == BENCH_HIGH_ISR) || ((Mcal_Sim_Random(&Bench_Random) % BENCH_PREEMPT_RATE) != 0U))
+    {
+        return;
+    }
+    Bench_Level = (Saved == BENCH_TASK) ? (uint8)(BENCH_LOW_ISR + (Mcal_Sim_Random(&Bench_Random) & 1U)) : BENCH_HIGH_ISR;
+    Bench_IsrRuns++;
+    Bench_ContextWrite(Bench_Level);
+    Bench_Level = Saved;
+}
+
+/* Counts the owned pins that do not drive their owner's last level, and accepts their level */
+STATIC uint32 Bench_LostUpdates(void)
+{
+    uint32 Lost = 0U;
+    uint8 PortId;
+
+    for (PortId = 0U; PortId < MCAL_SIM_GPIO_PORTS; PortId++)
+    {
+        uint8 Outputs = Mcal_Sim_GetOutputs(PortId);
+        uint8 Wrong = (uint8)((Outputs ^ Bench_Expected[PortId]) & Bench_Owned[PortId]);
+        while (Wrong != 0U)
+        {
+            Lost++;
+            Wrong &= (uint8)(Wrong - 1U);
+        }
+        Bench_Expected[PortId] = (uint8)((Bench_Expected[PortId] & ~Bench_Owned[PortId]) | (Outputs & Bench_Owned[PortId]));
+    }
+    return Lost;
+}
+
+/* Runs the stress test with Writer and prints its line, returns the lost updates */
+STATIC uint32 Bench_Stress(const char * Name, uint8 Writer)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Points = Stats->preemption_points;
+    uint32 Deferred = Stats->deferred_preemptions;
+    uint32 Failures = Stats->exclusive_failures;
+    uint32 Lost = 0U;
+    uint32 Drifts = 0U;
+    uint32 Index;
+
+    Bench_Writer = Writer;
+    Bench_IsrRuns = 0U;
+    (void)Bench_LostUpdates();
+    Mcal_Sim_SetPreemptionHook(Bench_Preempt);
+    for (Index = 0U; Index < BENCH_TASK_WRITES; Index++)
+    {
+        Bench_ContextWrite(BENCH_TASK);
+        Lost += Bench_LostUpdates();
+        if ((Writer != BENCH_RMW_WRITER) && (Dio_CheckOutputShadow() != 0U))
+        {
+            Drifts++;
+        }
+    }
+    Mcal_Sim_SetPreemptionHook(NULL_PTR);
+    printf("%-24s %8lu ISR runs %9lu preemption points (%lu deferred) %7lu lost updates %lu shadow drifts"
+           " %lu exclusive retries\n", Name, (unsigned long)Bench_IsrRuns,
+           (unsigned long)(Stats->preemption_points - Points), (unsigned long)(Stats->deferred_preemptions - Deferred),
+           (unsigned long)Lost, (unsigned long)Drifts, (unsigned long)(Stats->exclusive_failures - Failures));
+    return Lost + Drifts;
+}
+
+/* Times one write of the task, of the low ISR or of the high ISR with Writer, without preemption */
+STATIC void Bench_Time(const char * Name, uint8 Writer, uint8 Context, uint8 WriteIndex)
+{
+    const Bench_WriteType * Write = &Bench_Writes[Context][WriteIndex];
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Loads = Stats->loads;
+    uint32 Stores = Stats->stores;
+    uint32 Masks = Stats->interrupt_masks;
+    clock_t Start = clock();
+    uint32 Index;
+
+    Bench_Writer = Writer;
+    for (Index = 0U; Index < BENCH_TIMED_CALLS; Index++)
+    {
+        Bench_Write(Write, (uint8)Index);
+    }
+    printf("%-44s %5.2f loads %5.2f stores %5.2f critical sections/call %6.1f ns/call on the host\n", Name,
+           (double)(Stats->loads - Loads) / BENCH_TIMED_CALLS, (double)(Stats->stores - Stores) / BENCH_TIMED_CALLS,
+           (double)(Stats->interrupt_masks - Masks) / BENCH_TIMED_CALLS,
+           ((double)(clock() - Start) / CLOCKS_PER_SEC) * 1e9 / BENCH_TIMED_CALLS);
+}
+
+int main(void)
+{
+    uint32 DioLost;
+    uint32 RmwLost;
+    uint32 FlipLost;
+    uint32 FlipRetries;
+    uint8 Context;
+    uint8 Index;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    /* Board variant with all the written pins as outputs */
+    MCAL_REG_WRITE32(DIO_GPIO_PORTA_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0xFFU);
+    MCAL_REG_WRITE32(DIO_GPIO_PORTE_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0x3FU);
+    MCAL_REG_WRITE32(DIO_GPIO_PORTC_BASE_ADDRESS + DIO_DIR_REG_OFFSET,
+                     MCAL_REG_READ32(DIO_GPIO_PORTC_BASE_ADDRESS + DIO_DIR_REG_OFFSET) | BENCH_FLIP_PIN);
+    Dio_Init(&Dio_Configuration);
+
+    for (Context = 0U; Context < BENCH_CONTEXTS; Context++)
+    {
+        for (Index = 0U; Index < BENCH_WRITES_PER_CONTEXT; Index++)
+        {
+            Bench_Owned[Bench_Writes[Context][Index].port] |= Bench_Writes[Context][Index].pins;
+        }
+    }
+    Bench_Owned[BENCH_FLIP_PORT] |= BENCH_FLIP_PIN;
+
+    DioLost = Bench_Stress("DIO write services", BENCH_DIO_WRITER);
+    FlipRetries = Mcal_Sim_GetStats()->exclusive_failures;
+    FlipLost = Bench_Stress("Dio_FlipChannel (shared)", BENCH_FLIP_WRITER);
+    FlipRetries = Mcal_Sim_GetStats()->exclusive_failures - FlipRetries;
+    /* Last, its writes bypass the output shadow */
+    RmwLost = Bench_Stress("read-modify-write", BENCH_RMW_WRITER);
+
+    Bench_Time("Dio_WriteChannel PA3 (plain)", BENCH_DIO_WRITER, BENCH_TASK, 2U);
+    Bench_Time("Dio_WriteChannel PA6 (shadowed)", BENCH_DIO_WRITER, BENCH_LOW_ISR, 1U);
+    Bench_Time("Dio_WriteChannelGroup PB0..PB7 (plain)", BENCH_DIO_WRITER, BENCH_LOW_ISR, 2U);
+    Bench_Time("Dio_MaskedWritePort PA0..PA2 (plain)", BENCH_DIO_WRITER, BENCH_TASK, 1U);
+    Bench_Time("Dio_MaskedWritePort PA4, PA7 (mixed)", BENCH_DIO_WRITER, BENCH_HIGH_ISR, 1U);
+    Bench_Time("Dio_FlipChannel PC4 (plain)", BENCH_FLIP_WRITER, BENCH_TASK, 0U);
+    Bench_Time("read-modify-write PA3", BENCH_RMW_WRITER, BENCH_TASK, 2U);
+    Bench_Time("read-modify-write PB0..PB7", BENCH_RMW_WRITER, BENCH_LOW_ISR, 2U);
+
+    /* The DIO services must not lose any update, the read-modify-write writer must be caught losing some */
+#if (DIO_FLIP_EXCLUSIVE_ACCESS == STD_ON)
+    /* The exclusive flip must not lose any flip, and the ISRs must have made its loop retry */
+    return ((DioLost == 0U) && (RmwLost != 0U) && (FlipLost == 0U) && (FlipRetries != 0U)) ? 0 : 1;
+#else
+    (void)FlipLost;
+    (void)FlipRetries;
+    return ((DioLost == 0U) && (RmwLost != 0U)) ? 0 : 1;
+#endif
+}
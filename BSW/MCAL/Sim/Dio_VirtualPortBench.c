@@ -0,0 +1,187 @@
+/**
+ * @file Dio_VirtualPortBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark and check of the DIO virtual ports against the simulated GPIO registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Both buses run on the shipped Port configuration, which makes the ADC bus pins inputs and the LCD
+ *          bus pins outputs. The 4-bit ADC bus is read from random input levels with Dio_ReadVirtualPort and with
+ *          one Dio_ReadChannel per bit, both must give the word the pins carry. The 4-bit LCD bus is then written
+ *          with random words through Dio_WriteVirtualPort and with one Dio_WriteChannel per bit: the pins must
+ *          drive the word, the other pins of the ports must not move, the word must read back and the output
+ *          shadow must still match. The register accesses and the host time of both ways are reported.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Dio_VirtualPortBench.c Sim/Mcal_Sim.c DIO/DIO.c DIO/Dio_PBcfg.c
+ *              Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Dio_VirtualPortBench && ./Dio_VirtualPortBench
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of random words read and written */
+#define BENCH_WORDS                    (200000UL)
+
+/* Width of the two virtual ports */
+#define BENCH_ADC_BITS                 (4U)
+#define BENCH_LCD_BITS                 (4U)
+
+/* Ports of the LCD bus and its pins on each of them */
+#define BENCH_LCD_PORTS                (3U)
+STATIC const Dio_PortType Bench_LcdPorts[BENCH_LCD_PORTS] = { PORTA, PORTD, PORTF };
+STATIC const uint8 Bench_LcdPins[BENCH_LCD_PORTS] = { 0x20U, 0x02U, 0x0CU };
+
+/* DIO channels (port * 8 + pin) of the bits of the buses */
+STATIC const Dio_ChannelType Bench_AdcChannels[BENCH_ADC_BITS] =
+{
+    0U, 1U, 28U, 29U
+};
+STATIC const Dio_ChannelType Bench_LcdChannels[BENCH_LCD_BITS] =
+{
+    5U, 25U, 42U, 43U
+};
+
+STATIC uint32 Bench_Random = 12345U;
+
+/* Word carried by the pins of the ports, for the Bits channels of Channels */
+STATIC uint32 Bench_PinWord(const Dio_ChannelType * Channels, uint8 Bits, boolean Outputs)
+{
+    uint32 Word = 0U;
+    uint8 Index;
+    for (Index = 0U; Index < Bits; Index++)
+    {
+        const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[Channels[Index]];
+        uint8 Levels = (Outputs == TRUE) ? Mcal_Sim_GetOutputs(Channel->port)
+                                         : (uint8)MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[Channel->port]
+                                                                  + DIO_DATA_REG_OFFSET);
+        Word |= (((Levels & Channel->mask) != 0U) ? 1UL : 0UL) << Index;
+    }
+    return Word;
+}
+
+/* Prints the accesses and the host time of one way of reading or writing a word */
+STATIC void Bench_Report(const char * Name, uint32 Accesses, clock_t Clocks)
+{
+    printf("%-34s %5.2f accesses/word %7.1f ns/word\n", Name, (double)Accesses / BENCH_WORDS,
+           1.0e9 * (double)Clocks / CLOCKS_PER_SEC / BENCH_WORDS);
+}
+
+/* Reads the ADC bus from random inputs, returns the number of wrong words */
+STATIC uint32 Bench_Read(void)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Errors = 0U;
+    uint32 Accesses;
+    uint32 Word;
+    uint32 Count;
+    clock_t Start;
+    uint8 Index;
+
+    for (Count = 0U; Count < BENCH_WORDS; Count++)
+    {
+        Mcal_Sim_SetInputs(PORTA, (uint8)Mcal_Sim_Random(&Bench_Random));
+        Mcal_Sim_SetInputs(PORTD, (uint8)Mcal_Sim_Random(&Bench_Random));
+        Errors += (Dio_ReadVirtualPort(DioConf_ADC_BUS_VPORT_PTR) != Bench_PinWord(Bench_AdcChannels, BENCH_ADC_BITS, FALSE)) ? 1U : 0U;
+    }
+
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    for (Count = 0U; Count < BENCH_WORDS; Count++)
+    {
+        Word = Dio_ReadVirtualPort(DioConf_ADC_BUS_VPORT_PTR);
+        Bench_Random ^= Word;
+    }
+    Bench_Report("Dio_ReadVirtualPort (6 bits)", Stats->loads + Stats->stores - Accesses, clock() - Start);
+
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    for (Count = 0U; Count < BENCH_WORDS; Count++)
+    {
+        Word = 0U;
+        for (Index = 0U; Index < BENCH_ADC_BITS; Index++)
+        {
+            Word |= (uint32)Dio_ReadChannel(Bench_AdcChannels[Index]) << Index;
+        }
+        Bench_Random ^= Word;
+    }
+    Bench_Report("6 x Dio_ReadChannel", Stats->loads + Stats->stores - Accesses, clock() - Start);
+    return Errors;
+}
+
+/* Writes random words to the LCD bus, returns the number of wrong words */
+STATIC uint32 Bench_Write(void)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Errors = 0U;
+    uint32 Accesses;
+    uint32 Word;
+    uint32 Count;
+    clock_t Start;
+    uint8 Index;
+
+    /* The pins of the ports outside the bus must keep their levels */
+    for (Index = 0U; Index < BENCH_LCD_PORTS; Index++)
+    {
+        Dio_MaskedWritePort(Bench_LcdPorts[Index], 0xFFU, (Dio_PortLevelType)~Bench_LcdPins[Index]);
+    }
+    for (Count = 0U; Count < BENCH_WORDS; Count++)
+    {
+        uint8 Others[BENCH_LCD_PORTS];
+
+        for (Index = 0U; Index < BENCH_LCD_PORTS; Index++)
+        {
+            Others[Index] = Mcal_Sim_GetOutputs(Bench_LcdPorts[Index]) & (uint8)~Bench_LcdPins[Index];
+        }
+        Word = Mcal_Sim_Random(&Bench_Random) & ((1UL << BENCH_LCD_BITS) - 1U);
+        Dio_WriteVirtualPort(DioConf_LCD_BUS_VPORT_PTR, Word);
+        Errors += (Bench_PinWord(Bench_LcdChannels, BENCH_LCD_BITS, TRUE) != Word) ? 1U : 0U;
+        Errors += (Dio_ReadVirtualPort(DioConf_LCD_BUS_VPORT_PTR) != Word) ? 1U : 0U;
+        for (Index = 0U; Index < BENCH_LCD_PORTS; Index++)
+        {
+            Errors += ((Mcal_Sim_GetOutputs(Bench_LcdPorts[Index]) & (uint8)~Bench_LcdPins[Index]) != Others[Index]) ? 1U : 0U;
+        }
+    }
+
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    for (Count = 0U; Count < BENCH_WORDS; Count++)
+    {
+        Dio_WriteVirtualPort(DioConf_LCD_BUS_VPORT_PTR, Count);
+    }
+    Bench_Report("Dio_WriteVirtualPort (4 bits)", Stats->loads + Stats->stores - Accesses, clock() - Start);
+
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    for (Count = 0U; Count < BENCH_WORDS; Count++)
+    {
+        for (Index = 0U; Index < BENCH_LCD_BITS; Index++)
+        {
+            Dio_WriteChannel(Bench_LcdChannels[Index], (Dio_LevelType)((Count >> Index) & 1U));
+        }
+    }
+    Bench_Report("4 x Dio_WriteChannel", Stats->loads + Stats->stores - Accesses, clock() - Start);
+    Errors += (Bench_PinWord(Bench_LcdChannels, BENCH_LCD_BITS, TRUE) != ((BENCH_WORDS - 1UL) & ((1UL << BENCH_LCD_BITS) - 1U))) ? 1U : 0U;
+    return Errors;
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Errors += Bench_Read();
+    Errors += Bench_Write();
+
+    Errors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
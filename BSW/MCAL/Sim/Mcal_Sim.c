@@ -0,0 +1,1450 @@
+/**
+ * @file Mcal_Sim.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host simulation of the TM4C123GH6PM peripheral memory used by the MCAL drivers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "Mcal_Sim.h"
+#include "../DIO/Dio_Cfg.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <signal.h>
+/* Host instructions counted by single-stepping them with the trap flag of RFLAGS */
+#define SIM_INSTRUCTION_COUNT          STD_ON
+#define SIM_RFLAGS_TF                  0x100U
+#else
+#define SIM_INSTRUCTION_COUNT          STD_OFF
+#endif
+
+/* Simulated GPIO apertures */
+#define SIM_GPIO_APB_PORTA_BASE        0x40004000U   /* Ports A..D, 4KB apart */
+#define SIM_GPIO_APB_PORTE_BASE        0x40024000U   /* Ports E..F, 4KB apart */
+#define SIM_GPIO_AHB_PORTA_BASE        0x40058000U   /* Ports A..F, 4KB apart */
+#define SIM_GPIO_BLOCK_SIZE            0x1000U
+
+/* GPIO register offsets with a simulated behaviour */
+#define SIM_GPIO_DATA_END              0x3FCU
+#define SIM_GPIO_DIR                   0x400U
+#define SIM_GPIO_IS                    0x404U
+#define SIM_GPIO_IBE                   0x408U
+#define SIM_GPIO_IEV                   0x40CU
+#define SIM_GPIO_IM                    0x410U
+#define SIM_GPIO_RIS                   0x414U
+#define SIM_GPIO_MIS                   0x418U
+#define SIM_GPIO_ICR                   0x41CU
+#define SIM_GPIO_AFSEL                 0x420U
+#define SIM_GPIO_PUR                   0x510U
+#define SIM_GPIO_PDR                   0x514U
+#define SIM_GPIO_DEN                   0x51CU
+#define SIM_GPIO_LOCK                  0x520U
+#define SIM_GPIO_CR                    0x524U
+#define SIM_GPIO_PCTL                  0x52CU
+#define SIM_GPIO_DMACTL                0x534U
+
+/* GPIOPCTL function of the timer CCP pins */
+#define SIM_GPIO_PCTL_CCP              0x7U
+
+/* Key unlocking GPIOCR */
+#define SIM_GPIO_LOCK_KEY              0x4C4F434BU
+
+/* Simulated SYSCTL registers */
+#define SIM_SYSCTL_GPIOHBCTL           0x400FE06CU
+#define SIM_SYSCTL_RCGC2               0x400FE108U
+#define SIM_SYSCTL_RCGCGPIO            0x400FE608U
+#define SIM_SYSCTL_PRGPIO              0x400FEA08U
+#define SIM_SYSCTL_GPIO_MASK           0x3FU
+
+/* Simulated timers, SYSCTL gating of the timers and the uDMA */
+#define SIM_SYSCTL_RCGCTIMER           0x400FE604U
+#define SIM_SYSCTL_RCGCDMA             0x400FE60CU
+#define SIM_SYSCTL_PRTIMER             0x400FEA04U
+#define SIM_SYSCTL_PRDMA               0x400FEA0CU
+#define SIM_SYSCTL_RCGCWTIMER          0x400FE65CU
+#define SIM_SYSCTL_PRWTIMER            0x400FEA5CU
+#define SIM_TIMER_BASE                 0x40030000U   /* Timers 0..5 then wide timers 0..1, 4KB apart */
+#define SIM_TIMERS                     (8U)
+#define SIM_NARROW_TIMERS              (6U)          /* 16/32-bit timers, the others have 32-bit halves */
+#define SIM_TIMER_CFG                  0x000U
+#define SIM_TIMER_TAMR                 0x004U
+#define SIM_TIMER_TBMR                 0x008U
+#define SIM_TIMER_CTL                  0x00CU
+#define SIM_TIMER_SYNC                 0x010U
+#define SIM_TIMER_IMR                  0x018U
+#define SIM_TIMER_RIS                  0x01CU
+#define SIM_TIMER_MIS                  0x020U
+#define SIM_TIMER_ICR                  0x024U
+#define SIM_TIMER_TAILR                0x028U
+#define SIM_TIMER_TBILR                0x02CU
+#define SIM_TIMER_TAMATCHR             0x030U
+#define SIM_TIMER_TBMATCHR             0x034U
+#define SIM_TIMER_TAR                  0x048U
+#define SIM_TIMER_TBR                  0x04CU
+#define SIM_TIMER_TAV                  0x050U
+#define SIM_TIMER_TBV                  0x054U
+#define SIM_TIMER_CFG_16_BIT           0x4U
+#define SIM_TIMER_CTL_EN(HALF)         ((HALF == 0U) ? 0x001U : 0x100U)
+#define SIM_TIMER_CTL_PWML(HALF)       ((HALF == 0U) ? 0x040U : 0x4000U)  /* TnPWML: inverted PWM output */
+#define SIM_TIMER_MR_AMS               0x008U        /* TnAMS: PWM mode of the half */
+#define SIM_TIMER_MR_MIE               0x020U        /* TnMIE: match interrupt of the half */
+#define SIM_TIMER_INT_TO(HALF)         ((HALF == 0U) ? 0x001U : 0x100U)   /* TnTORIS/TnTOIM */
+#define SIM_TIMER_INT_M(HALF)          ((HALF == 0U) ? 0x010U : 0x800U)   /* TnMRIS/TnMIM */
+
+/* Simulated uDMA registers */
+#define SIM_UDMA_CTLBASE               0x400FF008U
+#define SIM_UDMA_REQMASKSET            0x400FF020U
+#define SIM_UDMA_REQMASKCLR            0x400FF024U
+#define SIM_UDMA_ENASET                0x400FF028U
+#define SIM_UDMA_ENACLR                0x400FF02CU
+#define SIM_UDMA_ALTSET                0x400FF030U
+#define SIM_UDMA_ALTCLR                0x400FF034U
+#define SIM_UDMA_CHIS                  0x400FF504U
+#define SIM_UDMA_CHMAP0                0x400FF510U
+#define SIM_UDMA_CHMAP2                0x400FF518U
+#define SIM_UDMA_CHANNELS              (32U)
+
+/* First uDMA channel of the timers modelled as uDMA requesters (timer 0..2 A/B, encoding 0) */
+#define SIM_TIMER_REQUEST_TIMERS       (3U)
+#define SIM_TIMER_UDMA_CHANNEL         (18U)
+
+/* NVIC interrupt set/clear enable registers (IRQ 0..95) */
+#define SIM_NVIC_EN0                   0xE000E100U
+#define SIM_NVIC_DIS0                  0xE000E180U
+#define SIM_NVIC_REGISTERS             (5U)
+
+/* DWT cycle counter, it counts the clocks advanced plus SIM_DWT_ACCESS_CLOCKS per register access */
+#define SIM_DEMCR                      0xE000EDFCU
+#define SIM_DEMCR_TRCENA               0x01000000U
+#define SIM_DWT_CTRL                   0xE0001000U
+#define SIM_DWT_CTRL_CYCCNTENA         0x1U
+#define SIM_DWT_CYCCNT                 0xE0001004U
+#define SIM_DWT_ACCESS_CLOCKS          (2U)
+
+/* Simulated RAM mapped to host memory */
+#define SIM_RAM_BASE                   0x20000000U
+#define SIM_RAM_ALIGN                  (1024U)
+#define SIM_RAM_REGIONS                (32U)
+#define SIM_IRQS                       (139U)
+
+/* Peripheral bit-band region and its alias */
+#define SIM_BITBAND_BASE               0x40000000U
+#define SIM_BITBAND_ALIAS_BASE         0x42000000U
+#define SIM_BITBAND_ALIAS_END          0x44000000U
+
+/* Default number of PRGPIO reads before an enabled port is ready */
+#define SIM_PRGPIO_DEFAULT_DELAY       (2U)
+
+/* Size of the register table (power of 2) */
+#define SIM_CELLS                      (4096U)
+
+/* One simulated register: its value and its access counters */
+typedef struct
+{
+    uint32 address;
+    uint32 value;
+    uint32 loads;
+    uint32 stores;
+    uint32 store_stamp;
+    boolean used;
+}Sim_CellType;
+
+/* State of one GPIO port that is not a plain register */
+typedef struct
+{
+    uint32 latch;       /* Output latch written through DATA */
+    uint32 inputs;      /* Levels driven on the pins by the host */
+    uint32 edges;       /* Edge events latched in GPIORIS */
+    uint32 commit;      /* GPIOCR */
+    boolean unlocked;   /* GPIOLOCK state */
+    uint32 ready_countdown; /* PRGPIO reads left before the port is ready */
+}Sim_GpioPortType;
+
+/* Host memory reachable through a simulated RAM address */
+typedef struct
+{
+    uint8 * host;
+    uint32 address;
+    uint32 size;
+}Sim_RamRegionType;
+
+/* State of the uDMA controller */
+typedef struct
+{
+    uint32 enabled;     /* DMAENASET */
+    uint32 alternate;   /* DMAALTSET */
+    uint32 reqmask;     /* DMAREQMASKSET */
+    uint32 chis;        /* DMACHIS */
+}Sim_UdmaType;
+
+STATIC Sim_CellType Sim_Cells[SIM_CELLS];
+STATIC Sim_GpioPortType Sim_Ports[MCAL_SIM_GPIO_PORTS];
+STATIC Mcal_Sim_StatsType Sim_Stats;
+STATIC uint32 Sim_PrgpioDelay = SIM_PRGPIO_DEFAULT_DELAY;
+STATIC uint32 Sim_ClockGates = 0U;
+STATIC uint32 Sim_InterruptsMasked = 0U;
+STATIC Sim_RamRegionType Sim_RamRegions[SIM_RAM_REGIONS];
+STATIC uint32 Sim_RamRegionCount = 0U;
+STATIC uint32 Sim_RamNext = SIM_RAM_BASE;
+STATIC Sim_UdmaType Sim_Udma;
+STATIC uint32 Sim_TimerCount[SIM_TIMERS][2];   /* Clocks left before the next timeout of timer A/B */
+STATIC uint32 Sim_TimerRis[SIM_TIMERS];        /* GPTMRIS of the timeout and match events */
+STATIC boolean Sim_TimerPwm[SIM_TIMERS][2];    /* PWM output of timer A/B asserted (from the reload to the match) */
+STATIC uint32 Sim_NvicEnabled[SIM_NVIC_REGISTERS];
+STATIC Mcal_Sim_IsrType Sim_Isrs[SIM_IRQS];
+STATIC Mcal_Sim_IsrType Sim_PreemptionHook = NULL_PTR;
+STATIC boolean Sim_PreemptionPending = FALSE;   /* A hook call came while the interrupts were masked */
+STATIC boolean Sim_ExclusiveArmed = FALSE;      /* Local exclusive monitor armed by Mcal_Sim_ReadExclusive32 */
+STATIC uint32 Sim_ExclusiveAddress = 0U;        /* Address tagged by the monitor */
+STATIC volatile uint32 * Sim_ExclusiveWord = NULL_PTR;  /* Host RAM word tagged by the monitor, instead of an address */
+STATIC Mcal_Sim_PinHookType Sim_PinHook = NULL_PTR;
+STATIC uint32 Sim_DwtOrigin = 0U;               /* Simulated cycles at which DWT_CYCCNT was 0 */
+STATIC volatile uint32 Sim_Instructions = 0U;   /* Host instructions single-stepped outside the model */
+STATIC volatile uint32 Sim_InModel = 0U;        /* Nesting of the model functions, their instructions are not counted */
+
+/* Interrupts of timer A/B of the timers 0..5 and of the wide timers 0..1 */
+STATIC const uint8 Sim_TimerIrqs[SIM_TIMERS][2] =
+{
+    { 19U, 20U }, { 21U, 22U }, { 23U, 24U }, { 35U, 36U }, { 70U, 71U }, { 92U, 93U }, { 94U, 95U }, { 96U, 97U }
+};
+
+/* Timer CCP on each pin with GPIOPCTL function 7: (timer * 2) + half + 1, 0 for none or a wide timer 2..5 */
+STATIC const uint8 Sim_CcpPins[MCAL_SIM_GPIO_PORTS][8] =
+{
+    { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U },          /* PA: none */
+    { 5U, 6U, 7U, 8U, 3U, 4U, 1U, 2U },          /* PB: T2CCP0/1, T3CCP0/1, T1CCP0/1, T0CCP0/1 */
+    { 9U, 10U, 11U, 12U, 13U, 14U, 15U, 16U },   /* PC: T4CCP0/1, T5CCP0/1, WT0CCP0/1, WT1CCP0/1 */
+    { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U },          /* PD: wide timers 2..5, not modelled */
+    { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U },          /* PE: none */
+    { 1U, 2U, 3U, 4U, 5U, 0U, 0U, 0U }           /* PF: T0CCP0/1, T1CCP0/1, T2CCP0 */
+};
+
+/* uDMA channel (encoding 3) and interrupt of the GPIO DMA trigger of each port */
+STATIC const uint8 Sim_GpioDmaChannels[MCAL_SIM_GPIO_PORTS] = { 4U, 5U, 6U, 7U, 14U, 15U };
+STATIC const uint8 Sim_GpioIrqs[MCAL_SIM_GPIO_PORTS] = { 0U, 1U, 2U, 3U, 4U, 30U };
+
+/* Pins protected by GPIOCR out of reset: PC0..PC3 (JTAG), PD7 and PF0 */
+STATIC const uint8 Sim_LockedPins[MCAL_SIM_GPIO_PORTS] = { 0x00U, 0x00U, 0x0FU, 0x80U, 0x00U, 0x01U };
+
+/* Returns the cell of Address, allocating it on first use */
+STATIC Sim_CellType * Sim_Cell(uint32 Address)
+{
+    uint32 Index = ((Address >> 2U) * 2654435761U) & (SIM_CELLS - 1U);
+    uint32 Probe;
+    for (Probe = 0U; Probe < SIM_CELLS; Probe++)
+    {
+        Sim_CellType * Cell = &Sim_Cells[(Index + Probe) & (SIM_CELLS - 1U)];
+        if (Cell->used == FALSE)
+        {
+            Cell->used = TRUE;
+            Cell->address = Address;
+            return Cell;
+        }
+        if (Cell->address == Address)
+        {
+            return Cell;
+        }
+    }
+    /* Table full: the simulated program touches far more registers than the MCAL has */
+    return &Sim_Cells[Index];
+}
+
+/* Returns the cell of Address if it was already used, NULL_PTR otherwise */
+STATIC const Sim_CellType * Sim_FindCell(uint32 Address)
+{
+    uint32 Index = ((Address >> 2U) * 2654435761U) & (SIM_CELLS - 1U);
+    uint32 Probe;
+    for (Probe = 0U; Probe < SIM_CELLS; Probe++)
+    {
+        const Sim_CellType * Cell = &Sim_Cells[(Index + Probe) & (SIM_CELLS - 1U)];
+        if (Cell->used == FALSE)
+        {
+            break;
+        }
+        if (Cell->address == Address)
+        {
+            return Cell;
+        }
+    }
+    return NULL_PTR;
+}
+
+/* Decodes a GPIO address into its port, offset and aperture, returns FALSE for a non GPIO address */
+STATIC boolean Sim_DecodeGpio(uint32 Address, uint8 * Port, uint32 * Offset, boolean * Ahb)
+{
+    if ((Address >= SIM_GPIO_APB_PORTA_BASE) && (Address < (SIM_GPIO_APB_PORTA_BASE + (4U * SIM_GPIO_BLOCK_SIZE))))
+    {
+        *Port = (uint8)((Address - SIM_GPIO_APB_PORTA_BASE) / SIM_GPIO_BLOCK_SIZE);
+        *Ahb = FALSE;
+    }
+    else if ((Address >= SIM_GPIO_APB_PORTE_BASE) && (Address < (SIM_GPIO_APB_PORTE_BASE + (2U * SIM_GPIO_BLOCK_SIZE))))
+    {
+        *Port = (uint8)(4U + ((Address - SIM_GPIO_APB_PORTE_BASE) / SIM_GPIO_BLOCK_SIZE));
+        *Ahb = FALSE;
+    }
+    else if ((Address >= SIM_GPIO_AHB_PORTA_BASE) && (Address < (SIM_GPIO_AHB_PORTA_BASE + (MCAL_SIM_GPIO_PORTS * SIM_GPIO_BLOCK_SIZE))))
+    {
+        *Port = (uint8)((Address - SIM_GPIO_AHB_PORTA_BASE) / SIM_GPIO_BLOCK_SIZE);
+        *Ahb = TRUE;
+    }
+    else
+    {
+        return FALSE;
+    }
+    *Offset = Address & (SIM_GPIO_BLOCK_SIZE - 1U);
+    return TRUE;
+}
+
+/* Address of register Offset of Port in the APB aperture, where the port registers are stored */
+STATIC uint32 Sim_GpioRegAddress(uint8 Port, uint32 Offset)
+{
+    uint32 Base = (Port < 4U) ? (SIM_GPIO_APB_PORTA_BASE + ((uint32)Port * SIM_GPIO_BLOCK_SIZE))
+                              : (SIM_GPIO_APB_PORTE_BASE + ((uint32)(Port - 4U) * SIM_GPIO_BLOCK_SIZE));
+    return Base + Offset;
+}
+
+/* Value of register Offset of Port */
+STATIC uint32 Sim_GpioReg(uint8 Port, uint32 Offset)
+{
+    return Sim_Cell(Sim_GpioRegAddress(Port, Offset))->value;
+}
+
+/* Pins of Port driven by the PWM output of a timer CCP (GPIOAFSEL set, GPIOPCTL 7), their levels in *Levels */
+STATIC uint32 Sim_GpioCcpPins(uint8 Port, uint32 * Levels)
+{
+    uint32 Afsel = Sim_GpioReg(Port, SIM_GPIO_AFSEL) & 0xFFU;
+    uint32 Pctl;
+    uint32 Pins = 0U;
+    uint32 Pin;
+
+    *Levels = 0U;
+    if (Afsel == 0U)
+    {
+        return 0U;
+    }
+    Pctl = Sim_GpioReg(Port, SIM_GPIO_PCTL);
+    for (Pin = 0U; Pin < 8U; Pin++)
+    {
+        uint32 Ccp = Sim_CcpPins[Port][Pin];
+        if ((((Afsel >> Pin) & 1U) != 0U) && (((Pctl >> (Pin * 4U)) & 0xFU) == SIM_GPIO_PCTL_CCP) && (Ccp != 0U))
+        {
+            uint32 Timer = (Ccp - 1U) >> 1U;
+            uint32 Half = (Ccp - 1U) & 1U;
+            boolean Inverted = ((Sim_Cell(SIM_TIMER_BASE + (Timer * 0x1000U) + SIM_TIMER_CTL)->value & SIM_TIMER_CTL_PWML(Half)) != 0U) ? TRUE : FALSE;
+            Pins |= 1UL << Pin;
+            if (Sim_TimerPwm[Timer][Half] != Inverted)
+            {
+                *Levels |= 1UL << Pin;
+            }
+        }
+    }
+    return Pins;
+}
+
+/* Current level of the pins of Port as seen by a DATA read */
+STATIC uint32 Sim_GpioPins(uint8 Port)
+{
+    uint32 Dir = Sim_Cell(Sim_GpioRegAddress(Port, SIM_GPIO_DIR))->value;
+    uint32 Den = Sim_Cell(Sim_GpioRegAddress(Port, SIM_GPIO_DEN))->value;
+    uint32 CcpLevels;
+    uint32 Ccp = Sim_GpioCcpPins(Port, &CcpLevels);
+    uint32 Levels = (Sim_Ports[Port].latch & Dir) | (Sim_Ports[Port].inputs & ~Dir);
+    return ((Levels & ~Ccp) | CcpLevels) & Den & 0xFFU;
+}
+
+/* GPIORIS of Port: the latched edges of the edge sensitive pins, the current level of the level sensitive ones */
+STATIC uint32 Sim_GpioRis(uint8 Port)
+{
+    uint32 Is = Sim_GpioReg(Port, SIM_GPIO_IS);
+    uint32 Level = Is & ~(Sim_GpioPins(Port) ^ Sim_GpioReg(Port, SIM_GPIO_IEV));
+    return ((Sim_Ports[Port].edges & ~Is) | Level) & 0xFFU;
+}
+
+STATIC uint32 Sim_Load(uint32 Address);
+STATIC void Sim_Store(uint32 Address, uint32 Value);
+STATIC void Sim_UdmaRequest(uint32 Channel, uint32 Irq);
+
+/*
+ * Latches the edges of Port between the pin levels Before and the current ones. An edge on a pin set in
+ * GPIODMACTL requests the uDMA channel of the port when it is mapped to the GPIO (encoding 3).
+ */
+STATIC void Sim_GpioLatchEdges(uint8 Port, uint32 Before)
+{
+    uint32 After = Sim_GpioPins(Port);
+    uint32 Changed = Before ^ After;
+    uint32 Ibe;
+    uint32 Iev;
+    uint32 Events;
+
+    if (Changed == 0U)
+    {
+        return;
+    }
+    Ibe = Sim_GpioReg(Port, SIM_GPIO_IBE);
+    Iev = Sim_GpioReg(Port, SIM_GPIO_IEV);
+    Events = ((Changed & Ibe) | (Changed & ~Ibe & ~(After ^ Iev))) & ~Sim_GpioReg(Port, SIM_GPIO_IS) & 0xFFU;
+    Sim_Ports[Port].edges |= Events;
+    if (Sim_PinHook != NULL_PTR)
+    {
+        Sim_PinHook(Port, (uint8)Before, (uint8)After);
+    }
+    if ((Events & Sim_GpioReg(Port, SIM_GPIO_DMACTL)) != 0U)
+    {
+        uint32 Channel = Sim_GpioDmaChannels[Port];
+        uint32 Map = Sim_Cell(SIM_UDMA_CHMAP0 + ((Channel >> 3U) * 4U))->value;
+        if (((Map >> ((Channel & 7U) * 4U)) & 0xFU) == 3U)
+        {
+            Sim_UdmaRequest(Channel, Sim_GpioIrqs[Port]);
+        }
+    }
+}
+
+/* GPIO load without counting */
+STATIC uint32 Sim_GpioLoad(uint8 Port, uint32 Offset)
+{
+    if (Offset <= SIM_GPIO_DATA_END)
+    {
+        /* Address bits [9:2] mask the pins read */
+        return Sim_GpioPins(Port) & ((Offset >> 2U) & 0xFFU);
+    }
+    else if (Offset == SIM_GPIO_LOCK)
+    {
+        return (Sim_Ports[Port].unlocked == TRUE) ? 0U : 1U;
+    }
+    else if (Offset == SIM_GPIO_CR)
+    {
+        return Sim_Ports[Port].commit;
+    }
+    else if (Offset == SIM_GPIO_RIS)
+    {
+        return Sim_GpioRis(Port);
+    }
+    else if (Offset == SIM_GPIO_MIS)
+    {
+        return Sim_GpioRis(Port) & Sim_GpioReg(Port, SIM_GPIO_IM);
+    }
+    else
+    {
+        return Sim_GpioReg(Port, Offset);
+    }
+}
+
+/* GPIO store without counting */
+STATIC void Sim_GpioStore(uint8 Port, uint32 Offset, uint32 Value)
+{
+    uint32 Before = Sim_GpioPins(Port);
+
+    if (Offset <= SIM_GPIO_DATA_END)
+    {
+        /* Address bits [9:2] mask the pins written */
+        uint32 Mask = (Offset >> 2U) & 0xFFU;
+        Sim_Ports[Port].latch = (Sim_Ports[Port].latch & ~Mask) | (Value & Mask);
+    }
+    else if (Offset == SIM_GPIO_LOCK)
+    {
+        Sim_Ports[Port].unlocked = (Value == SIM_GPIO_LOCK_KEY) ? TRUE : FALSE;
+    }
+    else if (Offset == SIM_GPIO_CR)
+    {
+        if (Sim_Ports[Port].unlocked == TRUE)
+        {
+            /* Only the protected pins have a writable commit bit */
+            Sim_Ports[Port].commit = (0xFFU & ~(uint32)Sim_LockedPins[Port]) | (Value & Sim_LockedPins[Port]);
+        }
+        else
+        {
+            Sim_Stats.locked_writes++;
+        }
+    }
+    else if (Offset == SIM_GPIO_ICR)
+    {
+        Sim_Ports[Port].edges &= ~Value;
+    }
+    else if ((Offset == SIM_GPIO_RIS) || (Offset == SIM_GPIO_MIS))
+    {
+        /* Read only */
+    }
+    else
+    {
+        Sim_CellType * Cell = Sim_Cell(Sim_GpioRegAddress(Port, Offset));
+        if ((Offset == SIM_GPIO_AFSEL) || (Offset == SIM_GPIO_PUR) || (Offset == SIM_GPIO_PDR) || (Offset == SIM_GPIO_DEN))
+        {
+            /* Bits of the pins not committed in GPIOCR keep their value */
+            Cell->value = (Cell->value & ~Sim_Ports[Port].commit) | (Value & Sim_Ports[Port].commit);
+            if ((Offset == SIM_GPIO_PUR) || (Offset == SIM_GPIO_PDR))
+            {
+                /* Setting a pull-up bit clears the pull-down one and the reverse */
+                Sim_CellType * Other = Sim_Cell(Sim_GpioRegAddress(Port, (Offset == SIM_GPIO_PUR) ? SIM_GPIO_PDR : SIM_GPIO_PUR));
+                Other->value &= ~(Value & Sim_Ports[Port].commit);
+            }
+        }
+        else
+        {
+            Cell->value = Value;
+        }
+    }
+    /* Output and configuration changes move the pins too */
+    Sim_GpioLatchEdges(Port, Before);
+}
+
+/* Value of register Offset of timer Timer */
+STATIC uint32 Sim_TimerReg(uint32 Timer, uint32 Offset)
+{
+    return Sim_Cell(SIM_TIMER_BASE + (Timer * 0x1000U) + Offset)->value;
+}
+
+/* Clocks between two timeouts of half Half (0 = A, 1 = B) of timer Timer */
+STATIC uint32 Sim_TimerPeriod(uint32 Timer, uint32 Half)
+{
+    uint32 Reload = Sim_TimerReg(Timer, (Half == 0U) ? SIM_TIMER_TAILR : SIM_TIMER_TBILR);
+    if ((Timer < SIM_NARROW_TIMERS) && (Sim_TimerReg(Timer, SIM_TIMER_CFG) == SIM_TIMER_CFG_16_BIT))
+    {
+        Reload &= 0xFFFFU;
+    }
+    return Reload + 1U;
+}
+
+/* Counter value (GPTMTnR/GPTMTnV) of half Half of timer Timer, counting down to 0 before its timeout */
+STATIC uint32 Sim_TimerValue(uint32 Timer, uint32 Half)
+{
+    return (Sim_TimerCount[Timer][Half] == 0U) ? 0U : (Sim_TimerCount[Timer][Half] - 1U);
+}
+
+/* TRUE when half Half of timer Timer runs in PWM mode */
+STATIC boolean Sim_TimerIsPwm(uint32 Timer, uint32 Half)
+{
+    return ((Sim_TimerReg(Timer, (Half == 0U) ? SIM_TIMER_TAMR : SIM_TIMER_TBMR) & SIM_TIMER_MR_AMS) != 0U) ? TRUE : FALSE;
+}
+
+/*
+ * Clocks before the counter of half Half of timer Timer reaches its match value in the current period, 0 for
+ * none. The match counts when its interrupt is enabled or when it ends the asserted part of a PWM period.
+ */
+STATIC uint32 Sim_TimerToMatch(uint32 Timer, uint32 Half)
+{
+    uint32 Match = Sim_TimerReg(Timer, (Half == 0U) ? SIM_TIMER_TAMATCHR : SIM_TIMER_TBMATCHR);
+    uint32 Value = Sim_TimerValue(Timer, Half);
+    if (((Sim_TimerReg(Timer, (Half == 0U) ? SIM_TIMER_TAMR : SIM_TIMER_TBMR) & SIM_TIMER_MR_MIE) == 0U)
+        && (Sim_TimerIsPwm(Timer, Half) == FALSE))
+    {
+        return 0U;
+    }
+    if ((Timer < SIM_NARROW_TIMERS) && (Sim_TimerReg(Timer, SIM_TIMER_CFG) == SIM_TIMER_CFG_16_BIT))
+    {
+        Match &= 0xFFFFU;
+    }
+    return (Value > Match) ? (Value - Match) : 0U;
+}
+
+/* Timer register load: counters and interrupt status */
+STATIC uint32 Sim_TimerLoad(uint32 Address)
+{
+    uint32 Timer = (Address - SIM_TIMER_BASE) / 0x1000U;
+    uint32 Offset = Address & 0xFFFU;
+
+    switch (Offset)
+    {
+        case SIM_TIMER_RIS:
+            return Sim_TimerRis[Timer];
+        case SIM_TIMER_MIS:
+            return Sim_TimerRis[Timer] & Sim_TimerReg(Timer, SIM_TIMER_IMR);
+        case SIM_TIMER_TAR:
+        case SIM_TIMER_TAV:
+            return Sim_TimerValue(Timer, 0U);
+        case SIM_TIMER_TBR:
+        case SIM_TIMER_TBV:
+            return Sim_TimerValue(Timer, 1U);
+        default:
+            return Sim_Cell(Address)->value;
+    }
+}
+
+/* Asserts or deasserts the PWM output of half Half of timer Timer, moving the CCP pins it drives */
+STATIC void Sim_TimerSetPwm(uint32 Timer, uint32 Half, boolean Asserted)
+{
+    uint32 Before[MCAL_SIM_GPIO_PORTS];
+    uint8 Port;
+
+    if (Sim_TimerPwm[Timer][Half] == Asserted)
+    {
+        return;
+    }
+    for (Port = 0U; Port < MCAL_SIM_GPIO_PORTS; Port++)
+    {
+        Before[Port] = Sim_GpioPins(Port);
+    }
+    Sim_TimerPwm[Timer][Half] = Asserted;
+    for (Port = 0U; Port < MCAL_SIM_GPIO_PORTS; Port++)
+    {
+        Sim_GpioLatchEdges(Port, Before[Port]);
+    }
+}
+
+/* Timer register store: enabling a half or synchronizing it restarts its count (and asserts its PWM output) */
+STATIC void Sim_TimerStore(uint32 Address, uint32 Value)
+{
+    uint32 Timer = (Address - SIM_TIMER_BASE) / 0x1000U;
+    uint32 Offset = Address & 0xFFFU;
+    uint32 Half;
+
+    if ((Timer == 0U) && (Offset == SIM_TIMER_SYNC))
+    {
+        /* GPTMSYNC: 2 bits per timer, A then B */
+        for (Timer = 0U; Timer < SIM_TIMERS; Timer++)
+        {
+            for (Half = 0U; Half < 2U; Half++)
+            {
+                if (((Value >> ((Timer * 2U) + Half)) & 1U) != 0U)
+                {
+                    Sim_TimerCount[Timer][Half] = Sim_TimerPeriod(Timer, Half);
+                }
+            }
+        }
+        return;
+    }
+    if (Offset == SIM_TIMER_CTL)
+    {
+        uint32 Previous = Sim_TimerReg(Timer, SIM_TIMER_CTL);
+        for (Half = 0U; Half < 2U; Half++)
+        {
+            if (((Value & ~Previous) & SIM_TIMER_CTL_EN(Half)) != 0U)
+            {
+                Sim_TimerCount[Timer][Half] = Sim_TimerPeriod(Timer, Half);
+            }
+        }
+        Sim_Cell(Address)->value = Value;
+        for (Half = 0U; Half < 2U; Half++)
+        {
+            if ((((Value & ~Previous) & SIM_TIMER_CTL_EN(Half)) != 0U) && (Sim_TimerIsPwm(Timer, Half) == TRUE))
+            {
+                Sim_TimerSetPwm(Timer, Half, TRUE);
+            }
+        }
+        return;
+    }
+    if (Offset == SIM_TIMER_ICR)
+    {
+        Sim_TimerRis[Timer] &= ~Value;
+    }
+    Sim_Cell(Address)->value = Value;
+}
+
+/* Host memory of the simulated RAM range [Address, Address + Size), NULL_PTR when it is not mapped */
+STATIC uint8 * Sim_RamHost(uint32 Address, uint32 Size)
+{
+    uint32 Index;
+    for (Index = 0U; Index < Sim_RamRegionCount; Index++)
+    {
+        const Sim_RamRegionType * Region = &Sim_RamRegions[Index];
+        if ((Address >= Region->address) && ((Address - Region->address) + Size <= Region->size))
+        {
+            return Region->host + (Address - Region->address);
+        }
+    }
+    return NULL_PTR;
+}
+
+
+/* uDMA item read of 1 << Size bytes, from mapped RAM or from a peripheral register */
+STATIC uint32 Sim_DmaRead(uint32 Address, uint32 Size)
+{
+    uint8 * Host = Sim_RamHost(Address, 1UL << Size);
+    uint32 Value = 0U;
+    uint32 Byte;
+    if (Host != NULL_PTR)
+    {
+        for (Byte = 0U; Byte < (1UL << Size); Byte++)
+        {
+            Value |= (uint32)Host[Byte] << (Byte * 8U);
+        }
+        return Value;
+    }
+    return Sim_Load(Address & ~3U) >> ((Address & 3U) * 8U);
+}
+
+/* uDMA item write of 1 << Size bytes, to mapped RAM or to a peripheral register */
+STATIC void Sim_DmaWrite(uint32 Address, uint32 Size, uint32 Value)
+{
+    uint8 * Host = Sim_RamHost(Address, 1UL << Size);
+    uint32 Byte;
+    if (Host != NULL_PTR)
+    {
+        for (Byte = 0U; Byte < (1UL << Size); Byte++)
+        {
+            Host[Byte] = (uint8)(Value >> (Byte * 8U));
+        }
+        return;
+    }
+    Sim_Store(Address & ~3U, Value);
+}
+
+/* Calls the handler of Irq when it is enabled in the NVIC */
+STATIC void Sim_RaiseIrq(uint32 Irq)
+{
+    if ((Irq < SIM_IRQS) && (((Sim_NvicEnabled[Irq >> 5U] >> (Irq & 31U)) & 1U) != 0U) && (Sim_Isrs[Irq] != NULL_PTR))
+    {
+        Sim_Isrs[Irq]();
+    }
+}
+
+/*
+ * One request of uDMA channel Channel: one item of the active control structure (arbitration size 1).
+ * The completion of a structure sets DMACHIS, switches to the other structure in ping-pong mode and
+ * interrupts the requester, a request on a stopped structure disables the channel.
+ */
+STATIC void Sim_UdmaRequest(uint32 Channel, uint32 Irq)
+{
+    uint32 Bit = 1UL << Channel;
+    uint32 Alternate = (Sim_Udma.alternate >> Channel) & 1U;
+    uint8 * Entry = Sim_RamHost(Sim_Cell(SIM_UDMA_CTLBASE)->value + ((Channel + (Alternate * SIM_UDMA_CHANNELS)) * 16U), 16U);
+    uint32 * Words = (uint32 *)(void *)Entry;
+    uint32 Control;
+    uint32 Mode;
+    uint32 Left;
+    uint32 SrcInc;
+    uint32 DstInc;
+    uint32 Src;
+    uint32 Dst;
+
+    if (((Sim_Udma.enabled & Bit) == 0U) || ((Sim_Udma.reqmask & Bit) != 0U) || (Entry == NULL_PTR))
+    {
+        return;
+    }
+    Control = Words[2];
+    Mode = Control & 7U;
+    if (Mode == 0U)
+    {
+        Sim_Udma.enabled &= ~Bit;
+        Sim_Stats.dma_underruns++;
+        return;
+    }
+    Left = ((Control >> 4U) & 0x3FFU) + 1U;
+    SrcInc = (Control >> 26U) & 3U;
+    DstInc = (Control >> 30U) & 3U;
+    Src = Words[0] - ((SrcInc == 3U) ? 0U : ((Left - 1U) << SrcInc));
+    Dst = Words[1] - ((DstInc == 3U) ? 0U : ((Left - 1U) << DstInc));
+    Sim_DmaWrite(Dst, (Control >> 28U) & 3U, Sim_DmaRead(Src, (Control >> 24U) & 3U));
+    Sim_Stats.dma_transfers++;
+
+    if (Left == 1U)
+    {
+        Words[2] = Control & ~((0x3FFUL << 4U) | 7U);
+        Sim_Udma.chis |= Bit;
+        if (Mode == 3U)
+        {
+            Sim_Udma.alternate ^= Bit;
+        }
+        else
+        {
+            Sim_Udma.enabled &= ~Bit;
+        }
+        Sim_RaiseIrq(Irq);
+    }
+    else
+    {
+        Words[2] = (Control & ~(0x3FFUL << 4U)) | ((Left - 2U) << 4U);
+    }
+}
+
+/* Timeout or match event Event (GPTMRIS bit) of half Half of timer Timer, interrupting when it is unmasked in GPTMIMR */
+STATIC void Sim_TimerEvent(uint32 Timer, uint32 Half, uint32 Event)
+{
+    Sim_TimerRis[Timer] |= Event;
+    if ((Sim_TimerReg(Timer, SIM_TIMER_IMR) & Event) != 0U)
+    {
+        Sim_RaiseIrq(Sim_TimerIrqs[Timer][Half]);
+    }
+}
+
+/*
+ * Timeout of half Half of timer Timer: a PWM output is asserted again, the timers 0..2 mapped to encoding 0
+ * request their uDMA channel, then the timeout event
+ */
+STATIC void Sim_TimerTimeout(uint32 Timer, uint32 Half)
+{
+    uint32 Channel = SIM_TIMER_UDMA_CHANNEL + (Timer * 2U) + Half;
+    if (Sim_TimerIsPwm(Timer, Half) == TRUE)
+    {
+        Sim_TimerSetPwm(Timer, Half, TRUE);
+    }
+    if ((Timer < SIM_TIMER_REQUEST_TIMERS)
+        && (((Sim_Cell(SIM_UDMA_CHMAP2)->value >> ((Channel - 16U) * 4U)) & 0xFU) == 0U))
+    {
+        Sim_UdmaRequest(Channel, Sim_TimerIrqs[Timer][Half]);
+    }
+    Sim_TimerEvent(Timer, Half, SIM_TIMER_INT_TO(Half));
+}
+
+/* Cycles of the simulated core: the clocks advanced and the register accesses made */
+STATIC uint32 Sim_DwtCycles(void)
+{
+    return Sim_Stats.clocks + (Sim_Stats.sequence * SIM_DWT_ACCESS_CLOCKS);
+}
+
+/* The DWT cycle counter runs when the DWT is powered (DEMCR.TRCENA) and the counter enabled */
+STATIC boolean Sim_DwtCounting(void)
+{
+    return (((Sim_Cell(SIM_DEMCR)->value & SIM_DEMCR_TRCENA) != 0U)
+            && ((Sim_Cell(SIM_DWT_CTRL)->value & SIM_DWT_CTRL_CYCCNTENA) != 0U)) ? TRUE : FALSE;
+}
+
+/* Load of any simulated address except the bit-band alias, without counting */
+STATIC uint32 Sim_Load(uint32 Address)
+{
+    uint8 Port;
+    uint32 Offset;
+    boolean Ahb;
+
+    if (Sim_DecodeGpio(Address, &Port, &Offset, &Ahb) == TRUE)
+    {
+        return Sim_GpioLoad(Port, Offset);
+    }
+    else if ((Address == SIM_SYSCTL_RCGC2) || (Address == SIM_SYSCTL_RCGCGPIO))
+    {
+        return Sim_ClockGates;
+    }
+    else if ((Address == SIM_SYSCTL_PRTIMER) || (Address == SIM_SYSCTL_PRDMA) || (Address == SIM_SYSCTL_PRWTIMER))
+    {
+        /* Timers and uDMA are ready as soon as they are clocked */
+        return Sim_Cell(Address - (SIM_SYSCTL_PRTIMER - SIM_SYSCTL_RCGCTIMER))->value;
+    }
+    else if ((Address == SIM_UDMA_ENASET) || (Address == SIM_UDMA_ENACLR))
+    {
+        return Sim_Udma.enabled;
+    }
+    else if ((Address == SIM_UDMA_ALTSET) || (Address == SIM_UDMA_ALTCLR))
+    {
+        return Sim_Udma.alternate;
+    }
+    else if ((Address == SIM_UDMA_REQMASKSET) || (Address == SIM_UDMA_REQMASKCLR))
+    {
+        return Sim_Udma.reqmask;
+    }
+    else if (Address == SIM_UDMA_CHIS)
+    {
+        return Sim_Udma.chis;
+    }
+    else if ((Address >= SIM_NVIC_EN0) && (Address < (SIM_NVIC_EN0 + (4U * SIM_NVIC_REGISTERS))))
+    {
+        return Sim_NvicEnabled[(Address - SIM_NVIC_EN0) >> 2U];
+    }
+    else if ((Address >= SIM_TIMER_BASE) && (Address < (SIM_TIMER_BASE + (SIM_TIMERS * 0x1000U))))
+    {
+        return Sim_TimerLoad(Address);
+    }
+    else if ((Address >= SIM_NVIC_DIS0) && (Address < (SIM_NVIC_DIS0 + (4U * SIM_NVIC_REGISTERS))))
+    {
+        return Sim_NvicEnabled[(Address - SIM_NVIC_DIS0) >> 2U];
+    }
+    else if ((Address == SIM_DWT_CYCCNT) && (Sim_DwtCounting() == TRUE))
+    {
+        return Sim_DwtCycles() - Sim_DwtOrigin;
+    }
+    else if (Address == SIM_SYSCTL_PRGPIO)
+    {
+        uint32 Ready = 0U;
+        uint8 Index;
+        for (Index = 0U; Index < MCAL_SIM_GPIO_PORTS; Index++)
+        {
+            if ((Sim_ClockGates & (1UL << Index)) != 0U)
+            {
+                if (Sim_Ports[Index].ready_countdown == 0U)
+                {
+                    Ready |= (1UL << Index);
+                }
+                else
+                {
+                    Sim_Ports[Index].ready_countdown--;
+                }
+            }
+        }
+        return Ready;
+    }
+    else
+    {
+        return Sim_Cell(Address)->value;
+    }
+}
+
+/* Store to any simulated address except the bit-band alias, without counting */
+STATIC void Sim_Store(uint32 Address, uint32 Value)
+{
+    uint8 Port;
+    uint32 Offset;
+    boolean Ahb;
+
+    if (Sim_DecodeGpio(Address, &Port, &Offset, &Ahb) == TRUE)
+    {
+        Sim_GpioStore(Port, Offset, Value);
+    }
+    else if ((Address == SIM_SYSCTL_RCGC2) || (Address == SIM_SYSCTL_RCGCGPIO))
+    {
+        uint32 Enabled = Value & SIM_SYSCTL_GPIO_MASK & ~Sim_ClockGates;
+        uint8 Index;
+        for (Index = 0U; Index < MCAL_SIM_GPIO_PORTS; Index++)
+        {
+            if ((Enabled & (1UL << Index)) != 0U)
+            {
+                Sim_Ports[Index].ready_countdown = Sim_PrgpioDelay;
+            }
+        }
+        Sim_ClockGates = Value & SIM_SYSCTL_GPIO_MASK;
+    }
+    else if ((Address == SIM_SYSCTL_PRGPIO) || (Address == SIM_SYSCTL_PRTIMER) || (Address == SIM_SYSCTL_PRDMA)
+             || (Address == SIM_SYSCTL_PRWTIMER))
+    {
+        /* Read only */
+    }
+    else if (Address == SIM_UDMA_ENASET)
+    {
+        Sim_Udma.enabled |= Value;
+    }
+    else if (Address == SIM_UDMA_ENACLR)
+    {
+        Sim_Udma.enabled &= ~Value;
+    }
+    else if (Address == SIM_UDMA_ALTSET)
+    {
+        Sim_Udma.alternate |= Value;
+    }
+    else if (Address == SIM_UDMA_ALTCLR)
+    {
+        Sim_Udma.alternate &= ~Value;
+    }
+    else if (Address == SIM_UDMA_REQMASKSET)
+    {
+        Sim_Udma.reqmask |= Value;
+    }
+    else if (Address == SIM_UDMA_REQMASKCLR)
+    {
+        Sim_Udma.reqmask &= ~Value;
+    }
+    else if (Address == SIM_UDMA_CHIS)
+    {
+        Sim_Udma.chis &= ~Value;
+    }
+    else if ((Address >= SIM_NVIC_EN0) && (Address < (SIM_NVIC_EN0 + (4U * SIM_NVIC_REGISTERS))))
+    {
+        Sim_NvicEnabled[(Address - SIM_NVIC_EN0) >> 2U] |= Value;
+    }
+    else if ((Address >= SIM_NVIC_DIS0) && (Address < (SIM_NVIC_DIS0 + (4U * SIM_NVIC_REGISTERS))))
+    {
+        Sim_NvicEnabled[(Address - SIM_NVIC_DIS0) >> 2U] &= ~Value;
+    }
+    else if ((Address >= SIM_TIMER_BASE) && (Address < (SIM_TIMER_BASE + (SIM_TIMERS * 0x1000U))))
+    {
+        Sim_TimerStore(Address, Value);
+    }
+    else if ((Address == SIM_DWT_CYCCNT) || (Address == SIM_DWT_CTRL) || (Address == SIM_DEMCR))
+    {
+        /* The counter keeps its value while stopped and counts on from it */
+        Sim_Cell(SIM_DWT_CYCCNT)->value = Sim_Load(SIM_DWT_CYCCNT);
+        Sim_Cell(Address)->value = Value;
+        Sim_DwtOrigin = Sim_DwtCycles() - Sim_Cell(SIM_DWT_CYCCNT)->value;
+    }
+    else
+    {
+        Sim_Cell(Address)->value = Value;
+    }
+}
+
+/* Checks the GPIO port clock and aperture of an access */
+STATIC void Sim_CheckGpioAccess(uint32 Address)
+{
+    uint8 Port;
+    uint32 Offset;
+    boolean Ahb;
+
+    if (Sim_DecodeGpio(Address, &Port, &Offset, &Ahb) == TRUE)
+    {
+        boolean AhbSelected = ((Sim_Cell(SIM_SYSCTL_GPIOHBCTL)->value & (1UL << Port)) != 0U) ? TRUE : FALSE;
+        if (Ahb == TRUE)
+        {
+            Sim_Stats.ahb_accesses++;
+        }
+        else
+        {
+            Sim_Stats.apb_accesses++;
+        }
+        if (Ahb != AhbSelected)
+        {
+            Sim_Stats.wrong_aperture_accesses++;
+        }
+        if ((Sim_ClockGates & (1UL << Port)) == 0U)
+        {
+            Sim_Stats.ungated_accesses++;
+        }
+    }
+}
+
+/* Decodes a bit-band alias address into the word address and bit it maps to */
+STATIC boolean Sim_DecodeBitband(uint32 Address, uint32 * WordAddress, uint32 * Bit)
+{
+    uint32 ByteAddress;
+    if ((Address < SIM_BITBAND_ALIAS_BASE) || (Address >= SIM_BITBAND_ALIAS_END))
+    {
+        return FALSE;
+    }
+    ByteAddress = SIM_BITBAND_BASE + ((Address - SIM_BITBAND_ALIAS_BASE) >> 5U);
+    *WordAddress = ByteAddress & ~3U;
+    *Bit = ((ByteAddress & 3U) * 8U) + ((Address >> 2U) & 7U);
+    return TRUE;
+}
+
+void Mcal_Sim_Reset(void)
+{
+    uint32 Index;
+    for (Index = 0U; Index < SIM_CELLS; Index++)
+    {
+        Sim_Cells[Index].used = FALSE;
+        Sim_Cells[Index].address = 0U;
+        Sim_Cells[Index].value = 0U;
+        Sim_Cells[Index].loads = 0U;
+        Sim_Cells[Index].stores = 0U;
+        Sim_Cells[Index].store_stamp = 0U;
+    }
+    for (Index = 0U; Index < MCAL_SIM_GPIO_PORTS; Index++)
+    {
+        Sim_Ports[Index].latch = 0U;
+        Sim_Ports[Index].inputs = 0U;
+        Sim_Ports[Index].edges = 0U;
+        Sim_Ports[Index].commit = 0xFFU & ~(uint32)Sim_LockedPins[Index];
+        Sim_Ports[Index].unlocked = FALSE;
+        Sim_Ports[Index].ready_countdown = 0U;
+    }
+    Sim_Stats.loads = 0U;
+    Sim_Stats.stores = 0U;
+    Sim_Stats.apb_accesses = 0U;
+    Sim_Stats.ahb_accesses = 0U;
+    Sim_Stats.bitband_accesses = 0U;
+    Sim_Stats.wrong_aperture_accesses = 0U;
+    Sim_Stats.ungated_accesses = 0U;
+    Sim_Stats.locked_writes = 0U;
+    Sim_Stats.interrupt_masks = 0U;
+    Sim_Stats.dma_transfers = 0U;
+    Sim_Stats.dma_underruns = 0U;
+    Sim_Stats.clocks = 0U;
+    Sim_Stats.preemption_points = 0U;
+    Sim_Stats.deferred_preemptions = 0U;
+    Sim_Stats.exclusive_failures = 0U;
+    Sim_Stats.sequence = 0U;
+    for (Index = 0U; Index < SIM_TIMERS; Index++)
+    {
+        Sim_TimerCount[Index][0] = 0U;
+        Sim_TimerCount[Index][1] = 0U;
+        Sim_TimerRis[Index] = 0U;
+        Sim_TimerPwm[Index][0] = FALSE;
+        Sim_TimerPwm[Index][1] = FALSE;
+    }
+    for (Index = 0U; Index < SIM_NVIC_REGISTERS; Index++)
+    {
+        Sim_NvicEnabled[Index] = 0U;
+    }
+    for (Index = 0U; Index < SIM_IRQS; Index++)
+    {
+        Sim_Isrs[Index] = NULL_PTR;
+    }
+    Sim_Udma.enabled = 0U;
+    Sim_Udma.alternate = 0U;
+    Sim_Udma.reqmask = 0U;
+    Sim_Udma.chis = 0U;
+    Sim_RamRegionCount = 0U;
+    Sim_RamNext = SIM_RAM_BASE;
+    Sim_PrgpioDelay = SIM_PRGPIO_DEFAULT_DELAY;
+    Sim_ClockGates = 0U;
+    Sim_InterruptsMasked = 0U;
+    Sim_PreemptionHook = NULL_PTR;
+    Sim_PreemptionPending = FALSE;
+    Sim_ExclusiveArmed = FALSE;
+    Sim_ExclusiveWord = NULL_PTR;
+    Sim_PinHook = NULL_PTR;
+    Sim_DwtOrigin = 0U;
+}
+
+/* Preemption point after an access: the hook runs now, or when the interrupts are unmasked */
+STATIC void Sim_Preempt(void)
+{
+    uint32 Sequence;
+
+    if (Sim_PreemptionHook == NULL_PTR)
+    {
+        return;
+    }
+    if (Sim_InterruptsMasked != 0U)
+    {
+        if (Sim_PreemptionPending == FALSE)
+        {
+            Sim_PreemptionPending = TRUE;
+            Sim_Stats.deferred_preemptions++;
+        }
+        return;
+    }
+    Sim_Stats.preemption_points++;
+    Sequence = Sim_Stats.sequence;
+    Sim_PreemptionHook();
+    if (Sim_Stats.sequence != Sequence)
+    {
+        /* The hook ran an "ISR": the exception entry and return clear the local exclusive monitor */
+        Sim_ExclusiveArmed = FALSE;
+    }
+}
+
+uint32 Mcal_Sim_Read32(uint32 Address)
+{
+    Sim_CellType * Cell;
+    uint32 WordAddress;
+    uint32 Bit;
+    uint32 Value;
+
+    Sim_InModel++;
+    Cell = Sim_Cell(Address);
+    Cell->loads++;
+    Sim_Stats.loads++;
+    Sim_Stats.sequence++;
+    if (Sim_DecodeBitband(Address, &WordAddress, &Bit) == TRUE)
+    {
+        /* The alias word reads the bit as 0 or 1 */
+        Sim_Stats.bitband_accesses++;
+        Sim_CheckGpioAccess(WordAddress);
+        Value = (Sim_Load(WordAddress) >> Bit) & 1U;
+    }
+    else
+    {
+        Sim_CheckGpioAccess(Address);
+        Value = Sim_Load(Address);
+    }
+    /* The value is already loaded, a preemption here comes between the load and what the code does with it */
+    Sim_Preempt();
+    Sim_InModel--;
+    return Value;
+}
+
+void Mcal_Sim_Write32(uint32 Address, uint32 Value)
+{
+    Sim_CellType * Cell;
+    uint32 WordAddress;
+    uint32 Bit;
+
+    Sim_InModel++;
+    Cell = Sim_Cell(Address);
+    Cell->stores++;
+    Sim_Stats.stores++;
+    Sim_Stats.sequence++;
+    Cell->store_stamp = Sim_Stats.sequence;
+    if (Sim_DecodeBitband(Address, &WordAddress, &Bit) == TRUE)
+    {
+        /* The alias word writes bit 0 of the value to the bit, the bus does the read-modify-write */
+        uint32 Word;
+        Sim_Stats.bitband_accesses++;
+        Sim_CheckGpioAccess(WordAddress);
+        Word = Sim_Load(WordAddress);
+        if ((WordAddress & (SIM_GPIO_BLOCK_SIZE - 1U)) <= SIM_GPIO_DATA_END)
+        {
+            /* The DATA read only returns pin levels, keep the output latch for the other pins */
+            uint8 Port;
+            uint32 Offset;
+            boolean Ahb;
+            if (Sim_DecodeGpio(WordAddress, &Port, &Offset, &Ahb) == TRUE)
+            {
+                Word = Sim_Ports[Port].latch;
+            }
+        }
+        Word = (Word & ~(1UL << Bit)) | ((Value & 1U) << Bit);
+        Sim_Store(WordAddress, Word);
+    }
+    else
+    {
+        Sim_CheckGpioAccess(Address);
+        Sim_Store(Address, Value);
+    }
+    Sim_Preempt();
+    Sim_InModel--;
+}
+
+uint32 Mcal_Sim_ReadExclusive32(uint32 Address)
+{
+    /* Armed before the access, a preemption after the load clears it as an exception between LDREX and STREX does */
+    Sim_ExclusiveArmed = TRUE;
+    Sim_ExclusiveAddress = Address;
+    Sim_ExclusiveWord = NULL_PTR;
+    return Mcal_Sim_Read32(Address);
+}
+
+uint32 Mcal_Sim_WriteExclusive32(uint32 Address, uint32 Value)
+{
+    if ((Sim_ExclusiveArmed == FALSE) || (Sim_ExclusiveWord != NULL_PTR) || (Sim_ExclusiveAddress != Address))
+    {
+        /* Monitor lost: no store and no access, the code retries from its exclusive load */
+        Sim_ExclusiveArmed = FALSE;
+        Sim_Stats.exclusive_failures++;
+        return 1U;
+    }
+    Sim_ExclusiveArmed = FALSE;
+    Mcal_Sim_Write32(Address, Value);
+    return 0U;
+}
+
+uint32 Mcal_Sim_ReadExclusiveWord(volatile uint32 * Word)
+{
+    uint32 Value = *Word;
+
+    /* Not a register access, but a preemption point as an interrupt can come between LDREX and STREX */
+    Sim_ExclusiveArmed = TRUE;
+    Sim_ExclusiveWord = Word;
+    Sim_Preempt();
+    return Value;
+}
+
+uint32 Mcal_Sim_WriteExclusiveWord(volatile uint32 * Word, uint32 Value)
+{
+    if ((Sim_ExclusiveArmed == FALSE) || (Sim_ExclusiveWord != Word))
+    {
+        Sim_ExclusiveArmed = FALSE;
+        Sim_Stats.exclusive_failures++;
+        return 1U;
+    }
+    Sim_ExclusiveArmed = FALSE;
+    Sim_ExclusiveWord = NULL_PTR;
+    *Word = Value;
+    return 0U;
+}
+
+void Mcal_Sim_SetInputs(uint8 Port, uint8 Levels)
+{
+    if (Port < MCAL_SIM_GPIO_PORTS)
+    {
+        uint32 Before = Sim_GpioPins(Port);
+        Sim_Ports[Port].inputs = Levels;
+        Sim_GpioLatchEdges(Port, Before);
+    }
+}
+
+uint8 Mcal_Sim_GetOutputs(uint8 Port)
+{
+    uint32 Dir;
+    uint32 Den;
+    uint32 CcpLevels;
+    uint32 Ccp;
+    if (Port >= MCAL_SIM_GPIO_PORTS)
+    {
+        return 0U;
+    }
+    Dir = Sim_Cell(Sim_GpioRegAddress(Port, SIM_GPIO_DIR))->value;
+    Den = Sim_Cell(Sim_GpioRegAddress(Port, SIM_GPIO_DEN))->value;
+    Ccp = Sim_GpioCcpPins(Port, &CcpLevels);
+    return (uint8)(((Sim_Ports[Port].latch & Dir & ~Ccp) | CcpLevels) & Den);
+}
+
+uint8 Mcal_Sim_GetPendingInterrupts(uint8 Port)
+{
+    if (Port >= MCAL_SIM_GPIO_PORTS)
+    {
+        return 0U;
+    }
+    return (uint8)(Sim_GpioRis(Port) & Sim_GpioReg(Port, SIM_GPIO_IM));
+}
+
+void Mcal_Sim_SetPrgpioDelay(uint32 Reads)
+{
+    Sim_PrgpioDelay = Reads;
+}
+
+uint32 Mcal_Sim_GetLoadCount(uint32 Address)
+{
+    const Sim_CellType * Cell = Sim_FindCell(Address);
+    return (Cell != NULL_PTR) ? Cell->loads : 0U;
+}
+
+uint32 Mcal_Sim_GetStoreCount(uint32 Address)
+{
+    const Sim_CellType * Cell = Sim_FindCell(Address);
+    return (Cell != NULL_PTR) ? Cell->stores : 0U;
+}
+
+uint32 Mcal_Sim_GetStoreStamp(uint32 Address)
+{
+    const Sim_CellType * Cell = Sim_FindCell(Address);
+    return (Cell != NULL_PTR) ? Cell->store_stamp : 0U;
+}
+
+const Mcal_Sim_StatsType * Mcal_Sim_GetStats(void)
+{
+    return &Sim_Stats;
+}
+
+uint32 Mcal_Sim_SuspendInterrupts(void)
+{
+    uint32 State;
+
+    Sim_InModel++;
+    State = Sim_InterruptsMasked;
+    Sim_InterruptsMasked = 1U;
+    Sim_Stats.interrupt_masks++;
+    Sim_InModel--;
+    return State;
+}
+
+void Mcal_Sim_ResumeInterrupts(uint32 State)
+{
+    Sim_InModel++;
+    Sim_InterruptsMasked = State;
+    if ((State == 0U) && (Sim_PreemptionPending == TRUE))
+    {
+        Sim_PreemptionPending = FALSE;
+        Sim_Preempt();
+    }
+    Sim_InModel--;
+}
+
+void Mcal_Sim_SetPreemptionHook(Mcal_Sim_IsrType Hook)
+{
+    Sim_PreemptionHook = Hook;
+    Sim_PreemptionPending = FALSE;
+}
+
+uint32 Mcal_Sim_MapMemory(const void * Host, uint32 Size)
+{
+    uint32 Index;
+    Sim_RamRegionType * Region;
+
+    for (Index = 0U; Index < Sim_RamRegionCount; Index++)
+    {
+        Region = &Sim_RamRegions[Index];
+        if (((const uint8 *)Host >= Region->host) && (((const uint8 *)Host + Size) <= (Region->host + Region->size)))
+        {
+            return Region->address + (uint32)((const uint8 *)Host - Region->host);
+        }
+    }
+    if (Sim_RamRegionCount == SIM_RAM_REGIONS)
+    {
+        /* Out of regions: the simulated program maps far more objects than the MCAL needs */
+        return 0U;
+    }
+    Region = &Sim_RamRegions[Sim_RamRegionCount++];
+    Region->host = (uint8 *)Host;
+    Region->address = Sim_RamNext;
+    Region->size = Size;
+    Sim_RamNext += (Size + (SIM_RAM_ALIGN - 1U)) & ~(SIM_RAM_ALIGN - 1U);
+    return Region->address;
+}
+
+void Mcal_Sim_SetIsr(uint32 Irq, Mcal_Sim_IsrType Isr)
+{
+    if (Irq < SIM_IRQS)
+    {
+        Sim_Isrs[Irq] = Isr;
+    }
+}
+
+void Mcal_Sim_SetPinHook(Mcal_Sim_PinHookType Hook)
+{
+    Sim_PinHook = Hook;
+}
+
+void Mcal_Sim_AdvanceClock(uint32 Clocks)
+{
+    Sim_Stats.clocks += Clocks;
+    while (Clocks > 0U)
+    {
+        uint32 Step = Clocks;
+        uint32 Timer;
+        uint32 Half;
+
+        /* Jump to the next timeout or match of the running timers */
+        for (Timer = 0U; Timer < SIM_TIMERS; Timer++)
+        {
+            for (Half = 0U; Half < 2U; Half++)
+            {
+                if ((Sim_TimerReg(Timer, SIM_TIMER_CTL) & SIM_TIMER_CTL_EN(Half)) != 0U)
+                {
+                    uint32 ToMatch = Sim_TimerToMatch(Timer, Half);
+                    if (Sim_TimerCount[Timer][Half] < Step)
+                    {
+                        Step = Sim_TimerCount[Timer][Half];
+                    }
+                    if ((ToMatch != 0U) && (ToMatch < Step))
+                    {
+                        Step = ToMatch;
+                    }
+                }
+            }
+        }
+        Clocks -= Step;
+        for (Timer = 0U; Timer < SIM_TIMERS; Timer++)
+        {
+            for (Half = 0U; Half < 2U; Half++)
+            {
+                if ((Sim_TimerReg(Timer, SIM_TIMER_CTL) & SIM_TIMER_CTL_EN(Half)) != 0U)
+                {
+                    boolean Match = (Sim_TimerToMatch(Timer, Half) == Step) ? TRUE : FALSE;
+                    Sim_TimerCount[Timer][Half] -= Step;
+                    if ((Match == TRUE) && (Sim_TimerIsPwm(Timer, Half) == TRUE))
+                    {
+                        Sim_TimerSetPwm(Timer, Half, FALSE);
+                    }
+                    else if (Match == TRUE)
+                    {
+                        Sim_TimerEvent(Timer, Half, SIM_TIMER_INT_M(Half));
+                    }
+                    if (Sim_TimerCount[Timer][Half] == 0U)
+                    {
+                        Sim_TimerCount[Timer][Half] = Sim_TimerPeriod(Timer, Half);
+                        Sim_TimerTimeout(Timer, Half);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#if (SIM_INSTRUCTION_COUNT == STD_ON)
+/* SIGTRAP handler, run after every instruction while the trap flag is set (the kernel clears it in the handler) */
+STATIC void Sim_CountInstruction(int Signal)
+{
+    (void)Signal;
+    if (Sim_InModel == 0U)
+    {
+        Sim_Instructions++;
+    }
+}
+#endif
+
+void Mcal_Sim_StartInstructionCount(void)
+{
+#if (SIM_INSTRUCTION_COUNT == STD_ON)
+    (void)signal(SIGTRAP, Sim_CountInstruction);
+    Sim_Instructions = 0U;
+    /* Past the red zone, the caller may keep data below its stack pointer */
+    __asm__ volatile ("add $-128, %%rsp\n\tpushfq\n\torq %0, (%%rsp)\n\tpopfq\n\tsub $-128, %%rsp"
+                      : : "i" (SIM_RFLAGS_TF) : "cc", "memory");
+#endif
+}
+
+uint32 Mcal_Sim_StopInstructionCount(void)
+{
+#if (SIM_INSTRUCTION_COUNT == STD_ON)
+    __asm__ volatile ("add $-128, %%rsp\n\tpushfq\n\tandq %0, (%%rsp)\n\tpopfq\n\tsub $-128, %%rsp"
+                      : : "i" (~(long)SIM_RFLAGS_TF) : "cc", "memory");
+    return Sim_Instructions;
+#else
+    return 0U;
+#endif
+}
+
+uint32 Mcal_Sim_Random(uint32 * State)
+{
+    *State = (*State * 1103515245U) + 12345U;
+    return *State >> 8U;
+}
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/* Notification callback of the DIO configuration set for the benches that do not enable it, a bench that does
+   provides its own */
+__attribute__((weak)) void DioConf_SW1_NOTIFICATION(uint8 ChannelId)
+{
+    (void)ChannelId;
+}
+#endif
@@ -0,0 +1,256 @@
+/**
+ * @file Mcal_Sim.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host simulation of the TM4C123GH6PM peripheral memory used by the MCAL drivers
+ * @version 0.1
+ * @date 2022-08-15
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ * @details Only used when the MCAL is built with MCAL_HOST_SIM defined, Mcal_Reg.h then routes every
+ *          register access of the drivers here. The model covers:
+ *          - GPIO ports A..F through both the APB and the AHB apertures, with DATA address masking,
+ *            input pins driven by the host, DEN gating of the inputs, LOCK/CR commit protection, exclusive
+ *            pull-up/pull-down (GPIOPUR/GPIOPDR) and edge/level interrupt detection (IS/IBE/IEV/IM/RIS/MIS/ICR).
+ *          - SYSCTL RCGC2/RCGCGPIO clock gating, PRGPIO readiness after a configurable delay and GPIOHBCTL.
+ *          - Timers 0..5 and wide timers 0..1 in periodic mode (GPTMSYNC included) with their counter value
+ *            and their timeout and match interrupts (IMR/RIS/MIS/ICR), the PWM mode output (TnPWML included)
+ *            driving the CCP pins selected with GPIOAFSEL/GPIOPCTL, the timer A/B uDMA requests of timers
+ *            0..2 and the GPIO DMA trigger (GPIODMACTL) of the ports, and the uDMA controller (basic and
+ *            ping-pong modes, one item per request) reading and writing RAM mapped with Mcal_Sim_MapMemory,
+ *            with the completion interrupts dispatched to the handlers of Mcal_Sim_SetIsr.
+ *          - The peripheral bit-band alias region.
+ *          - The DWT cycle counter (DEMCR.TRCENA, DWT_CTRL.CYCCNTENA, DWT_CYCCNT), counting the clocks advanced
+ *            plus 2 clocks per register access.
+ *          - Preemption: a hook called after every register access made with interrupts unmasked, so a test can
+ *            run "ISRs" between any load and the next store of the code under test.
+ *          - The local exclusive monitor of LDREX/STREX on registers and on host RAM words, cleared when the
+ *            preemption hook made an access.
+ *          - A count of the host instructions executed outside the model, on x86-64 Linux hosts.
+ *          - Plain memory for every other address.
+ *          Every load and store is counted per register address and stamped with a sequence number.
+ */
+
+#ifndef MCAL_SIM_H
+#define MCAL_SIM_H
+
+#include "../Std_types.h"
+
+/* Number of simulated GPIO ports (A..F) */
+#define MCAL_SIM_GPIO_PORTS            (6U)
+
+/**
+ * @brief Access statistics of the simulated peripheral memory.
+ * 
+ */
+typedef struct
+{
+    uint32 loads;                    // Register loads.
+    uint32 stores;                   // Register stores.
+    uint32 apb_accesses;             // GPIO accesses through the APB apertures.
+    uint32 ahb_accesses;             // GPIO accesses through the AHB apertures.
+    uint32 bitband_accesses;         // Accesses through the peripheral bit-band alias region.
+    uint32 wrong_aperture_accesses;  // GPIO accesses through the aperture not selected in GPIOHBCTL.
+    uint32 ungated_accesses;         // GPIO accesses to a port whose clock is off (bus fault on target).
+    uint32 locked_writes;            // GPIOCR writes dropped because GPIOLOCK was locked.
+    uint32 interrupt_masks;          // Interrupt masking requests (critical sections).
+    uint32 dma_transfers;            // Items moved by the uDMA, not counted in loads and stores.
+    uint32 dma_underruns;            // uDMA requests that found a stopped control structure.
+    uint32 clocks;                   // System clocks advanced by Mcal_Sim_AdvanceClock.
+    uint32 preemption_points;        // Calls of the preemption hook.
+    uint32 deferred_preemptions;     // Hook calls delayed to the end of a critical section.
+    uint32 exclusive_failures;       // Exclusive stores that failed because the monitor was lost.
+    uint32 sequence;                 // Sequence number of the last access, every load and store increments it.
+}Mcal_Sim_StatsType;
+
+/* Interrupt handler called by the simulation */
+typedef void (*Mcal_Sim_IsrType)(void);
+
+/* Pin watcher called by the simulation with the port and its pin levels before and after a change */
+typedef void (*Mcal_Sim_PinHookType)(uint8 Port, uint8 Before, uint8 After);
+
+/**
+ * @brief Resets the simulated peripherals, the counters and the statistics to their power-on state.
+ */
+void Mcal_Sim_Reset(void);
+
+/**
+ * @brief Simulated 32-bit register load.
+ * 
+ * @param [in] Address   Target address of the load.
+ * @return uint32        Value read.
+ */
+uint32 Mcal_Sim_Read32(uint32 Address);
+
+/**
+ * @brief Simulated 32-bit register store.
+ * 
+ * @param [in] Address   Target address of the store.
+ * @param [in] Value     Value written.
+ */
+void Mcal_Sim_Write32(uint32 Address, uint32 Value);
+
+/**
+ * @brief Simulated exclusive load (LDREX), arms the local exclusive monitor on Address.
+ * 
+ * @param [in] Address   Target address of the load.
+ * @return uint32        Value read.
+ */
+uint32 Mcal_Sim_ReadExclusive32(uint32 Address);
+
+/**
+ * @brief Simulated exclusive store (STREX), done only when the monitor is still armed on Address.
+ * 
+ * @details The monitor is cleared by every exclusive store and by a preemption hook call that made an access
+ *          (an exception taken between the load and the store). A failed store makes no access.
+ * 
+ * @param [in] Address   Target address of the store.
+ * @param [in] Value     Value written.
+ * @return uint32        0 when the value was stored, 1 when the monitor was lost.
+ */
+uint32 Mcal_Sim_WriteExclusive32(uint32 Address, uint32 Value);
+
+/**
+ * @brief Simulated exclusive load (LDREX) of a host RAM word, arms the local exclusive monitor on it.
+ * 
+ * @details The load is not counted as a register access, but the preemption hook is called after it.
+ * 
+ * @param [in] Word      Host RAM word.
+ * @return uint32        Value read.
+ */
+uint32 Mcal_Sim_ReadExclusiveWord(volatile uint32 * Word);
+
+/**
+ * @brief Simulated exclusive store (STREX) of a host RAM word, done only when the monitor is still armed on it.
+ * 
+ * @param [in] Word      Host RAM word.
+ * @param [in] Value     Value written.
+ * @return uint32        0 when the value was stored, 1 when the monitor was lost.
+ */
+uint32 Mcal_Sim_WriteExclusiveWord(volatile uint32 * Word, uint32 Value);
+
+/**
+ * @brief Drives the levels of the input pins of a simulated port.
+ * 
+ * @param [in] Port      Port ID (0 = PORTA .. 5 = PORTF).
+ * @param [in] Levels    Pin levels, only the pins configured as inputs are affected.
+ */
+void Mcal_Sim_SetInputs(uint8 Port, uint8 Levels);
+
+/**
+ * @brief Returns the levels driven by the output pins of a simulated port.
+ * 
+ * @param [in] Port      Port ID (0 = PORTA .. 5 = PORTF).
+ * @return uint8         Pin levels, the pins not configured as digital outputs read 0.
+ */
+uint8 Mcal_Sim_GetOutputs(uint8 Port);
+
+/**
+ * @brief Returns the pins of a simulated port with a pending unmasked interrupt (GPIOMIS).
+ * 
+ * @param [in] Port      Port ID (0 = PORTA .. 5 = PORTF).
+ * @return uint8         Pending pins, the host calls the port ISR while it is not 0.
+ */
+uint8 Mcal_Sim_GetPendingInterrupts(uint8 Port);
+
+/**
+ * @brief Sets how many PRGPIO reads a port needs after its clock is enabled before it reports ready.
+ * 
+ * @param [in] Reads     Number of PRGPIO reads.
+ */
+void Mcal_Sim_SetPrgpioDelay(uint32 Reads);
+
+/**
+ * @brief Returns the number of loads of the register at Address.
+ */
+uint32 Mcal_Sim_GetLoadCount(uint32 Address);
+
+/**
+ * @brief Returns the number of stores to the register at Address.
+ */
+uint32 Mcal_Sim_GetStoreCount(uint32 Address);
+
+/**
+ * @brief Returns the sequence number of the last store to the register at Address (0 if never written).
+ */
+uint32 Mcal_Sim_GetStoreStamp(uint32 Address);
+
+/**
+ * @brief Returns the access statistics since the last Mcal_Sim_Reset.
+ */
+const Mcal_Sim_StatsType * Mcal_Sim_GetStats(void);
+
+/**
+ * @brief Simulated interrupt masking, returns the previous mask state.
+ */
+uint32 Mcal_Sim_SuspendInterrupts(void);
+
+/**
+ * @brief Simulated interrupt unmasking, restores the mask state returned by Mcal_Sim_SuspendInterrupts.
+ */
+void Mcal_Sim_ResumeInterrupts(uint32 State);
+
+/**
+ * @brief Gives a simulated RAM address to a host object so the simulated uDMA can reach it.
+ * 
+ * @param [in] Host      Host object.
+ * @param [in] Size      Size of the object in bytes.
+ * @return uint32        Simulated address of the first byte of the object (an object inside an already mapped
+ *                       one gets the address inside that mapping).
+ */
+uint32 Mcal_Sim_MapMemory(const void * Host, uint32 Size);
+
+/**
+ * @brief Registers the handler called when interrupt Irq is raised and enabled in the NVIC.
+ */
+void Mcal_Sim_SetIsr(uint32 Irq, Mcal_Sim_IsrType Isr);
+
+/**
+ * @brief Registers the preemption hook, NULL_PTR removes it.
+ * 
+ * @details The hook is called after every register load and store, once the access is done. An access made
+ *          with interrupts masked does not call it, the call is made by the Mcal_Sim_ResumeInterrupts that
+ *          unmasks them, as a pending interrupt would be taken there. The hook may make accesses itself, it is
+ *          then called again from them (nested preemption), it has to bound the nesting.
+ */
+void Mcal_Sim_SetPreemptionHook(Mcal_Sim_IsrType Hook);
+
+/**
+ * @brief Registers the pin watcher, NULL_PTR removes it.
+ * 
+ * @details The watcher is called every time the levels of the pins of a port change, from a store, a host
+ *          input or a timer PWM output, before the uDMA request of a GPIO DMA trigger is served. It models the
+ *          devices wired to the pins, it must not access the simulated registers.
+ */
+void Mcal_Sim_SetPinHook(Mcal_Sim_PinHookType Hook);
+
+/**
+ * @brief Advances the simulated time by Clocks system clocks, running the timers, their interrupts and their uDMA requests.
+ */
+void Mcal_Sim_AdvanceClock(uint32 Clocks);
+
+/**
+ * @brief Starts counting the host instructions executed, by single-stepping them (x86-64 Linux hosts only).
+ * 
+ * @details The instructions of the register model (Mcal_Sim_Read32, Mcal_Sim_Write32 and the interrupt masking)
+ *          are not counted, only the few of the call to it. The count also takes the instructions of
+ *          Mcal_Sim_StartInstructionCount and Mcal_Sim_StopInstructionCount after and before the trap flag
+ *          changes, a bench subtracts the count of an empty start/stop pair.
+ */
+void Mcal_Sim_StartInstructionCount(void);
+
+/**
+ * @brief Stops counting the host instructions, returns the count since Mcal_Sim_StartInstructionCount (0 on
+ *        the hosts where they cannot be counted).
+ */
+uint32 Mcal_Sim_StopInstructionCount(void);
+
+/**
+ * @brief Pseudo random generator of the benches (linear congruential), one State per sequence.
+ * 
+ * @param [in,out] State Generator state, seeded by the caller and advanced by every call.
+ * @return uint32        24 random bits.
+ */
+uint32 Mcal_Sim_Random(uint32 * State);
+
+#endif /* MCAL_SIM_H */
@@ -0,0 +1,384 @@
+/**
+ * @file ParBus_Bench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark and check of the ParBus parallel bus master against the simulated GPIO, timer and uDMA
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details The data lanes and control lines of the shipped bus are first checked against Port_PBcfg.c: outputs
+ *          whose direction can change, none of them in the synchronous port write list of the DIO.
+ *          A display controller model watches the control port: on every latching strobe edge (WR rising for
+ *          8080, E falling for 6800) with CS low it records D/C and the data lanes, and counts the cycles seen
+ *          with the read line out of its write level. A command, a random pixel block and a fill are written
+ *          through the CPU services and a random block through the uDMA burst, on the 8080 bus, the same bus
+ *          in 6800 mode and a 16-bit variant (bits 8..15 on PA0..PA7, CPU services only); the model must see
+ *          exactly the words sent. The register accesses per byte and the host time are reported with the
+ *          bytes per second they give on the target at BENCH_ACCESS_CLOCKS clocks per register access and
+ *          BENCH_CALL_CLOCKS clocks per service call, next to a byte loop of Dio_WritePort and two
+ *          Dio_WriteChannel. The uDMA burst reports the simulated bus rate and the CPU load of its interrupts.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/ParBus_Bench.c Sim/Mcal_Sim.c ParBus/ParBus.c ParBus/ParBus_PBcfg.c
+ *              DIO/DIO.c DIO/Dio_PBcfg.c Port/Port.c Port/Port_PBcfg.c Det/Det.c -o ParBus_Bench && ./ParBus_Bench
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "ParBus/ParBus.h"
+#include "ParBus/ParBus_Private.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Bytes of the pixel block, of the fill and of the uDMA burst (several ping-pong chunks) */
+#define BENCH_BLOCK_BYTES              (4099U)
+#define BENCH_FILL_WORDS               (1001U)
+#define BENCH_DMA_BYTES                (5000U)
+#define BENCH_TIMED_BYTES              (1000000UL)
+
+/* Capacity of the cycles recorded by the display model */
+#define BENCH_LOG_SIZE                 (16384U)
+
+/* Assumed system clocks of one register access, of one service call and of one interrupt entry/exit on the target */
+#define BENCH_ACCESS_CLOCKS            (2U)
+#define BENCH_CALL_CLOCKS              (8U)
+#define BENCH_ISR_CLOCKS               (24U)
+
+/* Simulated clocks between two ParBus_GetStatus polls of the uDMA burst */
+#define BENCH_POLL_CLOCKS              (999U)
+
+/* Control lines of the bus on port C */
+#define BENCH_CS_PIN                   (0x10U)
+#define BENCH_DC_PIN                   (0x20U)
+#define BENCH_STROBE_PIN               (0x40U)
+#define BENCH_READ_PIN                 (0x80U)
+
+/* Bits 8..15 of the 16-bit variant, in place of the mux select group of the bench DIO configuration set */
+STATIC const Dio_ChannelGroupType Bench_HighLane = DIO_CHANNEL_GROUP_DESC(PORTA, 0xFFU, 0U);
+#define BENCH_HIGH_LANE_GROUP          DioConf_MUX_SELECT_GROUP_INDEX
+
+STATIC Dio_ConfigType Bench_DioConfig;
+STATIC ParBus_ConfigType Bench_Config;
+STATIC ParBus_ProtocolType Bench_Protocol = PARBUS_8080;
+STATIC boolean Bench_Wide = FALSE;
+STATIC uint16 Bench_LogWord[BENCH_LOG_SIZE];
+STATIC uint8 Bench_LogDc[BENCH_LOG_SIZE];
+STATIC uint32 Bench_LogCount = 0U;
+STATIC uint32 Bench_ReadErrors = 0U;
+STATIC uint32 Bench_IsrCount = 0U;
+STATIC uint8 Bench_Block[BENCH_DMA_BYTES];
+STATIC uint16 Bench_WideBlock[BENCH_BLOCK_BYTES];
+STATIC uint32 Bench_Random = 12345U;
+
+/* Display controller model: records the cycles latched by the strobe edges of port C */
+STATIC void Bench_PinHook(uint8 Port, uint8 Before, uint8 After)
+{
+    boolean Latch;
+
+    if (Port != PORTC)
+    {
+        return;
+    }
+    Latch = (Bench_Protocol == PARBUS_8080) ? (((~Before & After) & BENCH_STROBE_PIN) != 0U)
+                                            : (((Before & ~After) & BENCH_STROBE_PIN) != 0U);
+    if ((Latch == FALSE) || ((After & BENCH_CS_PIN) != 0U))
+    {
+        return;
+    }
+    if (((After & BENCH_READ_PIN) != 0U) != (Bench_Protocol == PARBUS_8080))
+    {
+        Bench_ReadErrors++;
+    }
+    if (Bench_LogCount < BENCH_LOG_SIZE)
+    {
+        uint16 Word = Mcal_Sim_GetOutputs(PORTB);
+        if (Bench_Wide == TRUE)
+        {
+            Word |= (uint16)((uint16)Mcal_Sim_GetOutputs(PORTA) << 8U);
+        }
+        Bench_LogWord[Bench_LogCount] = Word;
+        Bench_LogDc[Bench_LogCount] = ((After & BENCH_DC_PIN) != 0U) ? 1U : 0U;
+    }
+    Bench_LogCount++;
+}
+
+/* GPIO port C interrupt: uDMA completions of the burst */
+STATIC void Bench_Isr(void)
+{
+    Bench_IsrCount++;
+    ParBus_Dma_Isr();
+}
+
+/* Wrong cycles among the Count recorded from First: D/C must be Dc and the word the one of Words (or Fill) */
+STATIC uint32 Bench_Check(uint32 First, uint32 Count, uint8 Dc, const uint8 * Bytes, const uint16 * Words, uint16 Fill)
+{
+    uint32 Errors = 0U;
+    uint32 Index;
+
+    if (Bench_LogCount < (First + Count))
+    {
+        return (First + Count) - Bench_LogCount;
+    }
+    for (Index = 0U; Index < Count; Index++)
+    {
+        uint16 Expected = (Bytes != NULL_PTR) ? Bytes[Index] : ((Words != NULL_PTR) ? Words[Index] : Fill);
+        if ((Bench_LogDc[First + Index] != Dc) || (Bench_LogWord[First + Index] != Expected))
+        {
+            Errors++;
+        }
+    }
+    return Errors;
+}
+
+/* Prints the accesses per byte, the host time and the estimated target rate of one way of writing bytes */
+STATIC void Bench_Report(const char * Name, uint32 Accesses, uint32 Calls, uint32 Bytes, clock_t Clocks)
+{
+    double AccessesPerByte = (double)Accesses / Bytes;
+    double ClocksPerByte = (AccessesPerByte * BENCH_ACCESS_CLOCKS) + (((double)Calls / Bytes) * BENCH_CALL_CLOCKS);
+    printf("%-36s %5.2f accesses/byte %6.1f ns/byte  %8.0f kB/s\n", Name, AccessesPerByte,
+           1.0e9 * (double)Clocks / CLOCKS_PER_SEC / Bytes, (double)PARBUS_SYSTEM_CLOCK_HZ / ClocksPerByte / 1000.0);
+}
+
+/* Board setup, DIO without the output shadow on the bus ports, and ParBus with Bench_Config */
+STATIC void Bench_Setup(ParBus_ProtocolType Protocol, boolean Wide)
+{
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Bench_DioConfig = Dio_Configuration;
+    if (Wide == TRUE)
+    {
+        /* Board variant with the high lanes on PORTA as outputs, written by the bus only */
+        MCAL_REG_WRITE32(DIO_GPIO_PORTA_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0xFFU);
+        Bench_DioConfig.ShadowPins[PORTA] = 0x00U;
+        Bench_DioConfig.Groups[BENCH_HIGH_LANE_GROUP] = Bench_HighLane;
+    }
+    Dio_Init(&Bench_DioConfig);
+
+    Bench_Config = ParBus_Configuration;
+    Bench_Config.Buses[ParBusConf_TFT_BUS].protocol = Protocol;
+    Bench_Config.Buses[ParBusConf_TFT_BUS].data[1] = (Wide == TRUE) ? BENCH_HIGH_LANE_GROUP : PARBUS_NO_GROUP;
+    Bench_Protocol = Protocol;
+    Bench_Wide = Wide;
+    Bench_LogCount = 0U;
+    Bench_ReadErrors = 0U;
+    Mcal_Sim_SetPinHook(Bench_PinHook);
+    Mcal_Sim_SetIsr(PARBUS_GPIO_IRQ(PORTC), Bench_Isr);
+    ParBus_Init(&Bench_Config);
+}
+
+/* The data lanes and control lines of the shipped bus must be outputs whose direction can change (read back) in
+   Port_PBcfg.c and stay out of the synchronous port write list, returns the number of wrong pins */
+STATIC uint32 Bench_CheckPins(void)
+{
+    const ParBus_BusConfigType * Bus = &ParBus_Configuration.Buses[ParBusConf_TFT_BUS];
+    const Dio_ChannelGroupType * Lanes = &Dio_Configuration.Groups[Bus->data[0]];
+    const Dio_ChannelType Lines[4] = { Bus->strobe, Bus->read, Bus->dc, Bus->cs };
+    uint8 Pins[DIO_CONFIGURED_PORTS] = { 0U };
+    uint32 Errors = 0U;
+    uint32 Found = 0U;
+    uint32 Expected = 0U;
+    uint8 Index;
+
+    Pins[Lanes->port] |= Lanes->mask;
+    for (Index = 0U; Index < 4U; Index++)
+    {
+        if (Lines[Index] != PARBUS_NO_CHANNEL)
+        {
+            Pins[Dio_Configuration.Channels[Lines[Index]].port] |= Dio_Configuration.Channels[Lines[Index]].mask;
+        }
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_PORTS; Index++)
+    {
+        uint8 Pin;
+        for (Pin = 0U; Pin < 8U; Pin++)
+        {
+            Expected += ((Pins[Index] >> Pin) & 1U);
+        }
+    }
+    for (Index = 0U; Index < PORT_CONFIGURED_PINS; Index++)
+    {
+        const Port_ConfigChannel * Channel = &Port_Configuration.Channels[Index];
+        if ((Pins[Channel->port_num] & (1U << Channel->pin_num)) != 0U)
+        {
+            Found++;
+            Errors += ((Channel->direction != PORT_PIN_OUT) || (Channel->pin_direction_changeable != STD_ON)) ? 1U : 0U;
+        }
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+    {
+        const Dio_PortWriteType * Entry = &Dio_Configuration.SyncPortWrites[Index];
+        Errors += ((Pins[Entry->port] & Entry->mask) != 0U) ? 1U : 0U;
+    }
+    Errors += (Found != Expected) ? 1U : 0U;
+    printf("%lu bus pins configured, %lu wrong\n", (unsigned long)Found, (unsigned long)Errors);
+    return Errors;
+}
+
+/* Command, pixel block and fill through the CPU services, returns the number of wrong cycles */
+STATIC uint32 Bench_CpuRun(void)
+{
+    uint32 Errors = 0U;
+    uint32 Index;
+
+    for (Index = 0U; Index < BENCH_BLOCK_BYTES; Index++)
+    {
+        Bench_Block[Index] = (uint8)Mcal_Sim_Random(&Bench_Random);
+        Bench_WideBlock[Index] = (uint16)Mcal_Sim_Random(&Bench_Random);
+    }
+    Errors += (ParBus_WriteCommand(ParBusConf_TFT_BUS, 0x2C5AU) != E_OK) ? 1U : 0U;
+    if (Bench_Wide == TRUE)
+    {
+        Errors += (ParBus_WriteBurst(ParBusConf_TFT_BUS, Bench_WideBlock, BENCH_BLOCK_BYTES) != E_OK) ? 1U : 0U;
+    }
+    else
+    {
+        Errors += (ParBus_WriteBurst(ParBusConf_TFT_BUS, Bench_Block, BENCH_BLOCK_BYTES) != E_OK) ? 1U : 0U;
+    }
+    Errors += (ParBus_Fill(ParBusConf_TFT_BUS, 0xF81FU, BENCH_FILL_WORDS) != E_OK) ? 1U : 0U;
+
+    Errors += Bench_Check(0U, 1U, 0U, NULL_PTR, NULL_PTR, (Bench_Wide == TRUE) ? 0x2C5AU : 0x5AU);
+    Errors += Bench_Check(1U, BENCH_BLOCK_BYTES, 1U, (Bench_Wide == TRUE) ? NULL_PTR : Bench_Block,
+                          (Bench_Wide == TRUE) ? Bench_WideBlock : NULL_PTR, 0U);
+    Errors += Bench_Check(1U + BENCH_BLOCK_BYTES, BENCH_FILL_WORDS, 1U, NULL_PTR, NULL_PTR,
+                          (Bench_Wide == TRUE) ? 0xF81FU : 0x1FU);
+    Errors += (Bench_LogCount != (1U + BENCH_BLOCK_BYTES + BENCH_FILL_WORDS)) ? 1U : 0U;
+    return Errors;
+}
+
+/* Random block through the uDMA burst, returns the number of wrong cycles */
+STATIC uint32 Bench_DmaRun(boolean Report)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Errors = 0U;
+    uint32 First = Bench_LogCount;
+    uint32 Underruns = Stats->dma_underruns;
+    uint32 Isrs = Bench_IsrCount;
+    uint32 Clocks = Stats->clocks;
+    uint32 Accesses;
+    uint32 Polls = 0U;
+    uint32 Index;
+
+    for (Index = 0U; Index < BENCH_DMA_BYTES; Index++)
+    {
+        Bench_Block[Index] = (uint8)Mcal_Sim_Random(&Bench_Random);
+    }
+    Accesses = Stats->loads + Stats->stores;
+    Errors += (ParBus_WriteBurstDma(ParBusConf_TFT_BUS, Bench_Block, BENCH_DMA_BYTES) != E_OK) ? 1U : 0U;
+    Errors += (ParBus_WriteCommand(ParBusConf_TFT_BUS, 0x00U) != E_NOT_OK) ? 1U : 0U;
+    while ((ParBus_GetStatus(ParBusConf_TFT_BUS) == PARBUS_BUSY) && (Polls < (BENCH_DMA_BYTES * 2U)))
+    {
+        Mcal_Sim_AdvanceClock(BENCH_POLL_CLOCKS);
+        Polls++;
+    }
+    Clocks = Stats->clocks - Clocks;
+    Accesses = Stats->loads + Stats->stores - Accesses;
+    Isrs = Bench_IsrCount - Isrs;
+
+    /* No strobe pulse after the last byte */
+    Mcal_Sim_AdvanceClock(BENCH_POLL_CLOCKS);
+    Errors += Bench_Check(First, BENCH_DMA_BYTES, 1U, Bench_Block, NULL_PTR, 0U);
+    Errors += (Bench_LogCount != (First + BENCH_DMA_BYTES)) ? 1U : 0U;
+    Errors += (Stats->dma_underruns != Underruns) ? 1U : 0U;
+    Errors += ((Mcal_Sim_GetOutputs(PORTC) & BENCH_CS_PIN) == 0U) ? 1U : 0U;
+    if (Report == TRUE)
+    {
+        printf("%-36s %5.2f accesses/byte %4lu ISRs  %8.0f kB/s bus (polled every %u clocks), %4.2f %% CPU\n",
+               "ParBus_WriteBurstDma", (double)Accesses / BENCH_DMA_BYTES, (unsigned long)Isrs,
+               (double)PARBUS_SYSTEM_CLOCK_HZ * BENCH_DMA_BYTES / Clocks / 1000.0, BENCH_POLL_CLOCKS,
+               100.0 * (((double)Isrs * BENCH_ISR_CLOCKS) + ((double)Accesses * BENCH_ACCESS_CLOCKS)) / Clocks);
+    }
+    return Errors;
+}
+
+/* Timed byte loops of the CPU services and of the DIO services, returns the number of wrong cycles */
+STATIC uint32 Bench_Timing(void)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Errors = 0U;
+    uint32 Accesses;
+    uint32 Count;
+    uint32 Index;
+    clock_t Start;
+
+    /* The display model is not needed for the timing */
+    Mcal_Sim_SetPinHook(NULL_PTR);
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    for (Count = 0U; Count < (BENCH_TIMED_BYTES / BENCH_BLOCK_BYTES); Count++)
+    {
+        (void)ParBus_WriteBurst(ParBusConf_TFT_BUS, Bench_Block, BENCH_BLOCK_BYTES);
+    }
+    Bench_Report("ParBus_WriteBurst", Stats->loads + Stats->stores - Accesses, Count,
+                 Count * BENCH_BLOCK_BYTES, clock() - Start);
+
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    for (Count = 0U; Count < (BENCH_TIMED_BYTES / BENCH_BLOCK_BYTES); Count++)
+    {
+        (void)ParBus_Fill(ParBusConf_TFT_BUS, 0x00U, BENCH_BLOCK_BYTES);
+    }
+    Bench_Report("ParBus_Fill", Stats->loads + Stats->stores - Accesses, Count, Count * BENCH_BLOCK_BYTES,
+                 clock() - Start);
+
+    /* Byte loop through the DIO services, checked by the display model */
+    Mcal_Sim_SetPinHook(Bench_PinHook);
+    Bench_LogCount = 0U;
+    Accesses = Stats->loads + Stats->stores;
+    Start = clock();
+    Dio_WriteChannel(DioConf_TFT_CS_CHANNEL_ID, STD_LOW);
+    for (Index = 0U; Index < BENCH_BLOCK_BYTES; Index++)
+    {
+        Dio_WritePort(PORTB, Bench_Block[Index]);
+        Dio_WriteChannel(DioConf_TFT_WR_CHANNEL_ID, STD_LOW);
+        Dio_WriteChannel(DioConf_TFT_WR_CHANNEL_ID, STD_HIGH);
+    }
+    Dio_WriteChannel(DioConf_TFT_CS_CHANNEL_ID, STD_HIGH);
+    Bench_Report("Dio_WritePort + 2 x Dio_WriteChannel", Stats->loads + Stats->stores - Accesses,
+                 (3U * BENCH_BLOCK_BYTES) + 2U, BENCH_BLOCK_BYTES, clock() - Start);
+    Errors += Bench_Check(0U, BENCH_BLOCK_BYTES, 1U, Bench_Block, NULL_PTR, 0U);
+    return Errors;
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+    uint32 RunErrors;
+
+    printf("%u clocks per register access, %u per service call, %u per interrupt entry/exit, strobe period %u clocks\n",
+           BENCH_ACCESS_CLOCKS, BENCH_CALL_CLOCKS, BENCH_ISR_CLOCKS, PARBUS_DMA_STROBE_PERIOD_CLOCKS);
+
+    Errors += Bench_CheckPins();
+
+    /* 8080 bus */
+    Bench_Setup(PARBUS_8080, FALSE);
+    RunErrors = Bench_CpuRun();
+    RunErrors += Bench_DmaRun(TRUE);
+    RunErrors += Bench_Timing();
+    RunErrors += Bench_ReadErrors;
+    RunErrors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+    printf("8080 8-bit                           %lu errors\n", (unsigned long)RunErrors);
+    Errors += RunErrors;
+
+    /* Same bus in 6800 mode, E on the same pin */
+    Bench_Setup(PARBUS_6800, FALSE);
+    RunErrors = Bench_CpuRun();
+    RunErrors += Bench_DmaRun(FALSE);
+    RunErrors += Bench_DmaRun(FALSE);
+    RunErrors += Bench_ReadErrors;
+    printf("6800 8-bit                           %lu errors\n", (unsigned long)RunErrors);
+    Errors += RunErrors;
+
+    /* 16-bit 8080 bus: no uDMA burst */
+    Bench_Setup(PARBUS_8080, TRUE);
+    RunErrors = Bench_CpuRun();
+    RunErrors += (ParBus_WriteBurstDma(ParBusConf_TFT_BUS, Bench_Block, 16U) != E_NOT_OK) ? 1U : 0U;
+    RunErrors += Bench_ReadErrors;
+    printf("8080 16-bit                          %lu errors\n", (unsigned long)RunErrors);
+    Errors += RunErrors;
+
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
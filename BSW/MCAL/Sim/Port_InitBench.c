@@ -0,0 +1,320 @@
+/**
+ * @file Port_InitBench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark and check of the per-port register images of Port_Init against the simulated GPIO registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Port_Init is compared with the per-pin read-modify-write initialization it replaced, kept here as the
+ *          reference. Both run from the same random register contents on the shipped configuration and on random
+ *          ones (directions, modes, resistors, initial levels), and must leave the same DIR, PUR, PDR, AMSEL, PCTL,
+ *          AFSEL, DEN, CR and pin levels on every port. Port_Init must also store to each of these registers once
+ *          per port and leave the clocks of exactly the used ports on (PORT_GATE_UNUSED_PORTS), from a cold boot
+ *          and from all the clocks on, also with a configuration that does not use port E. The register loads and
+ *          stores of both are reported, with the boot time they take at BENCH_ACCESS_CLOCKS clocks per APB access
+ *          at 16 MHz.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/Port_InitBench.c Sim/Mcal_Sim.c Port/Port.c Port/Port_PBcfg.c Det/Det.c
+ *              -o Port_InitBench && ./Port_InitBench
+ */
+
+#include <stdio.h>
+#include "Port/Port.h"
+#include "Port/Port_Private.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Number of random configurations */
+#define BENCH_CONFIGURATIONS           (1000U)
+
+/* Assumed system clocks of one APB register access */
+#define BENCH_ACCESS_CLOCKS            (2U)
+#define BENCH_SYSTEM_CLOCK_MHZ         (16U)
+
+/* Registers compared and expected to be stored once per port */
+#define BENCH_REGISTERS                (7U)
+
+STATIC const uint32 Bench_Bases[PORT_NUMBER_OF_PORTS] =
+{
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+STATIC const uint32 Bench_Registers[BENCH_REGISTERS] =
+{
+    PORT_DIR_REG_OFFSET, PORT_PULL_UP_REG_OFFSET, PORT_PULL_DOWN_REG_OFFSET, PORT_ANALOG_MODE_SEL_REG_OFFSET,
+    PORT_CTL_REG_OFFSET, PORT_ALT_FUNC_REG_OFFSET, PORT_DIGITAL_ENABLE_REG_OFFSET
+};
+
+/* Pin modes of the random configurations */
+STATIC const Port_PinModeType Bench_Modes[] = { DIO, DIO, DIO, ADC, UART, SSI, GPT, PWM1 };
+
+/* Register contents of every port after an initialization */
+typedef struct
+{
+    uint32 Registers[PORT_NUMBER_OF_PORTS][BENCH_REGISTERS];
+    uint32 Commit[PORT_NUMBER_OF_PORTS];
+    uint8 Levels[PORT_NUMBER_OF_PORTS];
+}Bench_SnapshotType;
+
+STATIC uint32 Bench_Random = 12345U;
+
+/* Reference: the per-pin read-modify-write initialization Port_Init did before the register images */
+STATIC void Bench_PerPinInit(const Port_ConfigChannel * Channels)
+{
+    uint8 PinIndex;
+    for (PinIndex = 0U; PinIndex < PORT_CONFIGURED_PINS; PinIndex++)
+    {
+        const Port_ConfigChannel * Channel = &Channels[PinIndex];
+        uint32 Port_Base = Bench_Bases[Channel->port_num];
+        uint32 Pin = Channel->pin_num;
+
+        if (0 == (MCAL_REG_READ32(RCGC2_REGISTER_ADDRESS) & (1 << Channel->port_num)))
+        {
+            MCAL_REG_WRITE32(RCGC2_REGISTER_ADDRESS, MCAL_REG_READ32(RCGC2_REGISTER_ADDRESS) | (1 << Channel->port_num));
+            while (0 == (MCAL_REG_READ32(PRGPIO_REGISTER_ADDRESS) & (1 << Channel->port_num)));
+        }
+        if (((Channel->port_num == PORTD) && (Pin == PIN7)) || ((Channel->port_num == PORTF) && (Pin == PIN0)))
+        {
+            PORT_WRITE_REG(Port_Base, PORT_LOCK_REG_OFFSET, GPIO_LOCK_KEY);
+            PORT_SET_REG_BIT(Port_Base, PORT_COMMIT_REG_OFFSET, Pin);
+        }
+        if (Channel->direction == PORT_PIN_IN)
+        {
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_DIR_REG_OFFSET, Pin);
+        }
+        else
+        {
+            PORT_SET_REG_BIT(Port_Base, PORT_DIR_REG_OFFSET, Pin);
+        }
+        if (Channel->resistor == PULL_UP)
+        {
+            PORT_SET_REG_BIT(Port_Base, PORT_PULL_UP_REG_OFFSET, Pin);
+        }
+        else if (Channel->resistor == PULL_DOWN)
+        {
+            PORT_SET_REG_BIT(Port_Base, PORT_PULL_DOWN_REG_OFFSET, Pin);
+        }
+        else
+        {
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_PULL_UP_REG_OFFSET, Pin);
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_PULL_DOWN_REG_OFFSET, Pin);
+        }
+        if (Channel->pin_mode == DIO)
+        {
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Pin);
+            PORT_WRITE_REG(Port_Base, PORT_CTL_REG_OFFSET, PORT_READ_REG(Port_Base, PORT_CTL_REG_OFFSET) & ~(BYTE_MASK << (Pin * 4)));
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Pin);
+            PORT_SET_REG_BIT(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Pin);
+        }
+        else if (Channel->pin_mode == ADC)
+        {
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Pin);
+            PORT_WRITE_REG(Port_Base, PORT_CTL_REG_OFFSET, PORT_READ_REG(Port_Base, PORT_CTL_REG_OFFSET) & ~(BYTE_MASK << (Pin * 4)));
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Pin);
+            PORT_SET_REG_BIT(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Pin);
+        }
+        else
+        {
+            PORT_CLEAR_REG_BIT(Port_Base, PORT_ANALOG_MODE_SEL_REG_OFFSET, Pin);
+            PORT_SET_REG_BIT(Port_Base, PORT_DIGITAL_ENABLE_REG_OFFSET, Pin);
+            PORT_SET_REG_BIT(Port_Base, PORT_ALT_FUNC_REG_OFFSET, Pin);
+            PORT_WRITE_REG(Port_Base, PORT_CTL_REG_OFFSET, (PORT_READ_REG(Port_Base, PORT_CTL_REG_OFFSET) & ~(BYTE_MASK << (Pin * 4))) | (Channel->pin_mode << (Pin * 4)));
+        }
+        if (Channel->direction == PORT_PIN_OUT)
+        {
+            if ((Channel->initial_value & BIT_MASK) == STD_HIGH)
+            {
+                PORT_SET_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Pin);
+            }
+            else
+            {
+                PORT_CLEAR_REG_BIT(Port_Base, PORT_DATA_REG_OFFSET, Pin);
+            }
+        }
+    }
+}
+
+/* Resets the simulation, enables the port clocks Clocks and fills the registers of every port with the contents drawn from Seed */
+STATIC void Bench_Prepare(uint32 Seed, uint32 Clocks)
+{
+    uint32 Random = Bench_Random;
+    uint8 Port;
+    uint8 Index;
+
+    Mcal_Sim_Reset();
+    MCAL_REG_WRITE32(RCGCGPIO_REGISTER_ADDRESS, Clocks);
+    Bench_Random = Seed;
+    for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        for (Index = 0U; Index < BENCH_REGISTERS; Index++)
+        {
+            uint32 Value = (Bench_Registers[Index] == PORT_CTL_REG_OFFSET) ? ((Mcal_Sim_Random(&Bench_Random) << 8U) ^ Mcal_Sim_Random(&Bench_Random)) : (Mcal_Sim_Random(&Bench_Random) & 0xFFU);
+            PORT_WRITE_REG(Bench_Bases[Port], Bench_Registers[Index], Value);
+        }
+        PORT_WRITE_REG(Bench_Bases[Port], PORT_DATA_REG_OFFSET, Mcal_Sim_Random(&Bench_Random));
+    }
+    Bench_Random = Random;
+}
+
+/* Register contents and pin levels of every port */
+STATIC void Bench_Snapshot(Bench_SnapshotType * Snapshot)
+{
+    uint8 Port;
+    uint8 Index;
+    for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        for (Index = 0U; Index < BENCH_REGISTERS; Index++)
+        {
+            Snapshot->Registers[Port][Index] = PORT_READ_REG(Bench_Bases[Port], Bench_Registers[Index]);
+        }
+        Snapshot->Commit[Port] = PORT_READ_REG(Bench_Bases[Port], PORT_COMMIT_REG_OFFSET);
+        Snapshot->Levels[Port] = Mcal_Sim_GetOutputs(Port);
+    }
+}
+
+/* Number of registers of Port_Init not stored exactly once on the Used ports */
+STATIC uint32 Bench_CountStores(uint32 Used, const uint32 Before[PORT_NUMBER_OF_PORTS][BENCH_REGISTERS])
+{
+    uint32 Errors = 0U;
+    uint8 Port;
+    uint8 Index;
+
+    for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        for (Index = 0U; Index < BENCH_REGISTERS; Index++)
+        {
+            uint32 Stores = Mcal_Sim_GetStoreCount(Bench_Bases[Port] + Bench_Registers[Index]) - Before[Port][Index];
+            Errors += (Stores != (((Used >> Port) & 1U) != 0U ? 1U : 0U)) ? 1U : 0U;
+        }
+    }
+    return Errors;
+}
+
+/*
+ * Runs the reference and Port_Init on Config from the port clocks Clocks and the register contents drawn from Seed,
+ * adds their accesses to Reference/Images and returns the number of differences.
+ */
+STATIC uint32 Bench_Compare(const Port_ConfigType * Config, uint32 Seed, uint32 Clocks, uint32 Reference[2], uint32 Images[2])
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    Bench_SnapshotType Expected;
+    Bench_SnapshotType Actual;
+    uint32 Before[PORT_NUMBER_OF_PORTS][BENCH_REGISTERS];
+    uint32 Loads;
+    uint32 Stores;
+    uint32 Ungated;
+    uint32 Used = 0U;
+    uint32 Errors = 0U;
+    uint8 Port;
+    uint8 Index;
+
+    for (Index = 0U; Index < PORT_CONFIGURED_PINS; Index++)
+    {
+        Used |= 1UL << Config->Channels[Index].port_num;
+    }
+    Bench_Prepare(Seed, Clocks);
+    Loads = Stats->loads;
+    Stores = Stats->stores;
+    Bench_PerPinInit(Config->Channels);
+    Reference[0] += Stats->loads - Loads;
+    Reference[1] += Stats->stores - Stores;
+    Bench_Snapshot(&Expected);
+
+    Bench_Prepare(Seed, Clocks);
+    for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        for (Index = 0U; Index < BENCH_REGISTERS; Index++)
+        {
+            Before[Port][Index] = Mcal_Sim_GetStoreCount(Bench_Bases[Port] + Bench_Registers[Index]);
+        }
+    }
+    Loads = Stats->loads;
+    Stores = Stats->stores;
+    Ungated = Stats->ungated_accesses;
+    Port_Init(Config);
+    Images[0] += Stats->loads - Loads;
+    Images[1] += Stats->stores - Stores;
+    Errors += Bench_CountStores(Used, Before);
+#if (PORT_GATE_UNUSED_PORTS == STD_ON)
+    Errors += ((MCAL_REG_READ32(RCGCGPIO_REGISTER_ADDRESS) & 0x3FU) != Used) ? 1U : 0U;
+#else
+    Errors += ((MCAL_REG_READ32(RCGCGPIO_REGISTER_ADDRESS) & 0x3FU) != (Used | Clocks)) ? 1U : 0U;
+#endif
+    Errors += Stats->ungated_accesses - Ungated;
+    Bench_Snapshot(&Actual);
+
+    for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        for (Index = 0U; Index < BENCH_REGISTERS; Index++)
+        {
+            Errors += (Expected.Registers[Port][Index] != Actual.Registers[Port][Index]) ? 1U : 0U;
+        }
+        Errors += (Expected.Commit[Port] != Actual.Commit[Port]) ? 1U : 0U;
+        Errors += (Expected.Levels[Port] != Actual.Levels[Port]) ? 1U : 0U;
+    }
+    return Errors;
+}
+
+/* Prints the accesses of one way of initializing the ports, averaged over Runs runs */
+STATIC void Bench_Report(const char * Name, const uint32 Accesses[2], uint32 Runs)
+{
+    double Loads = (double)Accesses[0] / Runs;
+    double Stores = (double)Accesses[1] / Runs;
+    printf("%-24s %7.1f loads %7.1f stores %7.1f accesses %6.1f us\n", Name, Loads, Stores, Loads + Stores,
+           (Loads + Stores) * BENCH_ACCESS_CLOCKS / BENCH_SYSTEM_CLOCK_MHZ);
+}
+
+int main(void)
+{
+    Port_ConfigType Config = Port_Configuration;
+    uint32 Reference[2] = { 0U, 0U };
+    uint32 Images[2] = { 0U, 0U };
+    uint32 Errors;
+    uint32 Run;
+    uint8 Index;
+
+    /* The shipped configuration from a cold boot */
+    Errors = Bench_Compare(&Port_Configuration, 1U, 0U, Reference, Images);
+    printf("Port_Configuration, %u pins, %u clocks per access at %u MHz\n", (unsigned)PORT_CONFIGURED_PINS,
+           BENCH_ACCESS_CLOCKS, BENCH_SYSTEM_CLOCK_MHZ);
+    Bench_Report("per-pin read-modify-write", Reference, 1U);
+    Bench_Report("per-port images", Images, 1U);
+
+    /* Port E pins replaced by copies of the PA0..PA5 ones: port E must end gated off */
+    for (Index = 0U; Index < PORT_CONFIGURED_PINS; Index++)
+    {
+        if (Config.Channels[Index].port_num == PORTE)
+        {
+            Config.Channels[Index] = Config.Channels[Config.Channels[Index].pin_num];
+        }
+    }
+    Errors += Bench_Compare(&Config, 2U, 0x3FU, Reference, Images);
+    Errors += Bench_Compare(&Config, 3U, 0U, Reference, Images);
+
+    /* Random configurations of the shipped pins */
+    Config = Port_Configuration;
+    Reference[0] = 0U;
+    Reference[1] = 0U;
+    Images[0] = 0U;
+    Images[1] = 0U;
+    for (Run = 0U; Run < BENCH_CONFIGURATIONS; Run++)
+    {
+        for (Index = 0U; Index < PORT_CONFIGURED_PINS; Index++)
+        {
+            Port_ConfigChannel * Channel = &Config.Channels[Index];
+            Channel->direction = ((Mcal_Sim_Random(&Bench_Random) & 1U) != 0U) ? PORT_PIN_OUT : PORT_PIN_IN;
+            Channel->pin_mode = Bench_Modes[Mcal_Sim_Random(&Bench_Random) % (sizeof(Bench_Modes) / sizeof(Bench_Modes[0]))];
+            Channel->resistor = (Port_InternalResistor)(Mcal_Sim_Random(&Bench_Random) % 3U);
+            Channel->initial_value = (uint8)(Mcal_Sim_Random(&Bench_Random) & 1U);
+        }
+        Errors += Bench_Compare(&Config, Mcal_Sim_Random(&Bench_Random), ((Run & 1U) != 0U) ? 0x3FU : 0U, Reference, Images);
+    }
+    printf("%u random configurations\n", BENCH_CONFIGURATIONS);
+    Bench_Report("per-pin read-modify-write", Reference, BENCH_CONFIGURATIONS);
+    Bench_Report("per-port images", Images, BENCH_CONFIGURATIONS);
+
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
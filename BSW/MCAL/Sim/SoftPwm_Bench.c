@@ -0,0 +1,277 @@
+/**
+ * @file SoftPwm_Bench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host benchmark and check of the SoftPwm edge scheduler against the simulated timer and GPIO registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details The channels of the shipped configuration must be outputs of Port_PBcfg.c on pins that no DIO group,
+ *          synchronous list entry, virtual port or channel of another module uses, and run first. Then, on a
+ *          board variant with every pin of a pool as an output, 4 to 32 channels run with random duties that change at a random step of every period. Every pin is
+ *          sampled in the middle of every duty step and must show the duty of the period it is in: the duty
+ *          set before the period start, never a mix of the old and the new one. The interrupts and register
+ *          accesses per period are reported with the CPU load they give at BENCH_ISR_CLOCKS clocks of
+ *          interrupt entry/exit and BENCH_ACCESS_CLOCKS clocks per register access, next to the interrupts a
+ *          scheduler taking one interrupt per channel edge would need. A last run uses only 4 duty values on
+ *          32 channels to show the merged edge groups.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/SoftPwm_Bench.c Sim/Mcal_Sim.c SoftPwm/SoftPwm.c SoftPwm/SoftPwm_PBcfg.c
+ *              DIO/DIO.c DIO/Dio_PBcfg.c Port/Port.c Port/Port_PBcfg.c Det/Det.c -o SoftPwm_Bench && ./SoftPwm_Bench
+ */
+
+#include <stdio.h>
+#include "DIO/DIO.h"
+#include "DIO/DIO_Private.h"
+#include "Port/Port.h"
+#include "SoftPwm/SoftPwm.h"
+#include "SoftPwm/SoftPwm_Private.h"
+#include "Sim/Mcal_Sim.h"
+
+/* 200 Hz period of 100 duty steps at 16 MHz */
+#define BENCH_RESOLUTION               (100U)
+#define BENCH_PERIOD_CLOCKS            (80000UL)
+#define BENCH_STEP_CLOCKS              (BENCH_PERIOD_CLOCKS / BENCH_RESOLUTION)
+#define BENCH_PERIODS                  (500U)
+
+/* Assumed system clocks of one interrupt entry and exit, and of one register access, on the target */
+#define BENCH_ISR_CLOCKS               (24U)
+#define BENCH_ACCESS_CLOCKS            (2U)
+
+/* Register accesses of one interrupt of a scheduler taking one interrupt per channel edge:
+   status read, clear, match move and the pin store */
+#define BENCH_EDGE_ISR_ACCESSES        (4U)
+
+/* DIO channels available to the benchmark: PA0..PB7, PC4..PD6, PE0..PE4 */
+STATIC const Dio_ChannelType Bench_Pool[SOFTPWM_MAX_CHANNELS] =
+{
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U,
+    20U, 21U, 22U, 23U, 24U, 25U, 26U, 27U, 28U, 29U, 30U, 32U, 33U, 34U, 35U, 36U
+};
+
+/* Channels of the other modules built on DIO: LED1, SW1, SoftSerial and the ParBus control lines */
+STATIC const Dio_ChannelType Bench_OtherChannels[] =
+{
+    DioConf_LED1_CHANNEL_ID, DioConf_SW1_CHANNEL_ID, DioConf_SOFT_SPI_SCK_CHANNEL_ID, DioConf_SOFT_SPI_MISO_CHANNEL_ID,
+    DioConf_SOFT_SPI_MOSI_CHANNEL_ID, DioConf_SOFT_I2C_SCL_CHANNEL_ID, DioConf_SOFT_I2C_SDA_CHANNEL_ID,
+    DioConf_ONE_WIRE_DQ_CHANNEL_ID, DioConf_TFT_CS_CHANNEL_ID, DioConf_TFT_DC_CHANNEL_ID, DioConf_TFT_WR_CHANNEL_ID,
+    DioConf_TFT_RD_CHANNEL_ID
+};
+
+STATIC Dio_ChannelType Bench_Shipped[SOFTPWM_CONFIGURED_CHANNELS];
+STATIC SoftPwm_ChannelConfigType Bench_Channels[SOFTPWM_MAX_CHANNELS];
+STATIC SoftPwm_DutyType Bench_Applied[SOFTPWM_MAX_CHANNELS];    /* Duties of the running period */
+STATIC SoftPwm_DutyType Bench_Requested[SOFTPWM_MAX_CHANNELS];  /* Duties of the next period */
+STATIC uint32 Bench_IsrCount = 0U;
+STATIC uint32 Bench_Random = 12345U;
+
+/* Timer A interrupt of SOFTPWM_TIMER */
+STATIC void Bench_Isr(void)
+{
+    Bench_IsrCount++;
+    SoftPwm_Timer_Isr();
+}
+
+/* New random duties, from Levels values spread over the duty range (0 for any duty) */
+STATIC void Bench_RandomDuties(uint8 Count, uint32 Levels)
+{
+    uint8 Index;
+    for (Index = 0U; Index < Count; Index++)
+    {
+        if (Levels == 0U)
+        {
+            Bench_Requested[Index] = (SoftPwm_DutyType)(Mcal_Sim_Random(&Bench_Random) % (BENCH_RESOLUTION + 1U));
+        }
+        else
+        {
+            Bench_Requested[Index] = (SoftPwm_DutyType)(((Mcal_Sim_Random(&Bench_Random) % Levels) + 1U) * (BENCH_RESOLUTION / (Levels + 1U)));
+        }
+    }
+}
+
+/* Number of distinct duties with an edge inside the period */
+STATIC uint32 Bench_DistinctEdges(uint8 Count)
+{
+    uint8 Seen[BENCH_RESOLUTION];
+    uint32 Distinct = 0U;
+    uint8 Index;
+
+    for (Index = 0U; Index < BENCH_RESOLUTION; Index++)
+    {
+        Seen[Index] = 0U;
+    }
+    for (Index = 0U; Index < Count; Index++)
+    {
+        if ((Bench_Applied[Index] != 0U) && (Bench_Applied[Index] != BENCH_RESOLUTION) && (Seen[Bench_Applied[Index]] == 0U))
+        {
+            Seen[Bench_Applied[Index]] = 1U;
+            Distinct++;
+        }
+    }
+    return Distinct;
+}
+
+/* Pins that do not show the duty of the running period at step Step */
+STATIC uint32 Bench_CheckStep(uint8 Count, uint32 Step)
+{
+    uint32 Errors = 0U;
+    uint8 Index;
+    for (Index = 0U; Index < Count; Index++)
+    {
+        const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[Bench_Channels[Index].channel];
+        boolean High = ((Mcal_Sim_GetOutputs(Channel->port) & Channel->mask) != 0U) ? TRUE : FALSE;
+        if (High != ((Bench_Applied[Index] > Step) ? TRUE : FALSE))
+        {
+            Errors++;
+        }
+    }
+    return Errors;
+}
+
+/* Runs the first Count channels of Pool for BENCH_PERIODS periods, prints its line and returns the number of wrong samples */
+STATIC uint32 Bench_Run(const Dio_ChannelType * Pool, uint8 Count, uint32 Levels)
+{
+    SoftPwm_ConfigType Config = { Bench_Channels, 0U, BENCH_PERIOD_CLOCKS, BENCH_RESOLUTION };
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Errors = 0U;
+    uint32 Accesses;
+    uint32 Isrs;
+    uint32 Edges = 0U;
+    uint32 ChannelEdges = 0U;
+    uint32 Period;
+    uint32 Step;
+    uint8 Index;
+    double IsrsPerPeriod;
+    double AccessesPerPeriod;
+    double EdgeIsrsPerPeriod;
+
+    Config.ChannelCount = Count;
+    Bench_RandomDuties(Count, Levels);
+    for (Index = 0U; Index < Count; Index++)
+    {
+        Bench_Channels[Index].channel = Pool[Index];
+        Bench_Channels[Index].duty = Bench_Requested[Index];
+        Bench_Applied[Index] = Bench_Requested[Index];
+    }
+    SoftPwm_Init(&Config);
+
+    Isrs = Bench_IsrCount;
+    Accesses = Stats->loads + Stats->stores;
+    Mcal_Sim_AdvanceClock(BENCH_STEP_CLOCKS / 2U);
+    for (Period = 0U; Period < BENCH_PERIODS; Period++)
+    {
+        uint32 UpdateStep = Mcal_Sim_Random(&Bench_Random) % BENCH_RESOLUTION;
+
+        /* The duties requested during the last period apply from this period start */
+        for (Index = 0U; Index < Count; Index++)
+        {
+            Bench_Applied[Index] = Bench_Requested[Index];
+            ChannelEdges += ((Bench_Applied[Index] != 0U) && (Bench_Applied[Index] != BENCH_RESOLUTION)) ? 2U : 0U;
+        }
+        Edges += Bench_DistinctEdges(Count) + 1U;
+        for (Step = 0U; Step < BENCH_RESOLUTION; Step++)
+        {
+            Errors += Bench_CheckStep(Count, Step);
+            if (Step == UpdateStep)
+            {
+                Bench_RandomDuties(Count, Levels);
+                (void)SoftPwm_SetDuties(Bench_Requested);
+            }
+            Mcal_Sim_AdvanceClock(BENCH_STEP_CLOCKS);
+        }
+    }
+    Isrs = Bench_IsrCount - Isrs;
+    Accesses = Stats->loads + Stats->stores - Accesses;
+    SoftPwm_Stop();
+
+    IsrsPerPeriod = (double)Isrs / BENCH_PERIODS;
+    AccessesPerPeriod = (double)Accesses / BENCH_PERIODS;
+    EdgeIsrsPerPeriod = (double)ChannelEdges / BENCH_PERIODS;
+    printf("%2u channels %-9s %6.2f edge groups %6.2f ISRs %6.1f accesses/period %5.2f %% CPU"
+           "  | per channel edge %6.2f ISRs %5.2f %% CPU  %lu errors\n",
+           (unsigned)Count, (Levels == 0U) ? "random" : "4 levels", (double)Edges / BENCH_PERIODS, IsrsPerPeriod,
+           AccessesPerPeriod,
+           100.0 * ((IsrsPerPeriod * BENCH_ISR_CLOCKS) + (AccessesPerPeriod * BENCH_ACCESS_CLOCKS)) / BENCH_PERIOD_CLOCKS,
+           EdgeIsrsPerPeriod,
+           100.0 * EdgeIsrsPerPeriod * (BENCH_ISR_CLOCKS + (BENCH_EDGE_ISR_ACCESSES * BENCH_ACCESS_CLOCKS)) / BENCH_PERIOD_CLOCKS,
+           (unsigned long)Errors);
+    return Errors;
+}
+
+/* Channels of the shipped configuration that are not outputs or that share a pin with another DIO user */
+STATIC uint32 Bench_CheckShipped(void)
+{
+    Dio_PortLevelType Used[DIO_CONFIGURED_PORTS] = { 0U };
+    uint32 Inputs = 0U;
+    uint32 Shared = 0U;
+    uint8 Index;
+    uint8 Access;
+
+    for (Index = 0U; Index < DIO_CONFIGURED_GROUPS; Index++)
+    {
+        Used[Dio_Configuration.Groups[Index].port] |= Dio_Configuration.Groups[Index].mask;
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_SYNC_PORT_WRITES; Index++)
+    {
+        Used[Dio_Configuration.SyncPortWrites[Index].port] |= Dio_Configuration.SyncPortWrites[Index].mask;
+    }
+    for (Index = 0U; Index < DIO_CONFIGURED_VIRTUAL_PORTS; Index++)
+    {
+        const Dio_VirtualPortType * VirtualPort = &Dio_Configuration.VirtualPorts[Index];
+        for (Access = 0U; Access < VirtualPort->access_count; Access++)
+        {
+            Used[VirtualPort->accesses[Access].port] |= VirtualPort->accesses[Access].mask;
+        }
+    }
+    for (Index = 0U; Index < (sizeof(Bench_OtherChannels) / sizeof(Bench_OtherChannels[0])); Index++)
+    {
+        const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[Bench_OtherChannels[Index]];
+        Used[Channel->port] |= Channel->mask;
+    }
+    for (Index = 0U; Index < SoftPwm_Configuration.ChannelCount; Index++)
+    {
+        const Dio_ChannelConfigType * Channel = &Dio_Configuration.Channels[SoftPwm_Configuration.Channels[Index].channel];
+        uint32 Outputs = MCAL_REG_READ32(Dio_Configuration.PortBaseAddress[Channel->port] + DIO_DIR_REG_OFFSET);
+        Inputs += ((Outputs & Channel->mask) == 0U) ? 1U : 0U;
+        Shared += ((Used[Channel->port] & Channel->mask) != 0U) ? 1U : 0U;
+        Used[Channel->port] |= Channel->mask;
+        Bench_Shipped[Index] = SoftPwm_Configuration.Channels[Index].channel;
+    }
+    printf("shipped configuration: %u channels, %lu not outputs, %lu on pins of another user\n",
+           (unsigned)SoftPwm_Configuration.ChannelCount, (unsigned long)Inputs, (unsigned long)Shared);
+    return Inputs + Shared;
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Mcal_Sim_SetIsr(SOFTPWM_TIMER_IRQ, Bench_Isr);
+    printf("%lu clocks period, %u duty steps, %u clocks per interrupt entry/exit, %u clocks per register access\n",
+           (unsigned long)BENCH_PERIOD_CLOCKS, BENCH_RESOLUTION, BENCH_ISR_CLOCKS, BENCH_ACCESS_CLOCKS);
+    Errors += Bench_CheckShipped();
+    Errors += Bench_Run(Bench_Shipped, (uint8)SoftPwm_Configuration.ChannelCount, 0U);
+
+    /* Board variant with every pin of the pool as an output */
+    MCAL_REG_WRITE32(DIO_GPIO_PORTA_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0xFFU);
+    MCAL_REG_WRITE32(DIO_GPIO_PORTB_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0xFFU);
+    MCAL_REG_WRITE32(DIO_GPIO_PORTC_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0xF0U);
+    MCAL_REG_WRITE32(DIO_GPIO_PORTD_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0x7FU);
+    MCAL_REG_WRITE32(DIO_GPIO_PORTE_BASE_ADDRESS + DIO_DIR_REG_OFFSET, 0x1FU);
+    Dio_Init(&Dio_Configuration);
+    Errors += Bench_Run(Bench_Pool, 4U, 0U);
+    Errors += Bench_Run(Bench_Pool, 8U, 0U);
+    Errors += Bench_Run(Bench_Pool, 16U, 0U);
+    Errors += Bench_Run(Bench_Pool, 32U, 0U);
+    Errors += Bench_Run(Bench_Pool, 32U, 4U);
+
+    /* The edges went through the DIO services: the shadowed pins must still match the output shadow */
+    Errors += (Dio_CheckOutputShadow() != 0U) ? 1U : 0U;
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file SoftSerial_Bench.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host throughput benchmark of the SoftSerial buses against the simulated GPIO registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Every bus moves the same payload, the benchmark counts the register accesses and the delay clocks
+ *          (advanced on the simulated clock) per bit and reports the bit rate they give at
+ *          SOFTSERIAL_SYSTEM_CLOCK_HZ, assuming BENCH_ACCESS_CLOCKS clocks per GPIO access, for the timing
+ *          profile SoftSerial_Cfg.h is built with. An SPI master written with Dio_WriteChannel and
+ *          Dio_ReadChannel is measured as the reference, its call overhead only shows in the host time per bit.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -I. Sim/SoftSerial_Bench.c Sim/Mcal_Sim.c SoftSerial/SoftSerial.c
+ *              SoftSerial/SoftSerial_PBcfg.c DIO/DIO.c DIO/Dio_PBcfg.c Port/Port.c Port/Port_PBcfg.c Det/Det.c
+ *              -o SoftSerial_Bench && ./SoftSerial_Bench
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "DIO/DIO.h"
+#include "Port/Port.h"
+#include "SoftSerial/SoftSerial.h"
+#include "SoftSerial/SoftSerial_Private.h"
+#include "Sim/Mcal_Sim.h"
+
+/* Payload of every bus */
+#define BENCH_BYTES                    (256U)
+#define BENCH_ROUNDS                   (200U)
+
+/* Assumed system clocks of one GPIO load or store on the target */
+#define BENCH_ACCESS_CLOCKS            (2U)
+
+/* Pins of the buses, port D for SPI and port A for I2C and 1-Wire */
+#define BENCH_SPI_PORT                 PORTD
+#define BENCH_SPI_MISO_PIN             (2U)
+#define BENCH_LINES_PORT               PORTA
+
+STATIC uint8 Bench_Tx[BENCH_BYTES];
+STATIC uint8 Bench_Rx[BENCH_BYTES];
+
+/* SPI mode 0 master of an application using the DIO channel services */
+STATIC void Bench_DioSpiTransfer(const uint8 * TxData, uint8 * RxData, uint16 Length)
+{
+    uint16 Index;
+    for (Index = 0U; Index < Length; Index++)
+    {
+        uint8 Rx = 0U;
+        sint8 Bit;
+        for (Bit = 7; Bit >= 0; Bit--)
+        {
+            Dio_WriteChannel(DioConf_SOFT_SPI_MOSI_CHANNEL_ID, (Dio_LevelType)((TxData[Index] >> Bit) & 1U));
+            SOFTSERIAL_DELAY(SOFTSERIAL_SPI_HALF_BIT_NS);
+            Dio_WriteChannel(DioConf_SOFT_SPI_SCK_CHANNEL_ID, STD_HIGH);
+            Rx = (uint8)((Rx << 1U) | Dio_ReadChannel(DioConf_SOFT_SPI_MISO_CHANNEL_ID));
+            SOFTSERIAL_DELAY(SOFTSERIAL_SPI_HALF_BIT_NS);
+            Dio_WriteChannel(DioConf_SOFT_SPI_SCK_CHANNEL_ID, STD_LOW);
+        }
+        RxData[Index] = Rx;
+    }
+}
+
+/* Runs one bus BENCH_ROUNDS times, prints its line and returns the number of wrong bytes received */
+STATIC uint32 Bench_Run(const char * Name, uint8 Bus, uint8 Expected)
+{
+    const Mcal_Sim_StatsType * Stats = Mcal_Sim_GetStats();
+    uint32 Accesses = Stats->loads + Stats->stores;
+    uint32 Clocks = Stats->clocks;
+    uint32 Errors = 0U;
+    double Bits = (double)BENCH_ROUNDS * BENCH_BYTES * 8.0;
+    double Seconds;
+    double AccessesPerBit;
+    double ClocksPerBit;
+    clock_t Start = clock();
+    uint32 Round;
+    uint16 Index;
+
+    for (Round = 0U; Round < BENCH_ROUNDS; Round++)
+    {
+        switch (Bus)
+        {
+            case 0U:
+                (void)SoftSerial_SpiTransfer(SoftSerialConf_FLASH_SPI_BUS, Bench_Tx, Bench_Rx, BENCH_BYTES);
+                break;
+            case 1U:
+                Bench_DioSpiTransfer(Bench_Tx, Bench_Rx, BENCH_BYTES);
+                break;
+            case 2U:
+                if (SoftSerial_I2cWriteRead(SoftSerialConf_EEPROM_I2C_BUS, 0x50U, Bench_Tx, BENCH_BYTES / 2U,
+                                            Bench_Rx, BENCH_BYTES / 2U) != E_OK)
+                {
+                    Errors++;
+                }
+                break;
+            default:
+                (void)SoftSerial_OneWireWrite(SoftSerialConf_TEMPERATURE_ONE_WIRE_BUS, Bench_Tx, BENCH_BYTES / 2U);
+                (void)SoftSerial_OneWireRead(SoftSerialConf_TEMPERATURE_ONE_WIRE_BUS, Bench_Rx, BENCH_BYTES / 2U);
+                break;
+        }
+        for (Index = 0U; Index < ((Bus < 2U) ? BENCH_BYTES : (BENCH_BYTES / 2U)); Index++)
+        {
+            if (Bench_Rx[Index] != Expected)
+            {
+                Errors++;
+            }
+        }
+    }
+    Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+
+    AccessesPerBit = (double)(Stats->loads + Stats->stores - Accesses) / Bits;
+    ClocksPerBit = ((double)(Stats->clocks - Clocks) / Bits) + (AccessesPerBit * BENCH_ACCESS_CLOCKS);
+    printf("%-22s %6.2f accesses/bit %8.1f clocks/bit %12.0f bit/s %8.1f ns/bit on the host  %lu errors\n",
+           Name, AccessesPerBit, ClocksPerBit, (double)SOFTSERIAL_SYSTEM_CLOCK_HZ / ClocksPerBit,
+           (Seconds * 1e9) / Bits, (unsigned long)Errors);
+    return Errors;
+}
+
+int main(void)
+{
+    uint32 Errors = 0U;
+    uint16 Index;
+
+    for (Index = 0U; Index < BENCH_BYTES; Index++)
+    {
+        Bench_Tx[Index] = (uint8)((Index * 37U) + 11U);
+    }
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    SoftSerial_Init(&SoftSerial_Configuration);
+
+    printf("timing profile %u, %lu Hz system clock, %u clocks per GPIO access, payload bits only\n",
+           (unsigned)SOFTSERIAL_TIMING_PROFILE, (unsigned long)SOFTSERIAL_SYSTEM_CLOCK_HZ, BENCH_ACCESS_CLOCKS);
+
+    /* MISO high: every byte reads 0xFF */
+    Mcal_Sim_SetInputs(BENCH_SPI_PORT, (uint8)(1U << BENCH_SPI_MISO_PIN));
+    Errors += Bench_Run("SPI SoftSerial", 0U, 0xFFU);
+    Errors += Bench_Run("SPI Dio_WriteChannel", 1U, 0xFFU);
+
+    /* I2C and 1-Wire lines held low by the "slaves": every byte is acknowledged and reads 0x00 */
+    Mcal_Sim_SetInputs(BENCH_LINES_PORT, 0x00U);
+    Errors += Bench_Run("I2C SoftSerial", 2U, 0x00U);
+    Errors += Bench_Run("1-Wire SoftSerial", 3U, 0x00U);
+
+    return (Errors == 0U) ? 0 : 1;
+}
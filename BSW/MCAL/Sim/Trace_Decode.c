@@ -0,0 +1,396 @@
+/**
+ * @file Trace_Decode.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief  Host decoder of the DIO/Port service trace into per-service latency histograms
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details Given a file, it decodes a dump of Trace_Buffer taken from the target, e.g. with gdb:
+ *          dump binary value trace.bin Trace_Buffer
+ *          The records left in the ring are grouped per service, their cycles less the trace overhead measured
+ *          by Trace_Init, and printed with their count, minimum, mean, maximum and a power of 2 histogram.
+ *          Built with TRACE_API on and run without a file, it traces a DIO/Port workload on the simulated
+ *          registers instead, with a traced Dio_ReadChannel "ISR" preempting it at register accesses and between
+ *          the exclusive load and store that claim a slot. The ring is drained while it runs, as a debugger
+ *          would, and every call must be found once with its argument: the claims the ISR broke into must have
+ *          been retried, none of their records lost.
+ *          "-w <file>" then also writes the ring as a dump file for the first mode.
+ *          Build and run from BSW/MCAL:
+ *          gcc -O2 -DMCAL_HOST_SIM -DTRACE_API=STD_ON -I. Sim/Trace_Decode.c Sim/Mcal_Sim.c Trace/Trace.c DIO/DIO.c
+ *              DIO/Dio_PBcfg.c Port/Port.c Port/Port_PBcfg.c Det/Det.c -o Trace_Decode
+ *          ./Trace_Decode -w trace.bin   (trace the simulated workload and write its dump)
+ *          ./Trace_Decode trace.bin      (decode a dump)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "DIO/DIO.h"
+#include "Port/Port.h"
+#include "Trace/Trace.h"
+#if (TRACE_API == STD_ON)
+#include "Sim/Mcal_Sim.h"
+#endif
+
+/* Histogram columns: below 2, 4, 8 .. 512 cycles, then 512 and more */
+#define DECODE_BUCKETS                 (10U)
+
+/* Largest ring a dump may hold */
+#define DECODE_MAX_RECORDS             (65536UL)
+
+/* Workload iterations, and the register accesses between two preemptions by the traced "ISR" */
+#define BENCH_ITERATIONS               (2000U)
+#define BENCH_PREEMPTION_PERIOD        (7U)
+
+/* One traced service: its module, its service ID and its name */
+typedef struct
+{
+    uint8 Module;
+    uint8 Sid;
+    const char * Name;
+}Decode_ServiceType;
+
+/* Latencies of one service */
+typedef struct
+{
+    uint32 Calls;
+    uint32 Min;
+    uint32 Max;
+    double Sum;
+    uint32 Buckets[DECODE_BUCKETS];
+}Decode_HistogramType;
+
+STATIC const Decode_ServiceType Decode_Services[] =
+{
+    { DIO_MODULE_ID, DIO_READ_CHANNEL_SID, "Dio_ReadChannel" },
+    { DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID, "Dio_WriteChannel" },
+    { DIO_MODULE_ID, DIO_READ_PORT_SID, "Dio_ReadPort" },
+    { DIO_MODULE_ID, DIO_WRITE_PORT_SID, "Dio_WritePort" },
+    { DIO_MODULE_ID, DIO_READ_CHANNEL_GROUP_SID, "Dio_ReadChannelGroup" },
+    { DIO_MODULE_ID, DIO_WRITE_CHANNEL_GROUP_SID, "Dio_WriteChannelGroup" },
+    { DIO_MODULE_ID, DIO_INIT_SID, "Dio_Init" },
+    { DIO_MODULE_ID, DIO_FLIP_CHANNEL_SID, "Dio_FlipChannel" },
+    { DIO_MODULE_ID, DIO_GET_VERSION_INFO_SID, "Dio_GetVersionInfo" },
+    { DIO_MODULE_ID, DIO_MASKED_WRITE_PORT_SID, "Dio_MaskedWritePort" },
+    { DIO_MODULE_ID, DIO_WRITE_PORTS_SYNCHRONOUS_SID, "Dio_WritePortsSynchronous" },
+    { DIO_MODULE_ID, DIO_READ_ALL_PORTS_SID, "Dio_ReadAllPorts" },
+    { DIO_MODULE_ID, DIO_MAIN_FUNCTION_SID, "Dio_MainFunction" },
+    { DIO_MODULE_ID, DIO_ENABLE_NOTIFICATION_SID, "Dio_EnableNotification" },
+    { DIO_MODULE_ID, DIO_DISABLE_NOTIFICATION_SID, "Dio_DisableNotification" },
+    { DIO_MODULE_ID, DIO_START_PATTERN_SID, "Dio_StartPattern" },
+    { DIO_MODULE_ID, DIO_STOP_PATTERN_SID, "Dio_StopPattern" },
+    { DIO_MODULE_ID, DIO_START_CAPTURE_SID, "Dio_StartCapture" },
+    { DIO_MODULE_ID, DIO_STOP_CAPTURE_SID, "Dio_StopCapture" },
+    { DIO_MODULE_ID, DIO_RELEASE_CAPTURE_HALF_SID, "Dio_ReleaseCaptureHalf" },
+    { DIO_MODULE_ID, DIO_GET_CAPTURE_STATUS_SID, "Dio_GetCaptureStatus" },
+    { DIO_MODULE_ID, DIO_DECODE_CAPTURE_EDGES_SID, "Dio_DecodeCaptureEdges" },
+    { DIO_MODULE_ID, DIO_CHECK_OUTPUT_SHADOW_SID, "Dio_CheckOutputShadow" },
+    { DIO_MODULE_ID, DIO_READ_VIRTUAL_PORT_SID, "Dio_ReadVirtualPort" },
+    { DIO_MODULE_ID, DIO_WRITE_VIRTUAL_PORT_SID, "Dio_WriteVirtualPort" },
+    { DIO_MODULE_ID, DIO_GET_DMA_CONTROL_SID, "Dio_GetDmaControl" },
+    { PORT_MODULE_ID, PORT_SET_PIN_DIRECTION_SID, "Port_SetPinDirection" },
+    { PORT_MODULE_ID, PORT_INIT_SID, "Port_Init" },
+    { PORT_MODULE_ID, PORT_SET_PIN_MODE_SID, "Port_SetPinMode" },
+    { PORT_MODULE_ID, PORT_GET_VERSION_INFO_SID, "Port_GetVersionInfo" },
+    { PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID, "Port_RefreshPortDirection" }
+};
+
+#define DECODE_SERVICES                (sizeof(Decode_Services) / sizeof(Decode_Services[0]))
+
+STATIC Decode_HistogramType Decode_Histograms[DECODE_SERVICES];
+STATIC uint32 Decode_Unknown = 0U;
+
+/* Service of an event word, DECODE_SERVICES when it is not a traced service */
+STATIC uint32 Decode_Find(uint32 Event)
+{
+    uint32 Index;
+    for (Index = 0U; Index < DECODE_SERVICES; Index++)
+    {
+        if (TRACE_EVENT(Decode_Services[Index].Module, Decode_Services[Index].Sid, 0U) == (Event & 0xFFFFU))
+        {
+            return Index;
+        }
+    }
+    return DECODE_SERVICES;
+}
+
+/* Adds one record to the histogram of its service */
+STATIC void Decode_Add(uint32 Event, uint32 Cycles, uint32 Overhead)
+{
+    uint32 Service = Decode_Find(Event);
+    Decode_HistogramType * Histogram;
+    uint32 Bucket = 0U;
+
+    if (Service == DECODE_SERVICES)
+    {
+        Decode_Unknown++;
+        return;
+    }
+    Histogram = &Decode_Histograms[Service];
+    Cycles = (Cycles > Overhead) ? (Cycles - Overhead) : 0U;
+    while ((Bucket < (DECODE_BUCKETS - 1U)) && (Cycles >= (2UL << Bucket)))
+    {
+        Bucket++;
+    }
+    Histogram->Buckets[Bucket]++;
+    Histogram->Min = ((Histogram->Calls == 0U) || (Cycles < Histogram->Min)) ? Cycles : Histogram->Min;
+    Histogram->Max = (Cycles > Histogram->Max) ? Cycles : Histogram->Max;
+    Histogram->Sum += (double)Cycles;
+    Histogram->Calls++;
+}
+
+/* Prints the histograms of the services that were called */
+STATIC void Decode_Print(uint32 Overhead)
+{
+    uint32 Index;
+    uint32 Bucket;
+
+    printf("cycles less the %lu cycles trace overhead\n", (unsigned long)Overhead);
+    printf("%-26s %7s %6s %8s %6s", "service", "calls", "min", "mean", "max");
+    for (Bucket = 0U; Bucket < (DECODE_BUCKETS - 1U); Bucket++)
+    {
+        printf("  <%-4lu", 2UL << Bucket);
+    }
+    printf(" >=%-4lu\n", 1UL << (DECODE_BUCKETS - 1U));
+    for (Index = 0U; Index < DECODE_SERVICES; Index++)
+    {
+        const Decode_HistogramType * Histogram = &Decode_Histograms[Index];
+        if (Histogram->Calls == 0U)
+        {
+            continue;
+        }
+        printf("%-26s %7lu %6lu %8.1f %6lu", Decode_Services[Index].Name, (unsigned long)Histogram->Calls,
+               (unsigned long)Histogram->Min, Histogram->Sum / Histogram->Calls, (unsigned long)Histogram->Max);
+        for (Bucket = 0U; Bucket < DECODE_BUCKETS; Bucket++)
+        {
+            printf(" %6lu", (unsigned long)Histogram->Buckets[Bucket]);
+        }
+        printf("\n");
+    }
+    if (Decode_Unknown != 0U)
+    {
+        printf("%lu records of unknown services\n", (unsigned long)Decode_Unknown);
+    }
+}
+
+/* Next little endian word of a dump, FALSE at the end of the file */
+STATIC boolean Decode_ReadWord(FILE * File, uint32 * Word)
+{
+    uint8 Bytes[4];
+    if (fread(Bytes, 1U, 4U, File) != 4U)
+    {
+        return FALSE;
+    }
+    *Word = (uint32)Bytes[0] | ((uint32)Bytes[1] << 8U) | ((uint32)Bytes[2] << 16U) | ((uint32)Bytes[3] << 24U);
+    return TRUE;
+}
+
+/* Decodes the dump file Path, returns the exit status */
+STATIC int Decode_File(const char * Path)
+{
+    static uint32 Words[2UL * DECODE_MAX_RECORDS];
+    FILE * File = fopen(Path, "rb");
+    uint32 Head;
+    uint32 Records;
+    uint32 Overhead;
+    uint32 Index;
+
+    if (File == NULL)
+    {
+        fprintf(stderr, "%s: cannot open\n", Path);
+        return 2;
+    }
+    if ((Decode_ReadWord(File, &Head) == FALSE) || (Decode_ReadWord(File, &Records) == FALSE)
+        || (Decode_ReadWord(File, &Overhead) == FALSE) || (Records == 0U) || (Records > DECODE_MAX_RECORDS)
+        || ((Records & (Records - 1U)) != 0U))
+    {
+        fprintf(stderr, "%s: not a trace dump\n", Path);
+        fclose(File);
+        return 2;
+    }
+    for (Index = 0U; Index < (2U * Records); Index++)
+    {
+        if (Decode_ReadWord(File, &Words[Index]) == FALSE)
+        {
+            fprintf(stderr, "%s: truncated after %lu records\n", Path, (unsigned long)(Index / 2U));
+            fclose(File);
+            return 2;
+        }
+    }
+    fclose(File);
+
+    /* The ring holds the last Records records, oldest first from Head */
+    printf("%lu records written, %lu in the ring\n", (unsigned long)Head,
+           (unsigned long)((Head < Records) ? Head : Records));
+    for (Index = (Head < Records) ? 0U : (Head - Records); Index != Head; Index++)
+    {
+        uint32 Slot = Index & (Records - 1U);
+        Decode_Add(Words[2U * Slot], Words[(2U * Slot) + 1U], Overhead);
+    }
+    Decode_Print(Overhead);
+    return 0;
+}
+
+#if (TRACE_API == STD_ON)
+STATIC uint32 Bench_Tail = 0U;                  /* Next record drained from the ring */
+STATIC uint32 Bench_Lost = 0U;                  /* Records overwritten before they were drained */
+STATIC uint32 Bench_Expected[DECODE_SERVICES];  /* Calls made per service */
+STATIC uint32 Bench_WrongArguments = 0U;
+STATIC uint32 Bench_HookCalls = 0U;
+STATIC boolean Bench_InIsr = FALSE;
+
+/* Counts one call of the service Module/Sid */
+STATIC void Bench_Expect(uint8 Module, uint8 Sid)
+{
+    Bench_Expected[Decode_Find(TRACE_EVENT(Module, Sid, 0U))]++;
+}
+
+/* Preemption hook: a traced read of SW1 every BENCH_PREEMPTION_PERIOD register accesses, not nested */
+STATIC void Bench_Isr(void)
+{
+    if ((Bench_InIsr == TRUE) || ((++Bench_HookCalls % BENCH_PREEMPTION_PERIOD) != 0U))
+    {
+        return;
+    }
+    Bench_InIsr = TRUE;
+    (void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID);
+    Bench_Expect(DIO_MODULE_ID, DIO_READ_CHANNEL_SID);
+    Bench_InIsr = FALSE;
+}
+
+/* Drains the new records of the ring, as a debugger reading it while the target runs */
+STATIC void Bench_Drain(void)
+{
+    uint32 Head = Trace_Buffer.Head;
+    if ((Head - Bench_Tail) > TRACE_RING_RECORDS)
+    {
+        Bench_Lost += (Head - Bench_Tail) - TRACE_RING_RECORDS;
+        Bench_Tail = Head - TRACE_RING_RECORDS;
+    }
+    for (; Bench_Tail != Head; Bench_Tail++)
+    {
+        const Trace_RecordType * Record = &Trace_Buffer.Ring[Bench_Tail & (TRACE_RING_RECORDS - 1U)];
+        uint32 Service = Record->Event & 0xFFFFU;
+        uint32 Argument = Record->Event >> 16U;
+
+        /* The channel and port services of the workload only use these arguments */
+        if (((Service == TRACE_EVENT(DIO_MODULE_ID, DIO_READ_CHANNEL_SID, 0U)) && (Argument != DioConf_SW1_CHANNEL_ID))
+            || (((Service == TRACE_EVENT(DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID, 0U))
+                 || (Service == TRACE_EVENT(DIO_MODULE_ID, DIO_FLIP_CHANNEL_SID, 0U))) && (Argument != DioConf_LED1_CHANNEL_ID))
+            || ((Service == TRACE_EVENT(DIO_MODULE_ID, DIO_MASKED_WRITE_PORT_SID, 0U)) && (Argument != PORTD)))
+        {
+            Bench_WrongArguments++;
+        }
+        Decode_Add(Record->Event, Record->Cycles, Trace_Buffer.Overhead);
+    }
+}
+
+/* Writes the ring as a dump file, returns FALSE when it cannot */
+STATIC boolean Bench_WriteDump(const char * Path)
+{
+    FILE * File = fopen(Path, "wb");
+    const uint32 * Words = (const uint32 *)(const void *)&Trace_Buffer;
+    uint32 Index;
+
+    if (File == NULL)
+    {
+        return FALSE;
+    }
+    for (Index = 0U; Index < (sizeof(Trace_Buffer) / 4U); Index++)
+    {
+        uint8 Bytes[4] = { (uint8)Words[Index], (uint8)(Words[Index] >> 8U), (uint8)(Words[Index] >> 16U),
+                           (uint8)(Words[Index] >> 24U) };
+        (void)fwrite(Bytes, 1U, 4U, File);
+    }
+    return (fclose(File) == 0) ? TRUE : FALSE;
+}
+
+/* Traces the workload, returns the exit status */
+STATIC int Bench_Run(const char * DumpPath)
+{
+    uint32 Errors = 0U;
+    uint32 Iteration;
+    uint32 Index;
+
+    Mcal_Sim_Reset();
+    Mcal_Sim_SetPrgpioDelay(0U);
+    Trace_Init();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Bench_Expect(PORT_MODULE_ID, PORT_INIT_SID);
+    Bench_Expect(DIO_MODULE_ID, DIO_INIT_SID);
+    Mcal_Sim_SetPreemptionHook(Bench_Isr);
+
+    for (Iteration = 0U; Iteration < BENCH_ITERATIONS; Iteration++)
+    {
+        Dio_WriteChannel(DioConf_LED1_CHANNEL_ID, (Dio_LevelType)(Iteration & 1U));
+        (void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID);
+        (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID);
+        Dio_MaskedWritePort(PORTD, (Dio_PortLevelType)Iteration, 0x0FU);
+        Dio_WriteChannelGroup(DioConf_MUX_SELECT_GROUP_PTR, (Dio_PortLevelType)(Iteration & 0x03U));
+        (void)Dio_ReadAllPorts();
+        Dio_MainFunction();
+        Bench_Expect(DIO_MODULE_ID, DIO_WRITE_CHANNEL_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_READ_CHANNEL_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_FLIP_CHANNEL_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_MASKED_WRITE_PORT_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_WRITE_CHANNEL_GROUP_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_READ_ALL_PORTS_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_MAIN_FUNCTION_SID);
+        Bench_Expect(DIO_MODULE_ID, DIO_READ_ALL_PORTS_SID);    /* Sampled by Dio_MainFunction, traced on its own */
+        if ((Iteration % 100U) == 0U)
+        {
+            Port_RefreshPortDirection();
+            Bench_Expect(PORT_MODULE_ID, PORT_REFRESH_PORT_DIRECTION_SID);
+        }
+        Bench_Drain();
+    }
+    Mcal_Sim_SetPreemptionHook(NULL_PTR);
+
+    Decode_Print(Trace_Buffer.Overhead);
+    for (Index = 0U; Index < DECODE_SERVICES; Index++)
+    {
+        if (Decode_Histograms[Index].Calls != Bench_Expected[Index])
+        {
+            printf("%s: %lu records for %lu calls\n", Decode_Services[Index].Name,
+                   (unsigned long)Decode_Histograms[Index].Calls, (unsigned long)Bench_Expected[Index]);
+            Errors++;
+        }
+    }
+    Errors += Bench_Lost + Bench_WrongArguments + Decode_Unknown;
+    printf("%lu records, %lu lost, %lu wrong arguments, %lu slot claims preempted and retried\n",
+           (unsigned long)Trace_Buffer.Head, (unsigned long)Bench_Lost, (unsigned long)Bench_WrongArguments,
+           (unsigned long)Mcal_Sim_GetStats()->exclusive_failures);
+    /* The workload has to reach the window between the load and the store of the write index */
+    Errors += (Mcal_Sim_GetStats()->exclusive_failures == 0U) ? 1U : 0U;
+    if ((DumpPath != NULL) && (Bench_WriteDump(DumpPath) == FALSE))
+    {
+        printf("%s: cannot write the dump\n", DumpPath);
+        Errors++;
+    }
+    printf("%lu errors\n", (unsigned long)Errors);
+    return (Errors == 0U) ? 0 : 1;
+}
+#endif
+
+int main(int argc, char * argv[])
+{
+    if ((argc == 2) && (strcmp(argv[1], "-w") != 0))
+    {
+        return Decode_File(argv[1]);
+    }
+#if (TRACE_API == STD_ON)
+    if (argc == 1)
+    {
+        return Bench_Run(NULL);
+    }
+    if ((argc == 3) && (strcmp(argv[1], "-w") == 0))
+    {
+        return Bench_Run(argv[2]);
+    }
+#endif
+    fprintf(stderr, "usage: %s <dump file>\n", argv[0]);
+    fprintf(stderr, "       %s [-w <dump file>]   (built with -DTRACE_API=STD_ON)\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,355 @@
+/**
+ * @file SoftPwm.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief SoftPwm.c is the source file for SoftPwm.h file which contains the implementation of the functions.
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include "SoftPwm.h"
+#include "SoftPwm_Private.h"
+
+/* One masked port write of an edge group */
+typedef struct
+{
+    Dio_PortType port;
+    Dio_PortLevelType level;
+    Dio_PortLevelType mask;
+}SoftPwm_WriteType;
+
+/* One edge group: the channels whose duty ends at the same step */
+typedef struct
+{
+    uint32 match;     // Timer A value of the edge (the counter runs down from the period start).
+    uint8 first;      // First write of the group.
+    uint8 last;       // One past the last write of the group.
+}SoftPwm_EdgeType;
+
+/* Edge table of one set of duties: the period start writes, then the edge groups in time order */
+typedef struct
+{
+    SoftPwm_WriteType writes[DIO_CONFIGURED_PORTS + SOFTPWM_MAX_CHANNELS];
+    SoftPwm_EdgeType edges[SOFTPWM_MAX_CHANNELS];
+    uint8 start_count;
+    uint8 edge_count;
+}SoftPwm_TableType;
+
+STATIC SoftPwm_TableType SoftPwm_Tables[2];                  /* Active table and the one built for the next period */
+STATIC volatile uint8 SoftPwm_Active = 0U;                   /* Table used by the ISR */
+STATIC volatile boolean SoftPwm_Pending = FALSE;             /* The other table is ready for the next period start */
+STATIC uint8 SoftPwm_NextEdge = 0U;                          /* Next edge group of the active table */
+STATIC SoftPwm_DutyType SoftPwm_Duties[SOFTPWM_MAX_CHANNELS];
+STATIC Dio_PortType SoftPwm_ChannelPort[SOFTPWM_MAX_CHANNELS];
+STATIC Dio_PortLevelType SoftPwm_ChannelMask[SOFTPWM_MAX_CHANNELS];
+STATIC Dio_PortLevelType SoftPwm_PortPins[DIO_CONFIGURED_PORTS];   /* Channels of every port */
+STATIC uint8 SoftPwm_ChannelCount = 0U;
+STATIC uint16 SoftPwm_Resolution = 0U;
+STATIC uint32 SoftPwm_StepClocks = 0U;
+STATIC uint32 SoftPwm_PeriodClocks = 0U;
+STATIC uint8 SoftPwm_Status = SOFTPWM_NOT_INITIALIZED;       /* SoftPwm Status */
+
+/* Writes [First, Last) of Table */
+LOCAL_INLINE void SoftPwm_Write(const SoftPwm_TableType * Table, uint8 First, uint8 Last)
+{
+    uint8 Index;
+    for (Index = First; Index < Last; Index++)
+    {
+        Dio_MaskedWritePort(Table->writes[Index].port, Table->writes[Index].level, Table->writes[Index].mask);
+    }
+}
+
+/*
+ * Builds the table of SoftPwm_Duties: the channels that have an edge inside the period are sorted by duty
+ * (insertion sort, run in the caller's context only), then the channels of one duty are merged per port.
+ */
+STATIC void SoftPwm_BuildTable(SoftPwm_TableType * Table)
+{
+    uint8 Order[SOFTPWM_MAX_CHANNELS];
+    Dio_PortLevelType Pins[DIO_CONFIGURED_PORTS];
+    uint8 Count = 0U;
+    uint8 Writes = 0U;
+    uint8 Index;
+    uint8 PortId;
+
+    /* Period start: every channel with a non zero duty high, the others low, one write per port */
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        Pins[PortId] = 0U;
+    }
+    for (Index = 0U; Index < SoftPwm_ChannelCount; Index++)
+    {
+        SoftPwm_DutyType Duty = SoftPwm_Duties[Index];
+        if (Duty != 0U)
+        {
+            Pins[SoftPwm_ChannelPort[Index]] |= SoftPwm_ChannelMask[Index];
+        }
+        if ((Duty != 0U) && (Duty != SoftPwm_Resolution))
+        {
+            uint8 Position = Count++;
+            while ((Position > 0U) && (SoftPwm_Duties[Order[Position - 1U]] > Duty))
+            {
+                Order[Position] = Order[Position - 1U];
+                Position--;
+            }
+            Order[Position] = Index;
+        }
+    }
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        if (SoftPwm_PortPins[PortId] != 0U)
+        {
+            Table->writes[Writes].port = PortId;
+            Table->writes[Writes].level = Pins[PortId];
+            Table->writes[Writes].mask = SoftPwm_PortPins[PortId];
+            Writes++;
+        }
+    }
+    Table->start_count = Writes;
+
+    /* Falling edges in time order */
+    Table->edge_count = 0U;
+    Index = 0U;
+    while (Index < Count)
+    {
+        SoftPwm_DutyType Duty = SoftPwm_Duties[Order[Index]];
+        SoftPwm_EdgeType * Edge = &Table->edges[Table->edge_count++];
+
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+        {
+            Pins[PortId] = 0U;
+        }
+        while ((Index < Count) && (SoftPwm_Duties[Order[Index]] == Duty))
+        {
+            Pins[SoftPwm_ChannelPort[Order[Index]]] |= SoftPwm_ChannelMask[Order[Index]];
+            Index++;
+        }
+        Edge->match = (SoftPwm_PeriodClocks - 1U) - ((uint32)Duty * SoftPwm_StepClocks);
+        Edge->first = Writes;
+        for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+        {
+            if (Pins[PortId] != 0U)
+            {
+                Table->writes[Writes].port = PortId;
+                Table->writes[Writes].level = 0U;
+                Table->writes[Writes].mask = Pins[PortId];
+                Writes++;
+            }
+        }
+        Edge->last = Writes;
+    }
+}
+
+/*
+ * Builds the inactive table and hands it to the ISR. The pending flag is withdrawn first: the ISR then keeps
+ * its table until the flag is set again, so the inactive table is never read while it is rebuilt.
+ */
+STATIC void SoftPwm_Publish(void)
+{
+    SoftPwm_Pending = FALSE;
+    SoftPwm_BuildTable(&SoftPwm_Tables[SoftPwm_Active ^ 1U]);
+    SOFTPWM_COMPILER_BARRIER();
+    SoftPwm_Pending = TRUE;
+}
+
+/**
+ * @brief SoftPwm_Init is a service that builds the edge table of the configured duties and starts the timer.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] ConfigPtr         Pointer to the post-build configuration set.
+ */
+void SoftPwm_Init (const SoftPwm_ConfigType* ConfigPtr){
+    const SoftPwm_TableType * Table = &SoftPwm_Tables[0];
+    const Dio_ConfigType * DioConfig = Dio_GetConfig();
+    uint8 Index;
+
+    if ((ConfigPtr == NULL_PTR) || (DioConfig == NULL_PTR) || (ConfigPtr->Channels == NULL_PTR)
+        || (ConfigPtr->ChannelCount == 0U) || (ConfigPtr->ChannelCount > SOFTPWM_MAX_CHANNELS) || (ConfigPtr->Resolution == 0U)
+        || ((ConfigPtr->PeriodClocks / ConfigPtr->Resolution) < SOFTPWM_MIN_STEP_CLOCKS))
+    {
+        return;
+    }
+    for (Index = 0U; Index < ConfigPtr->ChannelCount; Index++)
+    {
+        if ((ConfigPtr->Channels[Index].channel >= DIO_CONFIGURED_CHANNELS)
+            || (ConfigPtr->Channels[Index].duty > ConfigPtr->Resolution))
+        {
+            return;
+        }
+    }
+    SoftPwm_Stop();
+
+    SoftPwm_ChannelCount = ConfigPtr->ChannelCount;
+    SoftPwm_Resolution = ConfigPtr->Resolution;
+    SoftPwm_StepClocks = ConfigPtr->PeriodClocks / ConfigPtr->Resolution;
+    SoftPwm_PeriodClocks = SoftPwm_StepClocks * ConfigPtr->Resolution;
+    for (Index = 0U; Index < DIO_CONFIGURED_PORTS; Index++)
+    {
+        SoftPwm_PortPins[Index] = 0U;
+    }
+    for (Index = 0U; Index < SoftPwm_ChannelCount; Index++)
+    {
+        const Dio_ChannelConfigType * Channel = &DioConfig->Channels[ConfigPtr->Channels[Index].channel];
+        SoftPwm_ChannelPort[Index] = Channel->port;
+        SoftPwm_ChannelMask[Index] = Channel->mask;
+        SoftPwm_PortPins[Channel->port] |= Channel->mask;
+        SoftPwm_Duties[Index] = ConfigPtr->Channels[Index].duty;
+    }
+    SoftPwm_Active = 0U;
+    SoftPwm_Pending = FALSE;
+    SoftPwm_NextEdge = 0U;
+    SoftPwm_BuildTable(&SoftPwm_Tables[0]);
+
+    if ((MCAL_REG_READ32(SOFTPWM_RCGCTIMER_REGISTER_ADDRESS) & (1UL << SOFTPWM_TIMER)) == 0U)
+    {
+        MCAL_REG_WRITE32(SOFTPWM_RCGCTIMER_REGISTER_ADDRESS,
+                         MCAL_REG_READ32(SOFTPWM_RCGCTIMER_REGISTER_ADDRESS) | (1UL << SOFTPWM_TIMER));
+        while ((MCAL_REG_READ32(SOFTPWM_PRTIMER_REGISTER_ADDRESS) & (1UL << SOFTPWM_TIMER)) == 0U);
+    }
+
+    /* Timer A periodic over the whole period: the timeout starts a period, the match paces the edge groups */
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_CTL_REG_OFFSET, 0U);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_CFG_REG_OFFSET, TIMER_CFG_32_BIT_TIMER);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_TAMR_REG_OFFSET, TIMER_TAMR_TAMR_PERIOD | TIMER_TAMR_TAMIE);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_TAILR_REG_OFFSET, SoftPwm_PeriodClocks - 1U);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_TAMATCHR_REG_OFFSET,
+                      (Table->edge_count != 0U) ? Table->edges[0].match : SOFTPWM_NO_MATCH);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_ICR_REG_OFFSET, TIMER_ICR_TATOCINT | TIMER_ICR_TAMCINT);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_IMR_REG_OFFSET, TIMER_IMR_TATOIM | TIMER_IMR_TAMIM);
+
+    /* The first period starts with the timer */
+    SoftPwm_Write(Table, 0U, Table->start_count);
+    SoftPwm_Status = SOFTPWM_INITIALIZED;
+    MCAL_REG_WRITE32(SOFTPWM_NVIC_EN_REGISTER_ADDRESS, SOFTPWM_NVIC_BIT);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_CTL_REG_OFFSET, TIMER_CTL_TAEN);
+}
+
+/**
+ * @brief SoftPwm_SetDuty is a service that changes the duty of one channel from the next period start.
+ *
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Asynchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] Channel           Channel.
+ * @param [in] Duty              High time in duty steps.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or a parameter is invalid.
+ */
+Std_ReturnType SoftPwm_SetDuty (SoftPwm_ChannelType Channel, SoftPwm_DutyType Duty){
+    if ((SoftPwm_Status != SOFTPWM_INITIALIZED) || (Channel >= SoftPwm_ChannelCount) || (Duty > SoftPwm_Resolution))
+    {
+        return E_NOT_OK;
+    }
+    SoftPwm_Duties[Channel] = Duty;
+    SoftPwm_Publish();
+    return E_OK;
+}
+
+/**
+ * @brief SoftPwm_SetDuties is a service that changes the duties of all the channels from the next period start.
+ *
+ * @details Service ID [hex] 0x02
+ *          Synchronous/Asynchronous: Asynchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] Duties            Duties of the ChannelCount channels, indexed by SoftPwm_ChannelType.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or a duty is invalid.
+ */
+Std_ReturnType SoftPwm_SetDuties (const SoftPwm_DutyType* Duties){
+    uint8 Index;
+
+    if ((SoftPwm_Status != SOFTPWM_INITIALIZED) || (Duties == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    for (Index = 0U; Index < SoftPwm_ChannelCount; Index++)
+    {
+        if (Duties[Index] > SoftPwm_Resolution)
+        {
+            return E_NOT_OK;
+        }
+    }
+    for (Index = 0U; Index < SoftPwm_ChannelCount; Index++)
+    {
+        SoftPwm_Duties[Index] = Duties[Index];
+    }
+    SoftPwm_Publish();
+    return E_OK;
+}
+
+/**
+ * @brief SoftPwm_Stop is a service that stops the timer and drives all the channels low.
+ *
+ * @details Service ID [hex] 0x03
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ */
+void SoftPwm_Stop (void){
+    uint8 PortId;
+
+    if (SoftPwm_Status != SOFTPWM_INITIALIZED)
+    {
+        return;
+    }
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_CTL_REG_OFFSET, 0U);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_IMR_REG_OFFSET, 0U);
+    MCAL_REG_WRITE32(SOFTPWM_NVIC_DIS_REGISTER_ADDRESS, SOFTPWM_NVIC_BIT);
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_ICR_REG_OFFSET, TIMER_ICR_TATOCINT | TIMER_ICR_TAMCINT);
+    for (PortId = 0U; PortId < DIO_CONFIGURED_PORTS; PortId++)
+    {
+        if (SoftPwm_PortPins[PortId] != 0U)
+        {
+            Dio_MaskedWritePort(PortId, 0U, SoftPwm_PortPins[PortId]);
+        }
+    }
+    SoftPwm_Pending = FALSE;
+    SoftPwm_Status = SOFTPWM_NOT_INITIALIZED;
+}
+
+/*
+ * Called at the period start (timeout) and at every edge group (match). A table published by the caller is
+ * taken at the period start only, so no period mixes two sets of duties. Every edge group that is due is
+ * written, then the match is moved to the next one and the counter read again: a group the counter passed
+ * while the match was moved (ISR latency above one duty step) is written at once instead of a period late.
+ */
+void SoftPwm_Timer_Isr (void){
+    uint32 Status = SOFTPWM_READ_REG(SOFTPWM_TIMER_MIS_REG_OFFSET);
+    const SoftPwm_TableType * Table;
+    uint8 Edge;
+
+    SOFTPWM_WRITE_REG(SOFTPWM_TIMER_ICR_REG_OFFSET, Status);
+    if ((Status & TIMER_MIS_TATOMIS) != 0U)
+    {
+        if (SoftPwm_Pending == TRUE)
+        {
+            SoftPwm_Active ^= 1U;
+            SoftPwm_Pending = FALSE;
+        }
+        Table = &SoftPwm_Tables[SoftPwm_Active];
+        SoftPwm_Write(Table, 0U, Table->start_count);
+        SoftPwm_NextEdge = 0U;
+        if (Table->edge_count == 0U)
+        {
+            SOFTPWM_WRITE_REG(SOFTPWM_TIMER_TAMATCHR_REG_OFFSET, SOFTPWM_NO_MATCH);
+            return;
+        }
+    }
+    Table = &SoftPwm_Tables[SoftPwm_Active];
+    Edge = SoftPwm_NextEdge;
+    while (Edge < Table->edge_count)
+    {
+        uint32 Match = Table->edges[Edge].match;
+        SOFTPWM_WRITE_REG(SOFTPWM_TIMER_TAMATCHR_REG_OFFSET, Match);
+        if (SOFTPWM_READ_REG(SOFTPWM_TIMER_TAR_REG_OFFSET) > Match)
+        {
+            break;
+        }
+        SoftPwm_Write(Table, Table->edges[Edge].first, Table->edges[Edge].last);
+        Edge++;
+    }
+    SoftPwm_NextEdge = Edge;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file SoftPwm.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief SoftPwm file used for the software PWM of many DIO channels on one timer types and functions prototypes
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details All the channels share one period, split in Resolution duty steps. Every channel with a non zero
+ *          duty goes high at the period start and low after its duty, so a period only has the edges of the
+ *          distinct duties. They are kept in a table sorted by time where the channels falling together are
+ *          merged into one masked port write per port (Dio_MaskedWritePort, which keeps the DIO output shadow
+ *          coherent). Timer A of SOFTPWM_TIMER runs periodically over the period: its timeout starts a period
+ *          and its match register is moved from one edge group to the next, so a period costs one interrupt
+ *          per distinct duty plus one, whatever the number of channels. The duties are double buffered: a new
+ *          table is built in the caller's context and taken by the ISR at the next period start only.
+ */
+#ifndef SOFTPWM_H
+#define SOFTPWM_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define SOFTPWM_SW_MAJOR_VERSION           (1U)
+#define SOFTPWM_SW_MINOR_VERSION           (0U)
+#define SOFTPWM_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define SOFTPWM_AR_RELEASE_MAJOR_VERSION   (4U)
+#define SOFTPWM_AR_RELEASE_MINOR_VERSION   (6U)
+#define SOFTPWM_AR_RELEASE_PATCH_VERSION   (0U)
+
+/*
+ * Macros for SoftPwm Status
+ */
+#define SOFTPWM_INITIALIZED                (1U)
+#define SOFTPWM_NOT_INITIALIZED            (0U)
+
+#include "../Std_types.h"
+#include "../DIO/DIO.h"
+#include "SoftPwm_Cfg.h"
+
+/* AUTOSAR checking between Std Types and SoftPwm Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != SOFTPWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != SOFTPWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != SOFTPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* AUTOSAR Version checking between SoftPwm_Cfg.h and SoftPwm.h files */
+#if ((SOFTPWM_CFG_AR_RELEASE_MAJOR_VERSION != SOFTPWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SOFTPWM_CFG_AR_RELEASE_MINOR_VERSION != SOFTPWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (SOFTPWM_CFG_AR_RELEASE_PATCH_VERSION != SOFTPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of SoftPwm_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between SoftPwm_Cfg.h and SoftPwm.h files */
+#if ((SOFTPWM_CFG_SW_MAJOR_VERSION != SOFTPWM_SW_MAJOR_VERSION)\
+ ||  (SOFTPWM_CFG_SW_MINOR_VERSION != SOFTPWM_SW_MINOR_VERSION)\
+ ||  (SOFTPWM_CFG_SW_PATCH_VERSION != SOFTPWM_SW_PATCH_VERSION))
+  #error "The SW version of SoftPwm_Cfg.h does not match the expected version"
+#endif
+
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for SoftPwm Init */
+#define SOFTPWM_INIT_SID                   (uint8)0x00
+
+/* Service ID for SoftPwm Set Duty */
+#define SOFTPWM_SET_DUTY_SID               (uint8)0x01
+
+/* Service ID for SoftPwm Set Duties */
+#define SOFTPWM_SET_DUTIES_SID             (uint8)0x02
+
+/* Service ID for SoftPwm Stop */
+#define SOFTPWM_STOP_SID                   (uint8)0x03
+
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef uint8 SoftPwm_ChannelType;   /**< Index of a channel in the configuration set */
+typedef uint16 SoftPwm_DutyType;     /**< High time in duty steps: 0 (always low) .. Resolution (always high) */
+
+/**
+ * @brief Configuration of one channel.
+ *
+ */
+typedef struct
+{
+    Dio_ChannelType channel;   // DIO channel driven, Port_Init configures it as an output.
+    SoftPwm_DutyType duty;     // Duty applied by SoftPwm_Init.
+}SoftPwm_ChannelConfigType;
+
+/* Definition of the post-build configuration structure used by SoftPwm_Init.
+ * Member Channels holds ChannelCount channels (at most SOFTPWM_MAX_CHANNELS) indexed by SoftPwm_ChannelType.
+ * Member PeriodClocks is the period in system clocks, rounded down to a multiple of Resolution.
+ * Member Resolution is the number of duty steps of the period, a step lasts at least SOFTPWM_MIN_STEP_CLOCKS.
+ */
+typedef struct
+{
+    const SoftPwm_ChannelConfigType * Channels;
+    uint8 ChannelCount;
+    uint32 PeriodClocks;
+    uint16 Resolution;
+}SoftPwm_ConfigType;
+
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+/**
+ * @brief SoftPwm_Init is a service that builds the edge table of the configured duties and starts the timer.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          Dio_Init must have been called, the channels are resolved in its configuration set. The first period
+ *          starts at once. An invalid configuration set
+ *          leaves the module uninitialized.
+ *
+ * @param [in] ConfigPtr         Pointer to the post-build configuration set.
+ */
+void SoftPwm_Init (const SoftPwm_ConfigType* ConfigPtr);
+
+/**
+ * @brief SoftPwm_SetDuty is a service that changes the duty of one channel from the next period start.
+ *
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Asynchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          The edge table is rebuilt in the caller's context, the running period is not touched. Several
+ *          calls within one period are applied together; use SoftPwm_SetDuties to change many channels
+ *          with one rebuild.
+ *
+ * @param [in] Channel           Channel.
+ * @param [in] Duty              High time in duty steps.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or a parameter is invalid.
+ */
+Std_ReturnType SoftPwm_SetDuty (SoftPwm_ChannelType Channel, SoftPwm_DutyType Duty);
+
+/**
+ * @brief SoftPwm_SetDuties is a service that changes the duties of all the channels from the next period start.
+ *
+ * @details Service ID [hex] 0x02
+ *          Synchronous/Asynchronous: Asynchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] Duties            Duties of the ChannelCount channels, indexed by SoftPwm_ChannelType.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or a duty is invalid
+ *                               (no duty is changed then).
+ */
+Std_ReturnType SoftPwm_SetDuties (const SoftPwm_DutyType* Duties);
+
+/**
+ * @brief SoftPwm_Stop is a service that stops the timer and drives all the channels low.
+ *
+ * @details Service ID [hex] 0x03
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ */
+void SoftPwm_Stop (void);
+
+/* Timer A interrupt handler of SOFTPWM_TIMER, to be placed in the vector table (IRQ 35, 70 or 92 for timer 3, 4 or 5) */
+void SoftPwm_Timer_Isr (void);
+
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by SoftPwm and other modules */
+extern const SoftPwm_ConfigType SoftPwm_Configuration;
+
+#endif /* SOFTPWM_H */
@@ -0,0 +1,47 @@
+/**
+ * @file SoftPwm_Cfg.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - SoftPwm Driver
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef SOFTPWM_CFG_H
+#define SOFTPWM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define SOFTPWM_CFG_SW_MAJOR_VERSION              (1U)
+#define SOFTPWM_CFG_SW_MINOR_VERSION              (0U)
+#define SOFTPWM_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define SOFTPWM_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SOFTPWM_CFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define SOFTPWM_CFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* System clock frequency the period is computed for */
+#define SOFTPWM_SYSTEM_CLOCK_HZ                 (16000000UL)
+
+/* 16/32-bit timer whose timer A paces the edges (3, 4 or 5, timers 0..2 belong to the DIO pattern and capture) */
+#define SOFTPWM_TIMER                           (3U)
+
+/* Capacity of the edge tables, a configuration set may use up to this number of channels */
+#define SOFTPWM_MAX_CHANNELS                    (32U)
+
+/* Minimum system clocks of one duty step: the time left to the ISR between two edge groups */
+#define SOFTPWM_MIN_STEP_CLOCKS                 (400U)
+
+/* Number of channels of the configuration set */
+#define SOFTPWM_CONFIGURED_CHANNELS             (3U)
+
+/* Channels 0..2: heaters on PE2, PE3 and PF0 (DioConf_HEATER_<n>_CHANNEL_ID) */
+#define SoftPwmConf_HEATER_FIRST_CHANNEL        (0U)
+
+#endif /* SOFTPWM_CFG_H */
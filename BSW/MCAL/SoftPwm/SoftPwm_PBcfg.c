@@ -0,0 +1,58 @@
+/**
+ * @file SoftPwm_PBcfg.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Post Build Configuration Source file for TM4C123GH6PM Microcontroller - SoftPwm Driver
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "SoftPwm.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define SOFTPWM_PBCFG_SW_MAJOR_VERSION              (1U)
+#define SOFTPWM_PBCFG_SW_MINOR_VERSION              (0U)
+#define SOFTPWM_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define SOFTPWM_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SOFTPWM_PBCFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define SOFTPWM_PBCFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* AUTOSAR Version checking between SoftPwm_PBcfg.c and SoftPwm.h files */
+#if ((SOFTPWM_PBCFG_AR_RELEASE_MAJOR_VERSION != SOFTPWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SOFTPWM_PBCFG_AR_RELEASE_MINOR_VERSION != SOFTPWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (SOFTPWM_PBCFG_AR_RELEASE_PATCH_VERSION != SOFTPWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between SoftPwm_PBcfg.c and SoftPwm.h files */
+#if ((SOFTPWM_PBCFG_SW_MAJOR_VERSION != SOFTPWM_SW_MAJOR_VERSION)\
+ ||  (SOFTPWM_PBCFG_SW_MINOR_VERSION != SOFTPWM_SW_MINOR_VERSION)\
+ ||  (SOFTPWM_PBCFG_SW_PATCH_VERSION != SOFTPWM_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* Channels listed by their DIO channel IDs, all off until the application sets a duty. Port_PBcfg.c makes
+   their pins outputs */
+STATIC const SoftPwm_ChannelConfigType SoftPwm_Channels[SOFTPWM_CONFIGURED_CHANNELS] =
+{
+    { DioConf_HEATER_0_CHANNEL_ID, 0U }, { DioConf_HEATER_1_CHANNEL_ID, 0U }, { DioConf_HEATER_2_CHANNEL_ID, 0U }
+};
+
+/*Configuration structure that will be used by the SoftPwm driver: 200 Hz period of 100 duty steps
+  (800 clocks per step at 16 MHz).*/
+
+const SoftPwm_ConfigType SoftPwm_Configuration =
+{
+    SoftPwm_Channels,
+    SOFTPWM_CONFIGURED_CHANNELS,
+    SOFTPWM_SYSTEM_CLOCK_HZ / 200UL,
+    100U
+};
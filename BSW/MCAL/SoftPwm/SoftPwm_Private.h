@@ -0,0 +1,54 @@
+/**
+ * @file SoftPwm_Private.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief SoftPwm Private Registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef SOFTPWM_PRIVATE_H
+#define SOFTPWM_PRIVATE_H
+
+#include "../tm4c123gh6pm.h"
+#include "../Mcal_Reg.h"
+
+#if ((SOFTPWM_TIMER < 3U) || (SOFTPWM_TIMER > 5U))
+#error "SOFTPWM_TIMER must be 3, 4 or 5 (timers 0..2 belong to the DIO pattern generator and capture)"
+#endif
+
+/* Clock gating and peripheral ready registers of the timers */
+#define SOFTPWM_RCGCTIMER_REGISTER_ADDRESS    0x400FE604U
+#define SOFTPWM_PRTIMER_REGISTER_ADDRESS      0x400FEA04U
+
+/* Timer A registers of SOFTPWM_TIMER */
+#define SOFTPWM_TIMER_BASE_ADDRESS            (0x40030000U + ((uint32)SOFTPWM_TIMER * 0x1000U))
+#define SOFTPWM_TIMER_CFG_REG_OFFSET          0x000U
+#define SOFTPWM_TIMER_TAMR_REG_OFFSET         0x004U
+#define SOFTPWM_TIMER_CTL_REG_OFFSET          0x00CU
+#define SOFTPWM_TIMER_IMR_REG_OFFSET          0x018U
+#define SOFTPWM_TIMER_MIS_REG_OFFSET          0x020U
+#define SOFTPWM_TIMER_ICR_REG_OFFSET          0x024U
+#define SOFTPWM_TIMER_TAILR_REG_OFFSET        0x028U
+#define SOFTPWM_TIMER_TAMATCHR_REG_OFFSET     0x030U
+#define SOFTPWM_TIMER_TAR_REG_OFFSET          0x048U
+
+/* Timer A interrupt of SOFTPWM_TIMER and its NVIC set/clear enable registers */
+#define SOFTPWM_TIMER_IRQ                     ((SOFTPWM_TIMER == 3U) ? 35U : ((SOFTPWM_TIMER == 4U) ? 70U : 92U))
+#define SOFTPWM_NVIC_EN_REGISTER_ADDRESS      (0xE000E100U + ((SOFTPWM_TIMER_IRQ >> 5U) * 4U))
+#define SOFTPWM_NVIC_DIS_REGISTER_ADDRESS     (0xE000E180U + ((SOFTPWM_TIMER_IRQ >> 5U) * 4U))
+#define SOFTPWM_NVIC_BIT                      (1UL << (SOFTPWM_TIMER_IRQ & 31U))
+
+/* Match value the down counter never reaches (the period is below 2^32 clocks) */
+#define SOFTPWM_NO_MATCH                      0xFFFFFFFFU
+
+/* Read/Write a timer register */
+#define SOFTPWM_READ_REG(OFFSET)              MCAL_REG_READ32(SOFTPWM_TIMER_BASE_ADDRESS + (OFFSET))
+#define SOFTPWM_WRITE_REG(OFFSET, VALUE)      MCAL_REG_WRITE32(SOFTPWM_TIMER_BASE_ADDRESS + (OFFSET), VALUE)
+
+/* Keeps the compiler from moving the table stores after the store that publishes the table to the ISR */
+#define SOFTPWM_COMPILER_BARRIER()            __asm volatile ("" : : : "memory")
+
+#endif /* SOFTPWM_PRIVATE_H */
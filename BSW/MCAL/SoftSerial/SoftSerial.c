@@ -0,0 +1,481 @@
+/**
+ * @file SoftSerial.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief SoftSerial.c is the source file for SoftSerial.h file which contains the implementation of the functions.
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include "SoftSerial.h"
+#include "SoftSerial_Private.h"
+
+/* Resolved SPI bus */
+typedef struct
+{
+    uint32 sck_address;        // DATA aperture of SCK.
+    uint32 data_address;       // DATA aperture stored once per bit: MOSI and SCK when they share a port, MOSI alone otherwise.
+    uint32 miso_address;       // DATA aperture of MISO (mask 0, reading 0, for a write only bus).
+    uint32 data_values[2];     // Values stored to data_address for a 0 and a 1 bit.
+    uint32 sck_first;          // SCK level before the first half bit (written with the data when shared).
+    uint32 sck_second;         // SCK level of the second half bit, MISO is sampled right after it.
+    uint32 sck_idle;           // SCK level between the transfers.
+    boolean shared;            // SCK and MOSI on the same port.
+}SoftSerial_SpiBusType;
+
+/* Resolved open drain line */
+typedef struct
+{
+    uint32 data_address;       // DATA aperture of the pin, reads the line level while released.
+    uint32 dir_address;        // Bit-band alias of the GPIODIR bit of the pin.
+}SoftSerial_LineType;
+
+/* Resolved I2C bus */
+typedef struct
+{
+    SoftSerial_LineType scl;
+    SoftSerial_LineType sda;
+}SoftSerial_I2cBusType;
+
+STATIC SoftSerial_SpiBusType SoftSerial_SpiBuses[SOFTSERIAL_CONFIGURED_SPI_BUSES];
+STATIC SoftSerial_I2cBusType SoftSerial_I2cBuses[SOFTSERIAL_CONFIGURED_I2C_BUSES];
+STATIC SoftSerial_LineType SoftSerial_OneWireBuses[SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES];
+STATIC uint8 SoftSerial_Status = SOFTSERIAL_NOT_INITIALIZED;  /* SoftSerial Status */
+
+/* DATA aperture of channel ChannelId of DioConfig, the port base (mask 0) for SOFTSERIAL_NO_CHANNEL */
+STATIC uint32 SoftSerial_ChannelAddress(const Dio_ConfigType * DioConfig, Dio_ChannelType ChannelId, Dio_PortType PortId)
+{
+    if (ChannelId == SOFTSERIAL_NO_CHANNEL)
+    {
+        return DioConfig->PortBaseAddress[PortId];
+    }
+    return DioConfig->Channels[ChannelId].bits_address;
+}
+
+/* Resolves an open drain line on channel ChannelId of DioConfig: low latch, released */
+STATIC void SoftSerial_InitLine(const Dio_ConfigType * DioConfig, SoftSerial_LineType * Line, Dio_ChannelType ChannelId)
+{
+    const Dio_ChannelConfigType * Channel = &DioConfig->Channels[ChannelId];
+    uint32 Base = DioConfig->PortBaseAddress[Channel->port];
+
+    Line->data_address = Channel->bits_address;
+    Line->dir_address = SOFTSERIAL_BITBAND_ADDRESS(Base + SOFTSERIAL_DIR_REG_OFFSET, 31U - (uint32)__builtin_clz(Channel->mask));
+    SOFTSERIAL_LINE_RELEASE(Line->dir_address);
+    SOFTSERIAL_WRITE_REG(Line->data_address, 0U);
+}
+
+/*
+ * One SPI bit, BIT counted from the MSB: data (with the first clock level when SHARED), half bit, second clock
+ * edge, MISO sample, half bit. Expanded 8 times per byte with constant BIT and SHARED.
+ */
+#define SOFTSERIAL_SPI_BIT(BUS, TX, RX, BIT, SHARED)                                      \
+    do                                                                                    \
+    {                                                                                     \
+        SOFTSERIAL_WRITE_REG((BUS)->data_address, (BUS)->data_values[((TX) >> (BIT)) & 1U]); \
+        if ((SHARED) == FALSE)                                                            \
+        {                                                                                 \
+            SOFTSERIAL_WRITE_REG((BUS)->sck_address, (BUS)->sck_first);                   \
+        }                                                                                 \
+        SOFTSERIAL_DELAY(SOFTSERIAL_SPI_HALF_BIT_NS);                                     \
+        SOFTSERIAL_WRITE_REG((BUS)->sck_address, (BUS)->sck_second);                      \
+        (RX) |= (uint32)((SOFTSERIAL_READ_REG((BUS)->miso_address) != 0U) ? 1U : 0U) << (BIT); \
+        SOFTSERIAL_DELAY(SOFTSERIAL_SPI_HALF_BIT_NS);                                     \
+    } while (0)
+
+/* One SPI byte, Shared is a constant at every call so the expanded bits keep no test */
+LOCAL_INLINE uint8 SoftSerial_SpiByte(const SoftSerial_SpiBusType * Bus, uint32 Tx, boolean Shared)
+{
+    uint32 Rx = 0U;
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 7U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 6U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 5U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 4U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 3U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 2U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 1U, Shared);
+    SOFTSERIAL_SPI_BIT(Bus, Tx, Rx, 0U, Shared);
+    return (uint8)Rx;
+}
+
+/* Releases SCL and waits for it to read high when the slaves may stretch the clock */
+LOCAL_INLINE void SoftSerial_I2cSclHigh(const SoftSerial_I2cBusType * Bus)
+{
+    SOFTSERIAL_LINE_RELEASE(Bus->scl.dir_address);
+#if (SOFTSERIAL_I2C_CLOCK_STRETCHING == STD_ON)
+    {
+        uint32 Limit = SOFTSERIAL_I2C_STRETCH_LIMIT;
+        while ((SOFTSERIAL_READ_REG(Bus->scl.data_address) == 0U) && (Limit > 0U))
+        {
+            Limit--;
+        }
+    }
+#endif
+}
+
+/* One I2C bit written, SCL low on entry and on exit: the SDA direction is the inverted bit */
+#define SOFTSERIAL_I2C_WRITE_BIT(BUS, TX, BIT)                                            \
+    do                                                                                    \
+    {                                                                                     \
+        SOFTSERIAL_WRITE_REG((BUS)->sda.dir_address, (((TX) >> (BIT)) & 1U) ^ 1U);        \
+        SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);                                     \
+        SoftSerial_I2cSclHigh(BUS);                                                       \
+        SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);                                     \
+        SOFTSERIAL_LINE_LOW((BUS)->scl.dir_address);                                      \
+    } while (0)
+
+/* One I2C bit read, SDA released by the caller, SCL low on entry and on exit */
+#define SOFTSERIAL_I2C_READ_BIT(BUS, RX, BIT)                                             \
+    do                                                                                    \
+    {                                                                                     \
+        SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);                                     \
+        SoftSerial_I2cSclHigh(BUS);                                                       \
+        (RX) |= (uint32)((SOFTSERIAL_READ_REG((BUS)->sda.data_address) != 0U) ? 1U : 0U) << (BIT); \
+        SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);                                     \
+        SOFTSERIAL_LINE_LOW((BUS)->scl.dir_address);                                      \
+    } while (0)
+
+/* Start (or repeated start) condition, leaves SCL and SDA low */
+STATIC void SoftSerial_I2cStart(const SoftSerial_I2cBusType * Bus)
+{
+    SOFTSERIAL_LINE_RELEASE(Bus->sda.dir_address);
+    SoftSerial_I2cSclHigh(Bus);
+    SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);
+    SOFTSERIAL_LINE_LOW(Bus->sda.dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);
+    SOFTSERIAL_LINE_LOW(Bus->scl.dir_address);
+}
+
+/* Stop condition, leaves the bus idle */
+STATIC void SoftSerial_I2cStop(const SoftSerial_I2cBusType * Bus)
+{
+    SOFTSERIAL_LINE_LOW(Bus->sda.dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);
+    SoftSerial_I2cSclHigh(Bus);
+    SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);
+    SOFTSERIAL_LINE_RELEASE(Bus->sda.dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_I2C_HALF_BIT_NS);
+}
+
+/* Writes one byte, returns TRUE when the slave acknowledged it */
+STATIC boolean SoftSerial_I2cWriteByte(const SoftSerial_I2cBusType * Bus, uint32 Tx)
+{
+    uint32 Nack = 0U;
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 7U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 6U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 5U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 4U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 3U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 2U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 1U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, Tx, 0U);
+    SOFTSERIAL_LINE_RELEASE(Bus->sda.dir_address);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Nack, 0U);
+    return (Nack == 0U) ? TRUE : FALSE;
+}
+
+/* Reads one byte and acknowledges it unless it is the last one */
+STATIC uint8 SoftSerial_I2cReadByte(const SoftSerial_I2cBusType * Bus, boolean Last)
+{
+    uint32 Rx = 0U;
+    SOFTSERIAL_LINE_RELEASE(Bus->sda.dir_address);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 7U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 6U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 5U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 4U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 3U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 2U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 1U);
+    SOFTSERIAL_I2C_READ_BIT(Bus, Rx, 0U);
+    SOFTSERIAL_I2C_WRITE_BIT(Bus, (Last == TRUE) ? 1U : 0U, 0U);
+    return (uint8)Rx;
+}
+
+/* One 1-Wire write slot, the line is low only for the time of the bit */
+STATIC void SoftSerial_OneWireWriteBit(const SoftSerial_LineType * Line, uint32 Bit)
+{
+    uint32 Primask = SoftSerial_SuspendInterrupts();
+    SOFTSERIAL_LINE_LOW(Line->dir_address);
+    if (Bit != 0U)
+    {
+        SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_WRITE1_LOW_NS);
+        SOFTSERIAL_LINE_RELEASE(Line->dir_address);
+        SoftSerial_ResumeInterrupts(Primask);
+        SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_WRITE1_HIGH_NS);
+    }
+    else
+    {
+        SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_WRITE0_LOW_NS);
+        SOFTSERIAL_LINE_RELEASE(Line->dir_address);
+        SoftSerial_ResumeInterrupts(Primask);
+        SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_WRITE0_HIGH_NS);
+    }
+}
+
+/* One 1-Wire read slot, the line is sampled before the slave releases it */
+STATIC uint32 SoftSerial_OneWireReadBit(const SoftSerial_LineType * Line)
+{
+    uint32 Primask = SoftSerial_SuspendInterrupts();
+    uint32 Bit;
+    SOFTSERIAL_LINE_LOW(Line->dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_READ_LOW_NS);
+    SOFTSERIAL_LINE_RELEASE(Line->dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_READ_SAMPLE_NS);
+    Bit = (SOFTSERIAL_READ_REG(Line->data_address) != 0U) ? 1U : 0U;
+    SoftSerial_ResumeInterrupts(Primask);
+    SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_READ_REST_NS);
+    return Bit;
+}
+
+/**
+ * @brief SoftSerial_Init is a service that resolves the bus pins and puts every bus in its idle state.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ * @param [in] ConfigPtr         Pointer to the post-build configuration set.
+ */
+void SoftSerial_Init (const SoftSerial_ConfigType* ConfigPtr){
+    const Dio_ConfigType * DioConfig = Dio_GetConfig();
+    uint8 Index;
+
+    if ((ConfigPtr == NULL_PTR) || (DioConfig == NULL_PTR))
+    {
+        return;
+    }
+    for (Index = 0U; Index < SOFTSERIAL_CONFIGURED_SPI_BUSES; Index++)
+    {
+        const SoftSerial_SpiConfigType * Config = &ConfigPtr->SpiBuses[Index];
+        SoftSerial_SpiBusType * Bus = &SoftSerial_SpiBuses[Index];
+        const Dio_ChannelConfigType * Sck = &DioConfig->Channels[Config->sck];
+        uint32 Idle = (Config->polarity == SOFTSERIAL_CPOL_HIGH) ? Sck->mask : 0U;
+        uint32 Active = Sck->mask ^ Idle;
+        uint32 MosiMask = (Config->mosi == SOFTSERIAL_NO_CHANNEL) ? 0U : DioConfig->Channels[Config->mosi].mask;
+
+        /* CPHA = 0 samples on the leading edge, CPHA = 1 changes the data on it and samples on the trailing one */
+        Bus->sck_idle = Idle;
+        Bus->sck_first = (Config->phase == SOFTSERIAL_CPHA_LEADING) ? Idle : Active;
+        Bus->sck_second = (Config->phase == SOFTSERIAL_CPHA_LEADING) ? Active : Idle;
+        Bus->sck_address = Sck->bits_address;
+        Bus->miso_address = SoftSerial_ChannelAddress(DioConfig, Config->miso, Sck->port);
+        Bus->shared = ((Config->mosi == SOFTSERIAL_NO_CHANNEL)
+                       || (DioConfig->Channels[Config->mosi].port == Sck->port)) ? TRUE : FALSE;
+        if (Bus->shared == TRUE)
+        {
+            Bus->data_address = SOFTSERIAL_DATA_BITS_ADDRESS(DioConfig->PortBaseAddress[Sck->port], Sck->mask | MosiMask);
+            Bus->data_values[0] = Bus->sck_first;
+            Bus->data_values[1] = Bus->sck_first | MosiMask;
+        }
+        else
+        {
+            Bus->data_address = DioConfig->Channels[Config->mosi].bits_address;
+            Bus->data_values[0] = 0U;
+            Bus->data_values[1] = MosiMask;
+        }
+        SOFTSERIAL_WRITE_REG(Bus->sck_address, Idle);
+        SOFTSERIAL_WRITE_REG(SoftSerial_ChannelAddress(DioConfig, Config->mosi, Sck->port), 0U);
+    }
+    for (Index = 0U; Index < SOFTSERIAL_CONFIGURED_I2C_BUSES; Index++)
+    {
+        SoftSerial_InitLine(DioConfig, &SoftSerial_I2cBuses[Index].scl, ConfigPtr->I2cBuses[Index].scl);
+        SoftSerial_InitLine(DioConfig, &SoftSerial_I2cBuses[Index].sda, ConfigPtr->I2cBuses[Index].sda);
+    }
+    for (Index = 0U; Index < SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES; Index++)
+    {
+        SoftSerial_InitLine(DioConfig, &SoftSerial_OneWireBuses[Index], ConfigPtr->OneWireBuses[Index].dq);
+    }
+    SoftSerial_Status = SOFTSERIAL_INITIALIZED;
+}
+
+/**
+ * @brief SoftSerial_SpiTransfer is a service that shifts bytes out and in on an SPI bus at the same time.
+ *
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               SPI bus.
+ * @param [in] TxData            Bytes sent, NULL_PTR to send 0xFF.
+ * @param [out] RxData           Bytes received, NULL_PTR to discard them.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or the bus is invalid.
+ */
+Std_ReturnType SoftSerial_SpiTransfer (SoftSerial_BusType Bus, const uint8* TxData, uint8* RxData, uint16 Length){
+    const SoftSerial_SpiBusType * SpiBus;
+    uint16 Index;
+
+    if ((SoftSerial_Status != SOFTSERIAL_INITIALIZED) || (Bus >= SOFTSERIAL_CONFIGURED_SPI_BUSES))
+    {
+        return E_NOT_OK;
+    }
+    SpiBus = &SoftSerial_SpiBuses[Bus];
+    for (Index = 0U; Index < Length; Index++)
+    {
+        uint32 Tx = (TxData != NULL_PTR) ? TxData[Index] : 0xFFU;
+        uint8 Rx = (SpiBus->shared == TRUE) ? SoftSerial_SpiByte(SpiBus, Tx, TRUE) : SoftSerial_SpiByte(SpiBus, Tx, FALSE);
+        if (RxData != NULL_PTR)
+        {
+            RxData[Index] = Rx;
+        }
+    }
+    SOFTSERIAL_WRITE_REG(SpiBus->sck_address, SpiBus->sck_idle);
+    return E_OK;
+}
+
+/**
+ * @brief SoftSerial_I2cWriteRead is a service that runs one I2C transaction: write then read with a repeated start.
+ *
+ * @details Service ID [hex] 0x02
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               I2C bus.
+ * @param [in] Address           7-bit slave address.
+ * @param [in] TxData            Bytes written.
+ * @param [in] TxLength          Number of bytes written.
+ * @param [out] RxData           Bytes read.
+ * @param [in] RxLength          Number of bytes read.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the slave did not acknowledge a byte written (the
+ *                               transaction is then stopped) or when the request is invalid.
+ */
+Std_ReturnType SoftSerial_I2cWriteRead (SoftSerial_BusType Bus, uint8 Address, const uint8* TxData, uint16 TxLength,
+                                        uint8* RxData, uint16 RxLength){
+    const SoftSerial_I2cBusType * I2cBus;
+    Std_ReturnType Result = E_OK;
+    uint16 Index;
+
+    if ((SoftSerial_Status != SOFTSERIAL_INITIALIZED) || (Bus >= SOFTSERIAL_CONFIGURED_I2C_BUSES)
+        || ((TxLength != 0U) && (TxData == NULL_PTR)) || ((RxLength != 0U) && (RxData == NULL_PTR))
+        || ((TxLength == 0U) && (RxLength == 0U)))
+    {
+        return E_NOT_OK;
+    }
+    I2cBus = &SoftSerial_I2cBuses[Bus];
+
+    if (TxLength != 0U)
+    {
+        SoftSerial_I2cStart(I2cBus);
+        if (SoftSerial_I2cWriteByte(I2cBus, (uint32)Address << 1U) == FALSE)
+        {
+            Result = E_NOT_OK;
+        }
+        for (Index = 0U; (Index < TxLength) && (Result == E_OK); Index++)
+        {
+            if (SoftSerial_I2cWriteByte(I2cBus, TxData[Index]) == FALSE)
+            {
+                Result = E_NOT_OK;
+            }
+        }
+    }
+    if ((RxLength != 0U) && (Result == E_OK))
+    {
+        SoftSerial_I2cStart(I2cBus);
+        if (SoftSerial_I2cWriteByte(I2cBus, ((uint32)Address << 1U) | 1U) == FALSE)
+        {
+            Result = E_NOT_OK;
+        }
+        for (Index = 0U; (Index < RxLength) && (Result == E_OK); Index++)
+        {
+            RxData[Index] = SoftSerial_I2cReadByte(I2cBus, (Index == (RxLength - 1U)) ? TRUE : FALSE);
+        }
+    }
+    SoftSerial_I2cStop(I2cBus);
+    return Result;
+}
+
+/**
+ * @brief SoftSerial_OneWireReset is a service that sends a 1-Wire reset pulse and detects a presence pulse.
+ *
+ * @details Service ID [hex] 0x03
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               1-Wire bus.
+ * @return Std_ReturnType        E_OK when a device answered, E_NOT_OK otherwise.
+ */
+Std_ReturnType SoftSerial_OneWireReset (SoftSerial_BusType Bus){
+    const SoftSerial_LineType * Line;
+    uint32 Primask;
+    uint32 Presence;
+
+    if ((SoftSerial_Status != SOFTSERIAL_INITIALIZED) || (Bus >= SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES))
+    {
+        return E_NOT_OK;
+    }
+    Line = &SoftSerial_OneWireBuses[Bus];
+    SOFTSERIAL_LINE_LOW(Line->dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_RESET_LOW_NS);
+    Primask = SoftSerial_SuspendInterrupts();
+    SOFTSERIAL_LINE_RELEASE(Line->dir_address);
+    SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_PRESENCE_NS);
+    Presence = SOFTSERIAL_READ_REG(Line->data_address);
+    SoftSerial_ResumeInterrupts(Primask);
+    SOFTSERIAL_DELAY(SOFTSERIAL_ONE_WIRE_RESET_REST_NS);
+    return (Presence == 0U) ? E_OK : E_NOT_OK;
+}
+
+/**
+ * @brief SoftSerial_OneWireWrite is a service that writes bytes on a 1-Wire bus, LSB first.
+ *
+ * @details Service ID [hex] 0x04
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               1-Wire bus.
+ * @param [in] Data              Bytes written.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or the bus is invalid.
+ */
+Std_ReturnType SoftSerial_OneWireWrite (SoftSerial_BusType Bus, const uint8* Data, uint16 Length){
+    uint16 Index;
+    uint8 Bit;
+
+    if ((SoftSerial_Status != SOFTSERIAL_INITIALIZED) || (Bus >= SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES)
+        || (Data == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    /* A slot lasts tens of microseconds, unrolling the bits would gain nothing */
+    for (Index = 0U; Index < Length; Index++)
+    {
+        for (Bit = 0U; Bit < 8U; Bit++)
+        {
+            SoftSerial_OneWireWriteBit(&SoftSerial_OneWireBuses[Bus], ((uint32)Data[Index] >> Bit) & 1U);
+        }
+    }
+    return E_OK;
+}
+
+/**
+ * @brief SoftSerial_OneWireRead is a service that reads bytes from a 1-Wire bus, LSB first.
+ *
+ * @details Service ID [hex] 0x05
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               1-Wire bus.
+ * @param [out] Data             Bytes read.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or the bus is invalid.
+ */
+Std_ReturnType SoftSerial_OneWireRead (SoftSerial_BusType Bus, uint8* Data, uint16 Length){
+    uint16 Index;
+    uint8 Bit;
+
+    if ((SoftSerial_Status != SOFTSERIAL_INITIALIZED) || (Bus >= SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES)
+        || (Data == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+    for (Index = 0U; Index < Length; Index++)
+    {
+        uint32 Byte = 0U;
+        for (Bit = 0U; Bit < 8U; Bit++)
+        {
+            Byte |= SoftSerial_OneWireReadBit(&SoftSerial_OneWireBuses[Bus]) << Bit;
+        }
+        Data[Index] = (uint8)Byte;
+    }
+    return E_OK;
+}
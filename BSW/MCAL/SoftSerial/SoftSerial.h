@@ -0,0 +1,269 @@
+/**
+ * @file SoftSerial.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief SoftSerial file used for the software (bit-banged) SPI, I2C and 1-Wire buses types and functions prototypes
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details The buses run on DIO channels that cannot be muxed to a hardware SSI/I2C. The pins are reached
+ *          through the masked DATA apertures resolved by the DIO configuration, so every pin change is one
+ *          store and every sample is one load, and the bit loops are unrolled. I2C and 1-Wire lines are
+ *          open drain: their DATA latch stays low and the line is pulled low by setting its direction to
+ *          output through the bit-band alias of GPIODIR, released by setting it back to input.
+ */
+#ifndef SOFTSERIAL_H
+#define SOFTSERIAL_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define SOFTSERIAL_SW_MAJOR_VERSION           (1U)
+#define SOFTSERIAL_SW_MINOR_VERSION           (0U)
+#define SOFTSERIAL_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define SOFTSERIAL_AR_RELEASE_MAJOR_VERSION   (4U)
+#define SOFTSERIAL_AR_RELEASE_MINOR_VERSION   (6U)
+#define SOFTSERIAL_AR_RELEASE_PATCH_VERSION   (0U)
+
+/*
+ * Macros for SoftSerial Status
+ */
+#define SOFTSERIAL_INITIALIZED                (1U)
+#define SOFTSERIAL_NOT_INITIALIZED            (0U)
+
+/*
+ * Timing profiles, selected at compile time with SOFTSERIAL_TIMING_PROFILE
+ */
+#define SOFTSERIAL_PROFILE_STANDARD           (0U)   /* SPI 250 kHz, I2C standard mode 100 kHz, 1-Wire standard speed */
+#define SOFTSERIAL_PROFILE_FAST               (1U)   /* SPI 1 MHz, I2C fast mode 400 kHz, 1-Wire overdrive speed */
+#define SOFTSERIAL_PROFILE_MAX                (2U)   /* SPI and I2C as fast as the pin accesses go, 1-Wire overdrive speed */
+
+#include "../Std_types.h"
+#include "../DIO/DIO.h"
+#include "SoftSerial_Cfg.h"
+
+/* AUTOSAR checking between Std Types and SoftSerial Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != SOFTSERIAL_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != SOFTSERIAL_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != SOFTSERIAL_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* AUTOSAR Version checking between SoftSerial_Cfg.h and SoftSerial.h files */
+#if ((SOFTSERIAL_CFG_AR_RELEASE_MAJOR_VERSION != SOFTSERIAL_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SOFTSERIAL_CFG_AR_RELEASE_MINOR_VERSION != SOFTSERIAL_AR_RELEASE_MINOR_VERSION)\
+ ||  (SOFTSERIAL_CFG_AR_RELEASE_PATCH_VERSION != SOFTSERIAL_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of SoftSerial_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between SoftSerial_Cfg.h and SoftSerial.h files */
+#if ((SOFTSERIAL_CFG_SW_MAJOR_VERSION != SOFTSERIAL_SW_MAJOR_VERSION)\
+ ||  (SOFTSERIAL_CFG_SW_MINOR_VERSION != SOFTSERIAL_SW_MINOR_VERSION)\
+ ||  (SOFTSERIAL_CFG_SW_PATCH_VERSION != SOFTSERIAL_SW_PATCH_VERSION))
+  #error "The SW version of SoftSerial_Cfg.h does not match the expected version"
+#endif
+
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for SoftSerial Init */
+#define SOFTSERIAL_INIT_SID                   (uint8)0x00
+
+/* Service ID for SoftSerial SPI Transfer */
+#define SOFTSERIAL_SPI_TRANSFER_SID           (uint8)0x01
+
+/* Service ID for SoftSerial I2C Write Read */
+#define SOFTSERIAL_I2C_WRITE_READ_SID         (uint8)0x02
+
+/* Service ID for SoftSerial 1-Wire Reset */
+#define SOFTSERIAL_ONE_WIRE_RESET_SID         (uint8)0x03
+
+/* Service ID for SoftSerial 1-Wire Write */
+#define SOFTSERIAL_ONE_WIRE_WRITE_SID         (uint8)0x04
+
+/* Service ID for SoftSerial 1-Wire Read */
+#define SOFTSERIAL_ONE_WIRE_READ_SID          (uint8)0x05
+
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+typedef uint8 SoftSerial_BusType;  /**< Index of a bus among the configured buses of its kind */
+
+/* Enum to hold the idle level of the SPI clock */
+typedef enum
+{
+    SOFTSERIAL_CPOL_LOW,    //!< 0x00 SCK idles low (CPOL = 0).
+    SOFTSERIAL_CPOL_HIGH    //!< 0x01 SCK idles high (CPOL = 1).
+}SoftSerial_ClockPolarityType;
+
+/* Enum to hold the SPI clock edge on which the data is sampled */
+typedef enum
+{
+    SOFTSERIAL_CPHA_LEADING,   //!< 0x00 Data sampled on the leading clock edge, changed on the trailing one (CPHA = 0).
+    SOFTSERIAL_CPHA_TRAILING   //!< 0x01 Data changed on the leading clock edge, sampled on the trailing one (CPHA = 1).
+}SoftSerial_ClockPhaseType;
+
+/* Channel ID of an unused SPI data line (write only or read only bus) */
+#define SOFTSERIAL_NO_CHANNEL                 (0xFFU)
+
+/**
+ * @brief Configuration of one SPI bus, MSB first, the chip selects are DIO channels driven by the application.
+ *
+ */
+typedef struct
+{
+    Dio_ChannelType sck;                     // Clock output.
+    Dio_ChannelType mosi;                    // Data output, SOFTSERIAL_NO_CHANNEL for a read only bus.
+    Dio_ChannelType miso;                    // Data input, SOFTSERIAL_NO_CHANNEL for a write only bus.
+    SoftSerial_ClockPolarityType polarity;   // Idle level of SCK.
+    SoftSerial_ClockPhaseType phase;         // Sampling edge.
+}SoftSerial_SpiConfigType;
+
+/**
+ * @brief Configuration of one I2C bus (single master), both lines open drain with pull-ups.
+ *
+ */
+typedef struct
+{
+    Dio_ChannelType scl;  // Clock line.
+    Dio_ChannelType sda;  // Data line.
+}SoftSerial_I2cConfigType;
+
+/**
+ * @brief Configuration of one 1-Wire bus, the line is open drain with a pull-up.
+ *
+ */
+typedef struct
+{
+    Dio_ChannelType dq;  // Data line.
+}SoftSerial_OneWireConfigType;
+
+/* Definition of the post-build configuration structure used by SoftSerial_Init.
+ * Member SpiBuses holds the SPI buses indexed by the SoftSerialConf_<NAME>_SPI_BUS symbols.
+ * Member I2cBuses holds the I2C buses indexed by the SoftSerialConf_<NAME>_I2C_BUS symbols.
+ * Member OneWireBuses holds the 1-Wire buses indexed by the SoftSerialConf_<NAME>_ONE_WIRE_BUS symbols.
+ */
+typedef struct
+{
+    SoftSerial_SpiConfigType SpiBuses[SOFTSERIAL_CONFIGURED_SPI_BUSES];
+    SoftSerial_I2cConfigType I2cBuses[SOFTSERIAL_CONFIGURED_I2C_BUSES];
+    SoftSerial_OneWireConfigType OneWireBuses[SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES];
+}SoftSerial_ConfigType;
+
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+/**
+ * @brief SoftSerial_Init is a service that resolves the bus pins and puts every bus in its idle state.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          The pins take their addresses from the DIO configuration set Dio_Init was called with, so Dio_Init
+ *          must have been called. Port_Init must have configured the SPI clock and output pins as outputs and
+ *          the I2C/1-Wire lines as inputs with a changeable direction.
+ *
+ * @param [in] ConfigPtr         Pointer to the post-build configuration set.
+ */
+void SoftSerial_Init (const SoftSerial_ConfigType* ConfigPtr);
+
+/**
+ * @brief SoftSerial_SpiTransfer is a service that shifts bytes out and in on an SPI bus at the same time.
+ *
+ * @details Service ID [hex] 0x01
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ *          When SCK and MOSI are on the same port the data and the clock edge that goes with it are
+ *          written with one store, so a bit costs two stores and one load.
+ *
+ * @param [in] Bus               SPI bus.
+ * @param [in] TxData            Bytes sent, NULL_PTR to send 0xFF.
+ * @param [out] RxData           Bytes received, NULL_PTR to discard them.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or the bus is invalid.
+ */
+Std_ReturnType SoftSerial_SpiTransfer (SoftSerial_BusType Bus, const uint8* TxData, uint8* RxData, uint16 Length);
+
+/**
+ * @brief SoftSerial_I2cWriteRead is a service that runs one I2C transaction: write then read with a repeated start.
+ *
+ * @details Service ID [hex] 0x02
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ *          TxLength = 0 makes a read only transaction and RxLength = 0 a write only one. The last byte read
+ *          is not acknowledged, the transaction always ends with a stop condition.
+ *
+ * @param [in] Bus               I2C bus.
+ * @param [in] Address           7-bit slave address.
+ * @param [in] TxData            Bytes written.
+ * @param [in] TxLength          Number of bytes written.
+ * @param [out] RxData           Bytes read.
+ * @param [in] RxLength          Number of bytes read.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the slave did not acknowledge a byte written (the
+ *                               transaction is then stopped) or when the request is invalid.
+ */
+Std_ReturnType SoftSerial_I2cWriteRead (SoftSerial_BusType Bus, uint8 Address, const uint8* TxData, uint16 TxLength,
+                                        uint8* RxData, uint16 RxLength);
+
+/**
+ * @brief SoftSerial_OneWireReset is a service that sends a 1-Wire reset pulse and detects a presence pulse.
+ *
+ * @details Service ID [hex] 0x03
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               1-Wire bus.
+ * @return Std_ReturnType        E_OK when a device answered, E_NOT_OK otherwise.
+ */
+Std_ReturnType SoftSerial_OneWireReset (SoftSerial_BusType Bus);
+
+/**
+ * @brief SoftSerial_OneWireWrite is a service that writes bytes on a 1-Wire bus, LSB first.
+ *
+ * @details Service ID [hex] 0x04
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ *          The interrupts are masked during the timing critical part of each slot only.
+ *
+ * @param [in] Bus               1-Wire bus.
+ * @param [in] Data              Bytes written.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or the bus is invalid.
+ */
+Std_ReturnType SoftSerial_OneWireWrite (SoftSerial_BusType Bus, const uint8* Data, uint16 Length);
+
+/**
+ * @brief SoftSerial_OneWireRead is a service that reads bytes from a 1-Wire bus, LSB first.
+ *
+ * @details Service ID [hex] 0x05
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant for the same bus
+ *
+ * @param [in] Bus               1-Wire bus.
+ * @param [out] Data             Bytes read.
+ * @param [in] Length            Number of bytes.
+ * @return Std_ReturnType        E_OK, E_NOT_OK when the module is not initialized or the bus is invalid.
+ */
+Std_ReturnType SoftSerial_OneWireRead (SoftSerial_BusType Bus, uint8* Data, uint16 Length);
+
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by SoftSerial and other modules */
+extern const SoftSerial_ConfigType SoftSerial_Configuration;
+
+#endif /* SOFTSERIAL_H */
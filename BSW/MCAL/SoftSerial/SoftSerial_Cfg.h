@@ -0,0 +1,59 @@
+/**
+ * @file SoftSerial_Cfg.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - SoftSerial Driver
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef SOFTSERIAL_CFG_H
+#define SOFTSERIAL_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define SOFTSERIAL_CFG_SW_MAJOR_VERSION              (1U)
+#define SOFTSERIAL_CFG_SW_MINOR_VERSION              (0U)
+#define SOFTSERIAL_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define SOFTSERIAL_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SOFTSERIAL_CFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define SOFTSERIAL_CFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* System clock frequency the bit timings are computed for */
+#define SOFTSERIAL_SYSTEM_CLOCK_HZ                 (16000000UL)
+
+/* Timing profile of all the buses: SOFTSERIAL_PROFILE_STANDARD, SOFTSERIAL_PROFILE_FAST or SOFTSERIAL_PROFILE_MAX */
+#define SOFTSERIAL_TIMING_PROFILE                  SOFTSERIAL_PROFILE_STANDARD
+
+/* Pre-compile option to wait for the slaves that stretch the I2C clock */
+#define SOFTSERIAL_I2C_CLOCK_STRETCHING            (STD_OFF)
+
+/* Maximum number of SCL reads while a slave stretches the clock */
+#define SOFTSERIAL_I2C_STRETCH_LIMIT               (1000U)
+
+/* Number of SPI buses */
+#define SOFTSERIAL_CONFIGURED_SPI_BUSES            (1U)
+
+/* SPI bus 0: serial flash on PD0 (SCK), PD3 (MOSI), PD2 (MISO), mode 0 */
+#define SoftSerialConf_FLASH_SPI_BUS               (0U)
+
+/* Number of I2C buses */
+#define SOFTSERIAL_CONFIGURED_I2C_BUSES            (1U)
+
+/* I2C bus 0: EEPROM on PA2 (SCL), PA3 (SDA) */
+#define SoftSerialConf_EEPROM_I2C_BUS              (0U)
+
+/* Number of 1-Wire buses */
+#define SOFTSERIAL_CONFIGURED_ONE_WIRE_BUSES       (1U)
+
+/* 1-Wire bus 0: temperature sensor on PA4 */
+#define SoftSerialConf_TEMPERATURE_ONE_WIRE_BUS    (0U)
+
+#endif /* SOFTSERIAL_CFG_H */
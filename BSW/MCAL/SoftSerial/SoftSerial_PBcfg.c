@@ -0,0 +1,57 @@
+/**
+ * @file SoftSerial_PBcfg.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Post Build Configuration Source file for TM4C123GH6PM Microcontroller - SoftSerial Driver
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#include "SoftSerial.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define SOFTSERIAL_PBCFG_SW_MAJOR_VERSION              (1U)
+#define SOFTSERIAL_PBCFG_SW_MINOR_VERSION              (0U)
+#define SOFTSERIAL_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define SOFTSERIAL_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define SOFTSERIAL_PBCFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define SOFTSERIAL_PBCFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* AUTOSAR Version checking between SoftSerial_PBcfg.c and SoftSerial.h files */
+#if ((SOFTSERIAL_PBCFG_AR_RELEASE_MAJOR_VERSION != SOFTSERIAL_AR_RELEASE_MAJOR_VERSION)\
+ ||  (SOFTSERIAL_PBCFG_AR_RELEASE_MINOR_VERSION != SOFTSERIAL_AR_RELEASE_MINOR_VERSION)\
+ ||  (SOFTSERIAL_PBCFG_AR_RELEASE_PATCH_VERSION != SOFTSERIAL_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between SoftSerial_PBcfg.c and SoftSerial.h files */
+#if ((SOFTSERIAL_PBCFG_SW_MAJOR_VERSION != SOFTSERIAL_SW_MAJOR_VERSION)\
+ ||  (SOFTSERIAL_PBCFG_SW_MINOR_VERSION != SOFTSERIAL_SW_MINOR_VERSION)\
+ ||  (SOFTSERIAL_PBCFG_SW_PATCH_VERSION != SOFTSERIAL_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/*Configuration structure that will be used by the SoftSerial driver, every bus is listed
+  by the DIO channel IDs of its pins and resolved to pin addresses by SoftSerial_Init.*/
+
+const SoftSerial_ConfigType SoftSerial_Configuration =
+{
+    {
+        { DioConf_SOFT_SPI_SCK_CHANNEL_ID, DioConf_SOFT_SPI_MOSI_CHANNEL_ID, DioConf_SOFT_SPI_MISO_CHANNEL_ID,
+          SOFTSERIAL_CPOL_LOW, SOFTSERIAL_CPHA_LEADING }
+    },
+    {
+        { DioConf_SOFT_I2C_SCL_CHANNEL_ID, DioConf_SOFT_I2C_SDA_CHANNEL_ID }
+    },
+    {
+        { DioConf_ONE_WIRE_DQ_CHANNEL_ID }
+    }
+};
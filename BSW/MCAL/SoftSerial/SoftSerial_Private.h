@@ -0,0 +1,113 @@
+/**
+ * @file SoftSerial_Private.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief SoftSerial Private Registers and bit timings
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef SOFTSERIAL_PRIVATE_H
+#define SOFTSERIAL_PRIVATE_H
+
+#include "../Mcal_Reg.h"
+
+/* DATA register offset of the whole port and GPIODIR offset */
+#define SOFTSERIAL_DATA_REG_OFFSET           0x3FCU
+#define SOFTSERIAL_DIR_REG_OFFSET            0x400U
+
+/* Address of the DATA register aperture that only reaches the pins set in MASK (mask 0 reads 0 and ignores stores) */
+#define SOFTSERIAL_DATA_BITS_ADDRESS(BASE, MASK) ((BASE) + ((uint32)(MASK) << 2U))
+
+/* Address of the bit-band alias word of bit BIT of the peripheral register at ADDRESS */
+#define SOFTSERIAL_BITBAND_ADDRESS(ADDRESS, BIT)                      \
+    (0x42000000U + (((ADDRESS) - 0x40000000U) << 5U) + ((uint32)(BIT) << 2U))
+
+/* Read/Write a GPIO register through its absolute address */
+#define SOFTSERIAL_READ_REG(ADDRESS)         MCAL_REG_READ32(ADDRESS)
+#define SOFTSERIAL_WRITE_REG(ADDRESS, VALUE) MCAL_REG_WRITE32(ADDRESS, VALUE)
+
+/* Open drain line through the bit-band alias of its GPIODIR bit: output drives the low latch, input releases */
+#define SOFTSERIAL_LINE_LOW(DIR_ADDRESS)     SOFTSERIAL_WRITE_REG(DIR_ADDRESS, 1U)
+#define SOFTSERIAL_LINE_RELEASE(DIR_ADDRESS) SOFTSERIAL_WRITE_REG(DIR_ADDRESS, 0U)
+
+/* System clocks of NS nanoseconds, rounded down */
+#define SOFTSERIAL_CYCLES(NS)                ((uint32)(((uint32)(NS) * (SOFTSERIAL_SYSTEM_CLOCK_HZ / 1000000UL)) / 1000UL))
+
+/* Busy wait of NS nanoseconds, nothing is generated for a zero delay */
+#define SOFTSERIAL_DELAY(NS)                                          \
+    do                                                                \
+    {                                                                 \
+        if (SOFTSERIAL_CYCLES(NS) != 0U)                              \
+        {                                                             \
+            MCAL_DELAY_CYCLES(SOFTSERIAL_CYCLES(NS));                 \
+        }                                                             \
+    } while (0)
+
+/*
+ * Half bit times of the timing profiles (nanoseconds), the pin accesses between two delays add to them.
+ * 1-Wire slot timings follow the standard and overdrive speeds of the 1-Wire specification.
+ */
+#if (SOFTSERIAL_TIMING_PROFILE == SOFTSERIAL_PROFILE_STANDARD)
+#define SOFTSERIAL_SPI_HALF_BIT_NS           (2000U)
+#define SOFTSERIAL_I2C_HALF_BIT_NS           (5000U)
+#define SOFTSERIAL_ONE_WIRE_OVERDRIVE        (STD_OFF)
+#elif (SOFTSERIAL_TIMING_PROFILE == SOFTSERIAL_PROFILE_FAST)
+#define SOFTSERIAL_SPI_HALF_BIT_NS           (500U)
+#define SOFTSERIAL_I2C_HALF_BIT_NS           (1250U)
+#define SOFTSERIAL_ONE_WIRE_OVERDRIVE        (STD_ON)
+#elif (SOFTSERIAL_TIMING_PROFILE == SOFTSERIAL_PROFILE_MAX)
+#define SOFTSERIAL_SPI_HALF_BIT_NS           (0U)
+#define SOFTSERIAL_I2C_HALF_BIT_NS           (0U)
+#define SOFTSERIAL_ONE_WIRE_OVERDRIVE        (STD_ON)
+#else
+#error "SOFTSERIAL_TIMING_PROFILE must be SOFTSERIAL_PROFILE_STANDARD, SOFTSERIAL_PROFILE_FAST or SOFTSERIAL_PROFILE_MAX"
+#endif
+
+#if (SOFTSERIAL_ONE_WIRE_OVERDRIVE == STD_ON)
+#define SOFTSERIAL_ONE_WIRE_RESET_LOW_NS     (70000U)
+#define SOFTSERIAL_ONE_WIRE_PRESENCE_NS      (8500U)
+#define SOFTSERIAL_ONE_WIRE_RESET_REST_NS    (40000U)
+#define SOFTSERIAL_ONE_WIRE_WRITE1_LOW_NS    (1000U)
+#define SOFTSERIAL_ONE_WIRE_WRITE1_HIGH_NS   (7500U)
+#define SOFTSERIAL_ONE_WIRE_WRITE0_LOW_NS    (7500U)
+#define SOFTSERIAL_ONE_WIRE_WRITE0_HIGH_NS   (2500U)
+#define SOFTSERIAL_ONE_WIRE_READ_LOW_NS      (1000U)
+#define SOFTSERIAL_ONE_WIRE_READ_SAMPLE_NS   (1000U)
+#define SOFTSERIAL_ONE_WIRE_READ_REST_NS     (7000U)
+#else
+#define SOFTSERIAL_ONE_WIRE_RESET_LOW_NS     (480000U)
+#define SOFTSERIAL_ONE_WIRE_PRESENCE_NS      (70000U)
+#define SOFTSERIAL_ONE_WIRE_RESET_REST_NS    (410000U)
+#define SOFTSERIAL_ONE_WIRE_WRITE1_LOW_NS    (6000U)
+#define SOFTSERIAL_ONE_WIRE_WRITE1_HIGH_NS   (64000U)
+#define SOFTSERIAL_ONE_WIRE_WRITE0_LOW_NS    (60000U)
+#define SOFTSERIAL_ONE_WIRE_WRITE0_HIGH_NS   (10000U)
+#define SOFTSERIAL_ONE_WIRE_READ_LOW_NS      (6000U)
+#define SOFTSERIAL_ONE_WIRE_READ_SAMPLE_NS   (9000U)
+#define SOFTSERIAL_ONE_WIRE_READ_REST_NS     (55000U)
+#endif
+
+#ifdef MCAL_HOST_SIM
+/* The simulated peripherals have no PRIMASK, the simulator models it */
+#define SoftSerial_SuspendInterrupts()           Mcal_Sim_SuspendInterrupts()
+#define SoftSerial_ResumeInterrupts(PRIMASK)     Mcal_Sim_ResumeInterrupts(PRIMASK)
+#else
+/* Mask the interrupts (PRIMASK) and return the previous PRIMASK value */
+LOCAL_INLINE uint32 SoftSerial_SuspendInterrupts(void)
+{
+    uint32 Primask;
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (Primask) : : "memory");
+    return Primask;
+}
+
+/* Restore the PRIMASK value returned by SoftSerial_SuspendInterrupts */
+LOCAL_INLINE void SoftSerial_ResumeInterrupts(uint32 Primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (Primask) : "memory");
+}
+#endif
+
+#endif /* SOFTSERIAL_PRIVATE_H */
@@ -0,0 +1,40 @@
+/**
+ * @file Trace.c
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Trace.c is the source file for Trace.h file which contains the implementation of the functions.
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+#include "Trace.h"
+
+#if (TRACE_API == STD_ON)
+
+Trace_BufferType Trace_Buffer;
+
+void Trace_Init (void){
+    uint32 Index;
+
+    /* Power the DWT, then restart its cycle counter from 0 */
+    TRACE_WRITE_REG(TRACE_DEMCR_REGISTER_ADDRESS, TRACE_READ_REG(TRACE_DEMCR_REGISTER_ADDRESS) | TRACE_DEMCR_TRCENA);
+    TRACE_WRITE_REG(TRACE_DWT_CYCCNT_REGISTER_ADDRESS, 0U);
+    TRACE_WRITE_REG(TRACE_DWT_CTRL_REGISTER_ADDRESS, TRACE_READ_REG(TRACE_DWT_CTRL_REGISTER_ADDRESS) | TRACE_DWT_CTRL_CYCCNTENA);
+
+    Trace_Buffer.Head = 0U;
+    Trace_Buffer.Records = TRACE_RING_RECORDS;
+    {
+        /* Empty traced call: its record is the cost of the trace itself */
+        TRACE_SERVICE(TRACE_MODULE_ID, TRACE_INIT_SID, 0U);
+    }
+    Trace_Buffer.Overhead = Trace_Buffer.Ring[0].Cycles;
+    for (Index = 0U; Index < TRACE_RING_RECORDS; Index++)
+    {
+        Trace_Buffer.Ring[Index].Event = 0U;
+        Trace_Buffer.Ring[Index].Cycles = 0U;
+    }
+    Trace_Buffer.Head = 0U;
+}
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file Trace.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Trace file used for the cycle stamped trace of the DIO and Port services types and functions prototypes
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * @details With TRACE_API on, every DIO and Port service call leaves one fixed size record in a RAM ring: the
+ *          module ID, the service ID, the channel/port/pin argument and the DWT cycles the call took. A service
+ *          starts with TRACE_SERVICE, which reads the cycle counter into a local scope whose cleanup (a GCC/Clang
+ *          attribute) writes the record on every return of the service. The record costs two counter loads, an
+ *          exclusive load and store of the write index and two stores, without a critical section. The ring is
+ *          lock-free: the write index is claimed with LDREX/STREX before the record is written, an ISR taken
+ *          between them clears the exclusive monitor and the claim is retried, so every record, from a task or
+ *          an ISR, lands in its own slot. The cycles of a call include the ISRs taken during it. Sim/Trace_Decode.c turns a dump of Trace_Buffer
+ *          into per-service latency histograms.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define TRACE_SW_MAJOR_VERSION           (1U)
+#define TRACE_SW_MINOR_VERSION           (0U)
+#define TRACE_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define TRACE_AR_RELEASE_MAJOR_VERSION   (4U)
+#define TRACE_AR_RELEASE_MINOR_VERSION   (6U)
+#define TRACE_AR_RELEASE_PATCH_VERSION   (0U)
+
+/* Trace Module Id, in the vendor specific range: the calibration record of Trace_Init */
+#define TRACE_MODULE_ID                  (255U)
+
+#include "../Std_types.h"
+#include "Trace_Cfg.h"
+
+/* AUTOSAR checking between Std Types and Trace Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != TRACE_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != TRACE_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != TRACE_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* AUTOSAR Version checking between Trace_Cfg.h and Trace.h files */
+#if ((TRACE_CFG_AR_RELEASE_MAJOR_VERSION != TRACE_AR_RELEASE_MAJOR_VERSION)\
+ ||  (TRACE_CFG_AR_RELEASE_MINOR_VERSION != TRACE_AR_RELEASE_MINOR_VERSION)\
+ ||  (TRACE_CFG_AR_RELEASE_PATCH_VERSION != TRACE_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Trace_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Trace_Cfg.h and Trace.h files */
+#if ((TRACE_CFG_SW_MAJOR_VERSION != TRACE_SW_MAJOR_VERSION)\
+ ||  (TRACE_CFG_SW_MINOR_VERSION != TRACE_SW_MINOR_VERSION)\
+ ||  (TRACE_CFG_SW_PATCH_VERSION != TRACE_SW_PATCH_VERSION))
+  #error "The SW version of Trace_Cfg.h does not match the expected version"
+#endif
+
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Trace Init */
+#define TRACE_INIT_SID                   (uint8)0x00
+
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+/**
+ * @brief One trace record.
+ *
+ */
+typedef struct
+{
+    uint32 Event;     // Service ID in bits 0..7, module ID in bits 8..15, argument in bits 16..31.
+    uint32 Cycles;    // DWT cycles from the service entry to its return.
+}Trace_RecordType;
+
+/**
+ * @brief Trace ring, the layout a memory dump is decoded with (little endian words).
+ *
+ */
+typedef struct
+{
+    uint32 Head;         // Records written since Trace_Init, the next one goes to Ring[Head % Records].
+    uint32 Records;      // Number of records of the ring (TRACE_RING_RECORDS).
+    uint32 Overhead;     // Cycles of an empty traced call, counted in the Cycles of every record.
+    Trace_RecordType Ring[TRACE_RING_RECORDS];
+}Trace_BufferType;
+
+/* Event word of a record */
+#define TRACE_EVENT(MODULE, SID, ARG)    ((uint32)(SID) | ((uint32)(MODULE) << 8U) | ((uint32)(ARG) << 16U))
+
+#if (TRACE_API == STD_ON)
+#include "Trace_Private.h"
+
+/* Traced call in progress: its event word and its start cycle */
+typedef struct
+{
+    uint32 Event;
+    uint32 Start;
+}Trace_ScopeType;
+
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+/**
+ * @brief Trace_Init is a service that starts the DWT cycle counter and empties the trace ring.
+ *
+ * @details Service ID [hex] 0x00
+ *          Synchronous/Asynchronous: Synchronous
+ *          Reentrancy: Non Reentrant
+ *
+ *          To be called before the traced drivers are initialized. It also measures Overhead with one empty
+ *          traced call.
+ */
+void Trace_Init (void);
+
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Trace ring, read by the debugger or by Sim/Trace_Decode.c */
+extern Trace_BufferType Trace_Buffer;
+
+/* Writes the record of the traced call Scope, called by the cleanup of TRACE_SERVICE: the slot is claimed first */
+LOCAL_INLINE void Trace_Record(const Trace_ScopeType * Scope)
+{
+    uint32 Cycles = TRACE_READ_CYCLES() - Scope->Start;
+    uint32 Index;
+
+    do
+    {
+        Index = Trace_LoadExclusive(&Trace_Buffer.Head);
+    } while (Trace_StoreExclusive(&Trace_Buffer.Head, Index + 1U) != 0U);
+    Trace_Buffer.Ring[Index & TRACE_RING_MASK].Event = Scope->Event;
+    Trace_Buffer.Ring[Index & TRACE_RING_MASK].Cycles = Cycles;
+}
+
+/* First statement of a traced service: records the call with argument ARG when the service returns */
+#define TRACE_SERVICE(MODULE, SID, ARG)                                                   \
+    Trace_ScopeType Trace_Scope __attribute__((cleanup(Trace_Record))) =                  \
+        { TRACE_EVENT(MODULE, SID, ARG), TRACE_READ_CYCLES() }
+#else
+#define TRACE_SERVICE(MODULE, SID, ARG)
+#endif
+
+#endif /* TRACE_H */
@@ -0,0 +1,39 @@
+/**
+ * @file Trace_Cfg.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - DIO/Port service trace
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef TRACE_CFG_H
+#define TRACE_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define TRACE_CFG_SW_MAJOR_VERSION              (1U)
+#define TRACE_CFG_SW_MINOR_VERSION              (0U)
+#define TRACE_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.6.0
+ */
+#define TRACE_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define TRACE_CFG_AR_RELEASE_MINOR_VERSION     (6U)
+#define TRACE_CFG_AR_RELEASE_PATCH_VERSION     (0U)
+
+/* Pre-compile option to record every DIO and Port service call in the trace ring (GCC/Clang only). STD_OFF
+   removes the trace from the build, a build can turn it on with -DTRACE_API=STD_ON without editing this file.
+   Dio_ReadChannel/Dio_WriteChannel calls resolved inline by DIO_INLINE_FAST_PATH are not recorded */
+#ifndef TRACE_API
+#define TRACE_API                               (STD_OFF)
+#endif
+
+/* Number of records of the ring (power of 2), 8 bytes each: the oldest ones are overwritten */
+#define TRACE_RING_RECORDS                      (256U)
+
+#endif /* TRACE_CFG_H */
@@ -0,0 +1,62 @@
+/**
+ * @file Trace_Private.h
+ * @author Ahmed Moahmed (ahmed.moahmed.eng.25@gmail.com)
+ * @brief Trace Private Registers
+ * @version 0.1
+ * @date 2022-08-15
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef TRACE_PRIVATE_H
+#define TRACE_PRIVATE_H
+
+#include "../Mcal_Reg.h"
+
+#if ((TRACE_RING_RECORDS & (TRACE_RING_RECORDS - 1U)) != 0U)
+#error "TRACE_RING_RECORDS must be a power of 2"
+#endif
+
+/* Debug Exception and Monitor Control register, TRCENA powers the DWT */
+#define TRACE_DEMCR_REGISTER_ADDRESS          0xE000EDFCU
+#define TRACE_DEMCR_TRCENA                    (1UL << 24U)
+
+/* DWT control register and cycle counter of the Cortex-M4 */
+#define TRACE_DWT_CTRL_REGISTER_ADDRESS       0xE0001000U
+#define TRACE_DWT_CTRL_CYCCNTENA              (1UL << 0U)
+#define TRACE_DWT_CYCCNT_REGISTER_ADDRESS     0xE0001004U
+
+/* Index mask of the ring */
+#define TRACE_RING_MASK                       (TRACE_RING_RECORDS - 1U)
+
+/* Read/Write a DWT register */
+#define TRACE_READ_REG(ADDRESS)               MCAL_REG_READ32(ADDRESS)
+#define TRACE_WRITE_REG(ADDRESS, VALUE)       MCAL_REG_WRITE32(ADDRESS, VALUE)
+
+/* Cycle counter, one load */
+#define TRACE_READ_CYCLES()                   TRACE_READ_REG(TRACE_DWT_CYCCNT_REGISTER_ADDRESS)
+
+#ifdef MCAL_HOST_SIM
+/* The host has no exclusive monitor, the simulator models it */
+#define Trace_LoadExclusive(WORD)             Mcal_Sim_ReadExclusiveWord(WORD)
+#define Trace_StoreExclusive(WORD, VALUE)     Mcal_Sim_WriteExclusiveWord(WORD, VALUE)
+#else
+/* Exclusive load (LDREX) of the RAM word at Word, arms the local exclusive monitor */
+LOCAL_INLINE uint32 Trace_LoadExclusive(volatile uint32 * Word)
+{
+    uint32 Value;
+    __asm volatile ("ldrex %0, [%1]" : "=r" (Value) : "r" (Word) : "memory");
+    return Value;
+}
+
+/* Exclusive store (STREX) of Value to the RAM word at Word, returns 0 on success and 1 when the monitor was lost */
+LOCAL_INLINE uint32 Trace_StoreExclusive(volatile uint32 * Word, uint32 Value)
+{
+    uint32 Result;
+    __asm volatile ("strex %0, %2, [%1]" : "=&r" (Result) : "r" (Word), "r" (Value) : "memory");
+    return Result;
+}
+#endif
+
+#endif /* TRACE_PRIVATE_H */